@@ -17,16 +17,149 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "CharacterSet.h"
 
 namespace OpenLogReplicator {
+    //7-bit bytes checked 8 at a time in a 64-bit word
+    static uint64_t asciiLengthScalar(const uint8_t* data, uint64_t length) {
+        uint64_t pos = 0;
+        while (pos + 8 <= length) {
+            uint64_t word;
+            memcpy(&word, data + pos, sizeof(word));
+            if ((word & 0x8080808080808080ULL) != 0)
+                break;
+            pos += 8;
+        }
+        while (pos < length && data[pos] <= 0x7F)
+            ++pos;
+        return pos;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    //the high bit of every byte is collected directly by movemask
+    static uint64_t asciiLengthSse2(const uint8_t* data, uint64_t length) {
+        uint64_t pos = 0;
+
+        while (pos + 16 <= length) {
+            uint32_t mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(data + pos)));
+            if (mask != 0)
+                return pos + __builtin_ctz(mask);
+            pos += 16;
+        }
+        return pos + asciiLengthScalar(data + pos, length - pos);
+    }
+
+    __attribute__((target("avx2")))
+    static uint64_t asciiLengthAvx2(const uint8_t* data, uint64_t length) {
+        if (length < 32)
+            return asciiLengthSse2(data, length);
+
+        uint64_t pos = 0;
+        while (pos + 32 <= length) {
+            uint32_t mask = _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(data + pos)));
+            if (mask != 0)
+                return pos + __builtin_ctz(mask);
+            pos += 32;
+        }
+        //leave the upper state clean before the SSE2 tail, the transition is very slow otherwise
+        _mm256_zeroupper();
+        return pos + asciiLengthSse2(data + pos, length - pos);
+    }
+#elif defined(__aarch64__)
+    static uint64_t asciiLengthNeon(const uint8_t* data, uint64_t length) {
+        uint64_t pos = 0;
+
+        while (pos + 16 <= length) {
+            if (vmaxvq_u8(vld1q_u8(data + pos)) > 0x7F)
+                return pos + asciiLengthScalar(data + pos, 16);
+            pos += 16;
+        }
+        return pos + asciiLengthScalar(data + pos, length - pos);
+    }
+#endif
+
+    //choose the best kernel for the CPU at startup
+    static uint64_t (*asciiLengthSelect(void))(const uint8_t*, uint64_t) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return asciiLengthAvx2;
+        if (__builtin_cpu_supports("sse2"))
+            return asciiLengthSse2;
+#elif defined(__aarch64__)
+        return asciiLengthNeon;
+#endif
+        return asciiLengthScalar;
+    }
+
+    uint64_t (*CharacterSet::asciiLength)(const uint8_t* data, uint64_t length) = asciiLengthSelect();
+
     CharacterSet::CharacterSet(const char* name) :
-        name(name) {
+        name(name),
+        ascii(false) {
     }
 
     CharacterSet::~CharacterSet() {
     }
 
+    //length of the prefix which is well-formed UTF-8: no overlong forms, surrogates or code points over U+10FFFF,
+    //4-byte sequences only when allowed by the source character set
+    uint64_t CharacterSet::validUtf8Length(const uint8_t* str, uint64_t length, bool fourByte) {
+        uint64_t pos = 0;
+
+        while (pos < length) {
+            //ASCII runs skipped by the vector scan
+            uint64_t byte1 = str[pos];
+            if (byte1 <= 0x7F) {
+                pos += asciiLength(str + pos, length - pos);
+                continue;
+            }
+
+            uint64_t sequenceLength;
+            uint64_t byte2min = 0x80;
+            uint64_t byte2max = 0xBF;
+            if (byte1 >= 0xC2 && byte1 <= 0xDF)
+                sequenceLength = 2;
+            else if (byte1 >= 0xE0 && byte1 <= 0xEF) {
+                sequenceLength = 3;
+                if (byte1 == 0xE0)
+                    byte2min = 0xA0;
+                else if (byte1 == 0xED)
+                    byte2max = 0x9F;
+            } else if (fourByte && byte1 >= 0xF0 && byte1 <= 0xF4) {
+                sequenceLength = 4;
+                if (byte1 == 0xF0)
+                    byte2min = 0x90;
+                else if (byte1 == 0xF4)
+                    byte2max = 0x8F;
+            } else
+                return pos;
+
+            if (pos + sequenceLength > length || str[pos + 1] < byte2min || str[pos + 1] > byte2max)
+                return pos;
+            for (uint64_t i = 2; i < sequenceLength; ++i)
+                if ((str[pos + i] & 0xC0) != 0x80)
+                    return pos;
+
+            pos += sequenceLength;
+        }
+
+        return pos;
+    }
+
+    uint64_t CharacterSet::transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const {
+        uint8_t* bufferStart = buffer;
+        while (length > 0)
+            buffer = appendUtf8(buffer, decode(str, length));
+        return buffer - bufferStart;
+    }
+
     uint64_t CharacterSet::badChar(uint64_t byte1) const {
         ERROR("can't decode character: 0x" << std::setfill('0') << std::setw(2) << std::hex << byte1 << " in character set " << name);
         return UNICODE_UNKNOWN_CHARACTER;
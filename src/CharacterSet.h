@@ -18,6 +18,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
 #include "types.h"
+#include "RuntimeException.h"
 
 #ifndef CHARACTERSET_H_
 #define CHARACTERSET_H_
@@ -34,13 +35,74 @@ namespace OpenLogReplicator {
         uint64_t badChar(uint64_t byte1, uint64_t byte2, uint64_t byte3, uint64_t byte4, uint64_t byte5) const;
         uint64_t badChar(uint64_t byte1, uint64_t byte2, uint64_t byte3, uint64_t byte4, uint64_t byte5, uint64_t byte6) const;
 
+        static uint8_t* appendUtf8(uint8_t* buffer, typeunicode unicodeCharacter) {
+            //0xxxxxxx
+            if (unicodeCharacter <= 0x7F) {
+                *buffer++ = unicodeCharacter;
+
+            //110xxxxx 10xxxxxx
+            } else if (unicodeCharacter <= 0x7FF) {
+                *buffer++ = 0xC0 | (uint8_t)(unicodeCharacter >> 6);
+                *buffer++ = 0x80 | (uint8_t)(unicodeCharacter & 0x3F);
+
+            //1110xxxx 10xxxxxx 10xxxxxx
+            } else if (unicodeCharacter <= 0xFFFF) {
+                *buffer++ = 0xE0 | (uint8_t)(unicodeCharacter >> 12);
+                *buffer++ = 0x80 | (uint8_t)((unicodeCharacter >> 6) & 0x3F);
+                *buffer++ = 0x80 | (uint8_t)(unicodeCharacter & 0x3F);
+
+            //11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+            } else if (unicodeCharacter <= 0x10FFFF) {
+                *buffer++ = 0xF0 | (uint8_t)(unicodeCharacter >> 18);
+                *buffer++ = 0x80 | (uint8_t)((unicodeCharacter >> 12) & 0x3F);
+                *buffer++ = 0x80 | (uint8_t)((unicodeCharacter >> 6) & 0x3F);
+                *buffer++ = 0x80 | (uint8_t)(unicodeCharacter & 0x3F);
+
+            } else {
+                RUNTIME_FAIL("got character code: U+" << std::dec << unicodeCharacter);
+            }
+            return buffer;
+        }
+
+        static uint64_t validUtf8Length(const uint8_t* str, uint64_t length, bool fourByte);
+
+        //UTF-8 source: valid parts are copied as they are, T::decode is used only where validation stops
+        template<class T> static uint64_t transcodeUtf8(const T* characterSet, const uint8_t* str, uint64_t length, uint8_t* buffer, bool fourByte) {
+            uint8_t* bufferStart = buffer;
+            while (length > 0) {
+                uint64_t validLength = validUtf8Length(str, length, fourByte);
+                memcpy(buffer, str, validLength);
+                buffer += validLength;
+                str += validLength;
+                length -= validLength;
+
+                if (length > 0)
+                    buffer = appendUtf8(buffer, characterSet->T::decode(str, length));
+            }
+            return buffer - bufferStart;
+        }
+
+        //decode loop of one character set, T::decode is called directly and can be inlined
+        template<class T> static uint64_t transcode(const T* characterSet, const uint8_t* str, uint64_t length, uint8_t* buffer) {
+            uint8_t* bufferStart = buffer;
+            while (length > 0)
+                buffer = appendUtf8(buffer, characterSet->T::decode(str, length));
+            return buffer - bufferStart;
+        }
+
     public:
         const char* name;
+        //bytes 0x00..0x7F always decode to the same ASCII character
+        bool ascii;
+        //length of 7-bit prefix, kernel chosen for the CPU at startup
+        static uint64_t (*asciiLength)(const uint8_t* data, uint64_t length);
 
         CharacterSet(const char* name);
         virtual ~CharacterSet();
 
         virtual uint64_t decode(const uint8_t*& str, uint64_t& length) const = 0;
+        //whole string to UTF-8, buffer must have room for 3 bytes per input byte, returns bytes written
+        virtual uint64_t transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const;
     };
 }
 
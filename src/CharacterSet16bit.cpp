@@ -28,6 +28,8 @@ namespace OpenLogReplicator {
         byte1max(byte1max),
         byte2min(byte2min),
         byte2max(byte2max) {
+
+        ascii = true;
     }
 
     CharacterSet16bit::~CharacterSet16bit() {
@@ -51,6 +53,10 @@ namespace OpenLogReplicator {
         return readMap(byte1, byte2);
     }
 
+    uint64_t CharacterSet16bit::transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const {
+        return transcode(this, str, length, buffer);
+    }
+
     uint64_t CharacterSet16bit::readMap(uint64_t byte1, uint64_t byte2) const {
         return map[(byte1 - byte1min) * (byte2max - byte2min + 1) + (byte2 - byte2min)];
     }
@@ -77,6 +77,7 @@ namespace OpenLogReplicator {
         virtual ~CharacterSet16bit();
 
         virtual typeunicode decode(const uint8_t*& str, uint64_t& length) const;
+        virtual uint64_t transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const;
 
         static typeunicode16 unicode_map_JA16VMS[(JA16VMS_b1_max - JA16VMS_b1_min + 1) *
                                                  (JA16VMS_b2_max - JA16VMS_b2_min + 1)];
@@ -23,6 +23,12 @@ namespace OpenLogReplicator {
     CharacterSet7bit::CharacterSet7bit(const char* name, const typeunicode16* map) :
         CharacterSet(name),
         map(map) {
+
+        ascii = true;
+        for (typeunicode i = 0; i < 128; ++i)
+            if (map[i] != i)
+                ascii = false;
+        buildUtf8Table();
     }
 
     CharacterSet7bit::~CharacterSet7bit() {
@@ -31,7 +37,51 @@ namespace OpenLogReplicator {
     typeunicode CharacterSet7bit::decode(const uint8_t*& str, uint64_t& length) const {
         uint64_t byte1 = *str++;
         --length;
-        return readMap(byte1 & 0x7F);
+        return CharacterSet7bit::readMap(byte1 & 0x7F);
+    }
+
+    //called from constructor, decode of the class being constructed is used
+    void CharacterSet7bit::buildUtf8Table(void) {
+        for (uint64_t i = 0; i < 256; ++i) {
+            uint8_t byte1 = i;
+            const uint8_t* str = &byte1;
+            uint64_t length = 1;
+            uint8_t* end = appendUtf8(utf8Table[i], decode(str, length));
+            utf8Table[i][3] = end - utf8Table[i];
+        }
+    }
+
+    uint64_t CharacterSet7bit::transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const {
+        uint8_t* bufferStart = buffer;
+
+        //at least one more byte follows, so there is always room to store 4 bytes
+        while (length > 1) {
+            //ASCII run of at least 8 bytes found by the vector scan and copied as it is, shorter ones go through the table
+            if (ascii && length >= 8) {
+                uint64_t word;
+                memcpy(&word, str, sizeof(word));
+                if ((word & 0x8080808080808080ULL) == 0) {
+                    uint64_t run = asciiLength(str, length);
+                    memcpy(buffer, str, run);
+                    buffer += run;
+                    str += run;
+                    length -= run;
+                    continue;
+                }
+            }
+
+            const uint8_t* sequence = utf8Table[*str++];
+            memcpy(buffer, sequence, 4);
+            buffer += sequence[3];
+            --length;
+        }
+
+        if (length > 0) {
+            const uint8_t* sequence = utf8Table[*str];
+            memcpy(buffer, sequence, sequence[3]);
+            buffer += sequence[3];
+        }
+        return buffer - bufferStart;
     }
 
     typeunicode CharacterSet7bit::readMap(uint64_t character) const {
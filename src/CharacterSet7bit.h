@@ -26,13 +26,17 @@ namespace OpenLogReplicator {
     class CharacterSet7bit : public CharacterSet {
     protected:
         const typeunicode16* map;
+        //UTF-8 sequence for every byte value, last entry holds the sequence length
+        uint8_t utf8Table[256][4];
         virtual typeunicode readMap(uint64_t character) const;
+        void buildUtf8Table(void);
 
     public:
         CharacterSet7bit(const char* name, const typeunicode16* map);
         virtual ~CharacterSet7bit();
 
         virtual typeunicode decode(const uint8_t*& str, uint64_t& length) const;
+        virtual uint64_t transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const;
 
         //conversion arrays for 7-bit character sets
         static typeunicode16 unicode_map_D7DEC[128];
@@ -23,11 +23,19 @@ namespace OpenLogReplicator {
     CharacterSet8bit::CharacterSet8bit(const char* name, const typeunicode16* map) :
         CharacterSet7bit(name, map),
         customASCII(false) {
+
+        ascii = true;
+        buildUtf8Table();
     }
 
     CharacterSet8bit::CharacterSet8bit(const char* name, const typeunicode16* map, bool customASCII) :
         CharacterSet7bit(name, map),
         customASCII(customASCII) {
+
+        //map of custom ASCII character set already checked by base class
+        if (!customASCII)
+            ascii = true;
+        buildUtf8Table();
     }
 
     CharacterSet8bit::~CharacterSet8bit() {
@@ -36,7 +44,7 @@ namespace OpenLogReplicator {
     typeunicode CharacterSet8bit::decode(const uint8_t*& str, uint64_t& length) const {
         uint64_t byte1 = *str++;
         --length;
-        return readMap(byte1);
+        return CharacterSet8bit::readMap(byte1);
     }
 
     typeunicode CharacterSet8bit::readMap(uint64_t character) const {
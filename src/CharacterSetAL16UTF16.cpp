@@ -17,9 +17,101 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "CharacterSetAL16UTF16.h"
 
 namespace OpenLogReplicator {
+    static uint64_t copyAsciiScalar(const uint8_t* str, uint64_t length, uint8_t* buffer) {
+        uint64_t units = 0;
+        while (units * 2 + 2 <= length && str[units * 2] == 0 && str[units * 2 + 1] <= 0x7F) {
+            buffer[units] = str[units * 2 + 1];
+            ++units;
+        }
+        return units;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    //big-endian units loaded as little-endian words: 0x80FF masks the high byte and the top bit of the low byte,
+    //the whole block is stored and the count tells how much of it is valid, the caller overwrites the rest
+    static uint64_t copyAsciiSse2(const uint8_t* str, uint64_t length, uint8_t* buffer) {
+        const __m128i mask = _mm_set1_epi16((short)0x80FF);
+        const __m128i zero = _mm_setzero_si128();
+        uint64_t units = 0;
+
+        while (units * 2 + 16 <= length) {
+            __m128i data = _mm_loadu_si128((const __m128i*)(str + units * 2));
+            __m128i low = _mm_srli_epi16(data, 8);
+            _mm_storel_epi64((__m128i*)(buffer + units), _mm_packus_epi16(low, low));
+            uint32_t valid = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(data, mask), zero));
+            if (valid != 0xFFFF)
+                return units + __builtin_ctz(~valid) / 2;
+            units += 8;
+        }
+        return units + copyAsciiScalar(str + units * 2, length - units * 2, buffer + units);
+    }
+
+    __attribute__((target("avx2")))
+    static uint64_t copyAsciiAvx2(const uint8_t* str, uint64_t length, uint8_t* buffer) {
+        if (length < 32)
+            return copyAsciiSse2(str, length, buffer);
+
+        const __m256i mask = _mm256_set1_epi16((short)0x80FF);
+        const __m256i zero = _mm256_setzero_si256();
+        uint64_t units = 0;
+
+        while (units * 2 + 32 <= length) {
+            __m256i data = _mm256_loadu_si256((const __m256i*)(str + units * 2));
+            __m256i low = _mm256_srli_epi16(data, 8);
+            //packus works within 128-bit lanes, the permute brings both halves together
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, low), 0x08);
+            _mm_storeu_si128((__m128i*)(buffer + units), _mm256_castsi256_si128(packed));
+            uint32_t valid = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(data, mask), zero));
+            if (valid != 0xFFFFFFFF)
+                return units + __builtin_ctz(~valid) / 2;
+            units += 16;
+        }
+        //leave the upper state clean before the SSE2 tail, the transition is very slow otherwise
+        _mm256_zeroupper();
+        return units + copyAsciiSse2(str + units * 2, length - units * 2, buffer + units);
+    }
+#elif defined(__aarch64__)
+    static uint64_t copyAsciiNeon(const uint8_t* str, uint64_t length, uint8_t* buffer) {
+        const uint8x16_t mask = vdupq_n_u8(0x80);
+        uint64_t units = 0;
+
+        while (units * 2 + 32 <= length) {
+            //val[0] holds the high bytes, val[1] the low bytes
+            uint8x16x2_t data = vld2q_u8(str + units * 2);
+            if (vmaxvq_u8(vorrq_u8(data.val[0], vandq_u8(data.val[1], mask))) != 0)
+                break;
+            vst1q_u8(buffer + units, data.val[1]);
+            units += 16;
+        }
+        return units + copyAsciiScalar(str + units * 2, length - units * 2, buffer + units);
+    }
+#endif
+
+    //choose the best kernel for the CPU at startup
+    static uint64_t (*copyAsciiSelect(void))(const uint8_t*, uint64_t, uint8_t*) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return copyAsciiAvx2;
+        if (__builtin_cpu_supports("sse2"))
+            return copyAsciiSse2;
+#elif defined(__aarch64__)
+        return copyAsciiNeon;
+#endif
+        return copyAsciiScalar;
+    }
+
+    uint64_t (*CharacterSetAL16UTF16::copyAscii)(const uint8_t* str, uint64_t length, uint8_t* buffer) = copyAsciiSelect();
+
     CharacterSetAL16UTF16::CharacterSetAL16UTF16() :
         CharacterSet("AL16UTF16") {
     }
@@ -64,4 +156,45 @@ namespace OpenLogReplicator {
         } else
             return badChar(byte1, byte2, byte3, byte4);
     }
+
+    //BMP code units are encoded in place, surrogates and odd trailing byte go through decode
+    uint64_t CharacterSetAL16UTF16::transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const {
+        uint8_t* bufferStart = buffer;
+
+        while (length >= 2) {
+            //ASCII run of at least 4 units packed to single bytes by the vector kernel, shorter ones are encoded one by one
+            if (length >= 8) {
+                uint64_t word;
+                memcpy(&word, str, sizeof(word));
+                if ((word & 0x80FF80FF80FF80FFULL) == 0) {
+                    uint64_t units = copyAscii(str, length, buffer);
+                    buffer += units;
+                    str += units * 2;
+                    length -= units * 2;
+                    continue;
+                }
+            }
+
+            uint64_t unit = (((uint64_t)str[0]) << 8) | str[1];
+            if (unit <= 0x7F) {
+                *buffer++ = unit;
+            } else if (unit <= 0x7FF) {
+                *buffer++ = 0xC0 | (uint8_t)(unit >> 6);
+                *buffer++ = 0x80 | (uint8_t)(unit & 0x3F);
+            } else if ((unit & 0xF800) != 0xD800) {
+                *buffer++ = 0xE0 | (uint8_t)(unit >> 12);
+                *buffer++ = 0x80 | (uint8_t)((unit >> 6) & 0x3F);
+                *buffer++ = 0x80 | (uint8_t)(unit & 0x3F);
+            } else {
+                buffer = appendUtf8(buffer, CharacterSetAL16UTF16::decode(str, length));
+                continue;
+            }
+            str += 2;
+            length -= 2;
+        }
+
+        if (length > 0)
+            buffer = appendUtf8(buffer, CharacterSetAL16UTF16::decode(str, length));
+        return buffer - bufferStart;
+    }
 }
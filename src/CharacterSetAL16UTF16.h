@@ -25,10 +25,15 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     class CharacterSetAL16UTF16 : public CharacterSet {
     public:
+        //run of code units below 0x80 stored as single bytes, kernel chosen for the CPU at startup, returns units copied,
+        //up to 16 bytes past the run may be written, which the caller overwrites
+        static uint64_t (*copyAscii)(const uint8_t* str, uint64_t length, uint8_t* buffer);
+
         CharacterSetAL16UTF16();
         virtual ~CharacterSetAL16UTF16();
 
         virtual typeunicode decode(const uint8_t*& str, uint64_t& length) const;
+        virtual uint64_t transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const;
     };
 }
 
@@ -22,6 +22,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     CharacterSetAL32UTF8::CharacterSetAL32UTF8() :
         CharacterSet("AL32UTF8") {
+
+        ascii = true;
     }
 
     CharacterSetAL32UTF8::~CharacterSetAL32UTF8() {
@@ -79,4 +81,8 @@ namespace OpenLogReplicator {
 
         return badChar(byte1, byte2, byte3, byte4);
     }
+
+    uint64_t CharacterSetAL32UTF8::transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const {
+        return transcodeUtf8(this, str, length, buffer, true);
+    }
 }
@@ -22,10 +22,14 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     CharacterSetJA16EUC::CharacterSetJA16EUC() :
         CharacterSet("JA16EUC") {
+
+        ascii = true;
     }
 
     CharacterSetJA16EUC::CharacterSetJA16EUC(const char* name) :
         CharacterSet(name) {
+
+        ascii = true;
     }
 
     CharacterSetJA16EUC::~CharacterSetJA16EUC() {
@@ -64,6 +68,10 @@ namespace OpenLogReplicator {
         return readMap2(byte1, byte2);
     }
 
+    uint64_t CharacterSetJA16EUC::transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const {
+        return transcode(this, str, length, buffer);
+    }
+
     uint64_t CharacterSetJA16EUC::readMap2(uint64_t byte1, uint64_t byte2) const {
         return unicode_map_JA16EUC_2b[(byte1 - JA16EUC_b1_min) * (JA16EUC_b2_max - JA16EUC_b2_min + 1) +
                                       (byte2 - JA16EUC_b2_min)];
@@ -22,6 +22,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     CharacterSetUTF8::CharacterSetUTF8() :
         CharacterSet("UTF8") {
+
+        ascii = true;
     }
 
     CharacterSetUTF8::~CharacterSetUTF8() {
@@ -91,4 +93,9 @@ namespace OpenLogReplicator {
 
         return ((byte1 & 0x0F) << 12) | ((byte2 & 0x3F) << 6) | (byte3 & 0x3F);
     }
+
+    uint64_t CharacterSetUTF8::transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const {
+        //supplementary characters come as CESU-8 surrogate pairs, decoded on the slow path
+        return transcodeUtf8(this, str, length, buffer, false);
+    }
 }
@@ -29,6 +29,7 @@ namespace OpenLogReplicator {
         virtual ~CharacterSetUTF8();
 
         virtual typeunicode decode(const uint8_t*& str, uint64_t& length) const;
+        virtual uint64_t transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const;
     };
 }
 
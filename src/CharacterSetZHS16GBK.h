@@ -38,6 +38,7 @@ namespace OpenLogReplicator {
         virtual ~CharacterSetZHS16GBK();
 
         virtual typeunicode decode(const uint8_t*& str, uint64_t& length) const;
+        virtual uint64_t transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const;
     };
 }
 
@@ -49,6 +49,7 @@ namespace OpenLogReplicator {
         virtual ~CharacterSetZHT32EUC();
 
         virtual typeunicode decode(const uint8_t*& str, uint64_t& length) const;
+        virtual uint64_t transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const;
     };
 }
 
@@ -22,6 +22,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     CharacterSetZHT32TRIS::CharacterSetZHT32TRIS() :
         CharacterSet("ZHT32TRIS") {
+
+        ascii = true;
     }
 
     CharacterSetZHT32TRIS::~CharacterSetZHT32TRIS() {
@@ -59,6 +61,10 @@ namespace OpenLogReplicator {
                           + (byte4 - ZHT32TRIS_b4_min)];
     }
 
+    uint64_t CharacterSetZHT32TRIS::transcodeToUtf8(const uint8_t* str, uint64_t length, uint8_t* buffer) const {
+        return transcode(this, str, length, buffer);
+    }
+
     typeunicode16 CharacterSetZHT32TRIS::unicode_map_ZHT32TRIS_4b[(ZHT32TRIS_b2_max - ZHT32TRIS_b2_min + 1) *
                                                                   (ZHT32TRIS_b3_max - ZHT32TRIS_b3_min + 1) *
                                                                   (ZHT32TRIS_b4_max - ZHT32TRIS_b4_min + 1)] = {
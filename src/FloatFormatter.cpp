@@ -0,0 +1,331 @@
+/* Shortest round-trip formatting of floating point numbers
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include "FloatFormatter.h"
+
+namespace OpenLogReplicator {
+    //10^k for k = -348, -340, ..., 340
+    const uint64_t FloatFormatter::cachedPowersF[87] = {
+            0xfa8fd5a0081c0288, 0xbaaee17fa23ebf76, 0x8b16fb203055ac76,
+            0xcf42894a5dce35ea, 0x9a6bb0aa55653b2d, 0xe61acf033d1a45df,
+            0xab70fe17c79ac6ca, 0xff77b1fcbebcdc4f, 0xbe5691ef416bd60c,
+            0x8dd01fad907ffc3c, 0xd3515c2831559a83, 0x9d71ac8fada6c9b5,
+            0xea9c227723ee8bcb, 0xaecc49914078536d, 0x823c12795db6ce57,
+            0xc21094364dfb5637, 0x9096ea6f3848984f, 0xd77485cb25823ac7,
+            0xa086cfcd97bf97f4, 0xef340a98172aace5, 0xb23867fb2a35b28e,
+            0x84c8d4dfd2c63f3b, 0xc5dd44271ad3cdba, 0x936b9fcebb25c996,
+            0xdbac6c247d62a584, 0xa3ab66580d5fdaf6, 0xf3e2f893dec3f126,
+            0xb5b5ada8aaff80b8, 0x87625f056c7c4a8b, 0xc9bcff6034c13053,
+            0x964e858c91ba2655, 0xdff9772470297ebd, 0xa6dfbd9fb8e5b88f,
+            0xf8a95fcf88747d94, 0xb94470938fa89bcf, 0x8a08f0f8bf0f156b,
+            0xcdb02555653131b6, 0x993fe2c6d07b7fac, 0xe45c10c42a2b3b06,
+            0xaa242499697392d3, 0xfd87b5f28300ca0e, 0xbce5086492111aeb,
+            0x8cbccc096f5088cc, 0xd1b71758e219652c, 0x9c40000000000000,
+            0xe8d4a51000000000, 0xad78ebc5ac620000, 0x813f3978f8940984,
+            0xc097ce7bc90715b3, 0x8f7e32ce7bea5c70, 0xd5d238a4abe98068,
+            0x9f4f2726179a2245, 0xed63a231d4c4fb27, 0xb0de65388cc8ada8,
+            0x83c7088e1aab65db, 0xc45d1df942711d9a, 0x924d692ca61be758,
+            0xda01ee641a708dea, 0xa26da3999aef774a, 0xf209787bb47d6b85,
+            0xb454e4a179dd1877, 0x865b86925b9bc5c2, 0xc83553c5c8965d3d,
+            0x952ab45cfa97a0b3, 0xde469fbd99a05fe3, 0xa59bc234db398c25,
+            0xf6c69a72a3989f5c, 0xb7dcbf5354e9bece, 0x88fcf317f22241e2,
+            0xcc20ce9bd35c78a5, 0x98165af37b2153df, 0xe2a0b5dc971f303a,
+            0xa8d9d1535ce3b396, 0xfb9b7cd9a4a7443c, 0xbb764c4ca7a44410,
+            0x8bab8eefb6409c1a, 0xd01fef10a657842c, 0x9b10a4e5e9913129,
+            0xe7109bfba19c0c9d, 0xac2820d9623bf429, 0x80444b5e7aa7cf85,
+            0xbf21e44003acdd2d, 0x8e679c2f5e44ff8f, 0xd433179d9c8cb841,
+            0x9e19db92b4e31ba9, 0xeb96bf6ebadf77d9, 0xaf87023b9bf0ee6b
+    };
+
+    const int16_t FloatFormatter::cachedPowersE[87] = {
+            -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+            -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+            -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+            -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+            -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+            109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+            375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+            641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+            907, 933, 960, 986, 1013, 1039, 1066
+    };
+
+    const uint64_t FloatFormatter::pow10[20] = {
+            1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+            10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+            10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+    };
+
+    FloatFormatter::DiyFp FloatFormatter::multiply(const DiyFp& a, const DiyFp& b) {
+        uint64_t aHi = a.f >> 32;
+        uint64_t aLo = a.f & 0xFFFFFFFF;
+        uint64_t bHi = b.f >> 32;
+        uint64_t bLo = b.f & 0xFFFFFFFF;
+        uint64_t hiHi = aHi * bHi;
+        uint64_t loHi = aLo * bHi;
+        uint64_t hiLo = aHi * bLo;
+        uint64_t loLo = aLo * bLo;
+        //round the lower 64 bits
+        uint64_t tmp = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + (loHi & 0xFFFFFFFF) + (((uint64_t)1) << 31);
+
+        DiyFp result;
+        result.f = hiHi + (hiLo >> 32) + (loHi >> 32) + (tmp >> 32);
+        result.e = a.e + b.e + 64;
+        return result;
+    }
+
+    FloatFormatter::DiyFp FloatFormatter::normalize(DiyFp value) {
+        while ((value.f & 0x8000000000000000ULL) == 0) {
+            value.f <<= 1;
+            --value.e;
+        }
+        return value;
+    }
+
+    void FloatFormatter::round(char* buffer, uint64_t length, uint64_t delta, uint64_t rest, uint64_t tenKappa, uint64_t wpW) {
+        while (rest < wpW && delta - rest >= tenKappa &&
+                (rest + tenKappa < wpW || wpW - rest > rest + tenKappa - wpW)) {
+            --buffer[length - 1];
+            rest += tenKappa;
+        }
+    }
+
+    uint64_t FloatFormatter::digits(const DiyFp& w, const DiyFp& mp, uint64_t delta, char* buffer, int64_t& k) {
+        uint64_t oneShift = -mp.e;
+        uint64_t oneF = ((uint64_t)1) << oneShift;
+        uint64_t wpW = mp.f - w.f;
+        uint32_t p1 = mp.f >> oneShift;
+        uint64_t p2 = mp.f & (oneF - 1);
+        uint64_t length = 0;
+
+        int64_t kappa = 10;
+        while (kappa > 1 && p1 < pow10[kappa - 1])
+            --kappa;
+
+        //integral part
+        while (kappa > 0) {
+            uint32_t d = p1 / pow10[kappa - 1];
+            p1 %= pow10[kappa - 1];
+            if (d != 0 || length > 0)
+                buffer[length++] = '0' + d;
+            --kappa;
+
+            uint64_t rest = (((uint64_t)p1) << oneShift) + p2;
+            if (rest <= delta) {
+                k += kappa;
+                round(buffer, length, delta, rest, pow10[kappa] << oneShift, wpW);
+                return length;
+            }
+        }
+
+        //fractional part
+        for (;;) {
+            p2 *= 10;
+            delta *= 10;
+            char d = p2 >> oneShift;
+            if (d != 0 || length > 0)
+                buffer[length++] = '0' + d;
+            p2 &= oneF - 1;
+            --kappa;
+
+            if (p2 < delta) {
+                k += kappa;
+                int64_t index = -kappa;
+                round(buffer, length, delta, p2, oneF, (index < 20) ? wpW * pow10[index] : 0);
+                return length;
+            }
+        }
+    }
+
+    uint64_t FloatFormatter::grisu(uint64_t f, int64_t e, bool lowerCloser, char* buffer, int64_t& k) {
+        //boundaries halfway to the neighbour values
+        DiyFp plus;
+        plus.f = (f << 1) + 1;
+        plus.e = e - 1;
+        plus = normalize(plus);
+
+        DiyFp minus;
+        if (lowerCloser) {
+            minus.f = (f << 2) - 1;
+            minus.e = e - 2;
+        } else {
+            minus.f = (f << 1) - 1;
+            minus.e = e - 1;
+        }
+        minus.f <<= minus.e - plus.e;
+        minus.e = plus.e;
+
+        DiyFp v;
+        v.f = f;
+        v.e = e;
+        v = normalize(v);
+
+        //cached power which brings the exponent to [-60, -32]
+        double dk = (-61 - plus.e) * 0.30102999566398114 + 347;
+        int64_t kCached = (int64_t)dk;
+        if (dk - kCached > 0.0)
+            ++kCached;
+        uint64_t index = (kCached >> 3) + 1;
+        k = -(-348 + (int64_t)index * 8);
+
+        DiyFp cached;
+        cached.f = cachedPowersF[index];
+        cached.e = cachedPowersE[index];
+
+        DiyFp w = multiply(v, cached);
+        DiyFp wp = multiply(plus, cached);
+        DiyFp wm = multiply(minus, cached);
+        ++wm.f;
+        --wp.f;
+        return digits(w, wp, wp.f - wm.f, buffer, k);
+    }
+
+    uint64_t FloatFormatter::prettify(char* buffer, uint64_t length, int64_t k) {
+        //10^(kk-1) <= v < 10^kk
+        int64_t kk = (int64_t)length + k;
+
+        if (k >= 0 && kk <= 21) {
+            //1234e7 -> 12340000000.0
+            for (int64_t i = length; i < kk; ++i)
+                buffer[i] = '0';
+            buffer[kk] = '.';
+            buffer[kk + 1] = '0';
+            return kk + 2;
+        }
+
+        if (kk > 0 && kk <= 21) {
+            //1234e-2 -> 12.34
+            memmove(buffer + kk + 1, buffer + kk, length - kk);
+            buffer[kk] = '.';
+            return length + 1;
+        }
+
+        if (kk > -6 && kk <= 0) {
+            //1234e-6 -> 0.001234
+            int64_t offset = 2 - kk;
+            memmove(buffer + offset, buffer, length);
+            buffer[0] = '0';
+            buffer[1] = '.';
+            for (int64_t i = 2; i < offset; ++i)
+                buffer[i] = '0';
+            return length + offset;
+        }
+
+        uint64_t pos;
+        if (length == 1) {
+            //1e30
+            pos = 1;
+        } else {
+            //1234e30 -> 1.234e33
+            memmove(buffer + 2, buffer + 1, length - 1);
+            buffer[1] = '.';
+            pos = length + 1;
+        }
+
+        int64_t exponent = kk - 1;
+        buffer[pos++] = 'e';
+        if (exponent < 0) {
+            buffer[pos++] = '-';
+            exponent = -exponent;
+        }
+        if (exponent >= 100) {
+            buffer[pos++] = '0' + exponent / 100;
+            exponent %= 100;
+            buffer[pos++] = '0' + exponent / 10;
+        } else if (exponent >= 10)
+            buffer[pos++] = '0' + exponent / 10;
+        buffer[pos++] = '0' + exponent % 10;
+        return pos;
+    }
+
+    uint64_t FloatFormatter::special(bool negative, bool nan, bool zero, char* buffer) {
+        uint64_t pos = 0;
+        if (nan) {
+            memcpy(buffer, "nan", 3);
+            return 3;
+        }
+        if (negative)
+            buffer[pos++] = '-';
+        if (zero) {
+            memcpy(buffer + pos, "0.0", 3);
+            return pos + 3;
+        }
+        memcpy(buffer + pos, "inf", 3);
+        return pos + 3;
+    }
+
+    uint64_t FloatFormatter::format(double value, char* buffer) {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        bool negative = (bits >> 63) != 0;
+        uint64_t biased = (bits >> 52) & 0x7FF;
+        uint64_t significand = bits & 0x000FFFFFFFFFFFFFULL;
+
+        if (biased == 0x7FF)
+            return special(negative, significand != 0, false, buffer);
+        if (biased == 0 && significand == 0)
+            return special(negative, false, true, buffer);
+
+        uint64_t f;
+        int64_t e;
+        if (biased != 0) {
+            f = significand | 0x0010000000000000ULL;
+            e = (int64_t)biased - 1075;
+        } else {
+            f = significand;
+            e = -1074;
+        }
+
+        uint64_t pos = 0;
+        if (negative)
+            buffer[pos++] = '-';
+        int64_t k;
+        uint64_t length = grisu(f, e, significand == 0 && biased > 1, buffer + pos, k);
+        return pos + prettify(buffer + pos, length, k);
+    }
+
+    uint64_t FloatFormatter::format(float value, char* buffer) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        bool negative = (bits >> 31) != 0;
+        uint64_t biased = (bits >> 23) & 0xFF;
+        uint64_t significand = bits & 0x007FFFFF;
+
+        if (biased == 0xFF)
+            return special(negative, significand != 0, false, buffer);
+        if (biased == 0 && significand == 0)
+            return special(negative, false, true, buffer);
+
+        uint64_t f;
+        int64_t e;
+        if (biased != 0) {
+            f = significand | 0x00800000;
+            e = (int64_t)biased - 150;
+        } else {
+            f = significand;
+            e = -149;
+        }
+
+        uint64_t pos = 0;
+        if (negative)
+            buffer[pos++] = '-';
+        int64_t k;
+        uint64_t length = grisu(f, e, significand == 0 && biased > 1, buffer + pos, k);
+        return pos + prettify(buffer + pos, length, k);
+    }
+}
@@ -0,0 +1,54 @@
+/* Header for FloatFormatter class
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include "types.h"
+
+#ifndef FLOATFORMATTER_H_
+#define FLOATFORMATTER_H_
+
+#define FLOAT_FORMATTER_BUFFER_SIZE             32
+
+namespace OpenLogReplicator {
+    //shortest round-trip decimal form of binary_float/binary_double (Grisu2)
+    class FloatFormatter {
+    protected:
+        static const uint64_t cachedPowersF[87];
+        static const int16_t cachedPowersE[87];
+        static const uint64_t pow10[20];
+
+        struct DiyFp {
+            uint64_t f;
+            int64_t e;
+        };
+
+        static DiyFp multiply(const DiyFp& a, const DiyFp& b);
+        static DiyFp normalize(DiyFp value);
+        static void round(char* buffer, uint64_t length, uint64_t delta, uint64_t rest, uint64_t tenKappa, uint64_t wpW);
+        static uint64_t digits(const DiyFp& w, const DiyFp& mp, uint64_t delta, char* buffer, int64_t& k);
+        static uint64_t grisu(uint64_t f, int64_t e, bool lowerCloser, char* buffer, int64_t& k);
+        static uint64_t prettify(char* buffer, uint64_t length, int64_t k);
+        static uint64_t special(bool negative, bool nan, bool zero, char* buffer);
+
+    public:
+        static uint64_t format(double value, char* buffer);
+        static uint64_t format(float value, char* buffer);
+    };
+}
+
+#endif
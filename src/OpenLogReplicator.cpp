@@ -33,13 +33,16 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "OracleAnalyzer.h"
 #include "OracleAnalyzerBatch.h"
 #include "OutputBuffer.h"
+#include "OutputBufferAvro.h"
 #include "OutputBufferJson.h"
+#include "ParquetTable.h"
 #include "RowId.h"
 #include "RuntimeException.h"
 #include "Schema.h"
 #include "SchemaElement.h"
 #include "StateDisk.h"
 #include "WriterFile.h"
+#include "WriterParquet.h"
 
 #ifdef LINK_LIBRARY_HIREDIS
 #include "StateRedis.h"
@@ -249,8 +252,8 @@ int main(int argc, char** argv) {
             uint64_t messageFormat = MESSAGE_FORMAT_DEFAULT;
             if (formatJSON.HasMember("message")) {
                 messageFormat = OpenLogReplicator::getJSONfieldU64(fileName, formatJSON, "message");
-                if (messageFormat > 15) {
-                    CONFIG_FAIL("bad JSON, invalid \"message\" value: " << std::dec << messageFormat << ", expected one of: {0.. 15}");
+                if (messageFormat > 31) {
+                    CONFIG_FAIL("bad JSON, invalid \"message\" value: " << std::dec << messageFormat << ", expected one of: {0.. 31}");
                 }
                 if ((messageFormat & MESSAGE_FORMAT_FULL) != 0 &&
                         (messageFormat & (MESSAGE_FORMAT_SKIP_BEGIN | MESSAGE_FORMAT_SKIP_COMMIT)) != 0) {
@@ -258,6 +261,37 @@ int main(int argc, char** argv) {
                             ", you are not allowed to use BEGIN/COMMIT flag (" << std::dec << MESSAGE_FORMAT_SKIP_BEGIN << "/" <<
                             MESSAGE_FORMAT_SKIP_COMMIT << ") together with FULL mode (" << std::dec << MESSAGE_FORMAT_FULL << ")");
                 }
+                if ((messageFormat & MESSAGE_FORMAT_FULL) != 0 && (messageFormat & MESSAGE_FORMAT_BATCH) != 0) {
+                    CONFIG_FAIL("bad JSON, invalid \"message\" value: " << std::dec << messageFormat <<
+                            ", you are not allowed to use BATCH mode (" << std::dec << MESSAGE_FORMAT_BATCH << ") together with FULL mode (" <<
+                            std::dec << MESSAGE_FORMAT_FULL << ")");
+                }
+            }
+
+            uint64_t batchRows = 1000;
+            if (formatJSON.HasMember("batch-rows")) {
+                batchRows = OpenLogReplicator::getJSONfieldU64(fileName, formatJSON, "batch-rows");
+                if (batchRows < 1 || batchRows > 1000000) {
+                    CONFIG_FAIL("bad JSON, invalid \"batch-rows\" value: " << std::dec << batchRows << ", expected one of: {1 .. 1000000}");
+                }
+            }
+
+            //an open batch is one message held in the output buffer, it must leave room for other memory users
+            uint64_t batchBytes = 1048576;
+            if (formatJSON.HasMember("batch-bytes")) {
+                batchBytes = OpenLogReplicator::getJSONfieldU64(fileName, formatJSON, "batch-bytes");
+                if (batchBytes < 1 || batchBytes > memoryMaxMb * 1024 * 1024 / 2) {
+                    CONFIG_FAIL("bad JSON, invalid \"batch-bytes\" value: " << std::dec << batchBytes << ", expected one of: {1 .. " <<
+                            (memoryMaxMb * 1024 * 1024 / 2) << "}, half of \"memory-max-mb\" value at most");
+                }
+            }
+
+            uint64_t batchUs = 10000;
+            if (formatJSON.HasMember("batch-us")) {
+                batchUs = OpenLogReplicator::getJSONfieldU64(fileName, formatJSON, "batch-us");
+                if (batchUs < 1 || batchUs > 60000000) {
+                    CONFIG_FAIL("bad JSON, invalid \"batch-us\" value: " << std::dec << batchUs << ", expected one of: {1 .. 60000000}");
+                }
             }
 
             uint64_t ridFormat = RID_FORMAT_SKIP;
@@ -332,6 +366,14 @@ int main(int argc, char** argv) {
                 }
             }
 
+            uint64_t numberFormat = NUMBER_FORMAT_TEXT;
+            if (formatJSON.HasMember("number")) {
+                numberFormat = OpenLogReplicator::getJSONfieldU64(fileName, formatJSON, "number");
+                if (numberFormat > 1) {
+                    CONFIG_FAIL("bad JSON, invalid \"number\" value: " << std::dec << numberFormat << ", expected one of: {0, 1}");
+                }
+            }
+
             uint64_t flushBuffer = 1048576;
             if (formatJSON.HasMember("flush-buffer"))
                 flushBuffer = OpenLogReplicator::getJSONfieldU64(fileName, formatJSON, "flush-buffer");
@@ -341,21 +383,30 @@ int main(int argc, char** argv) {
             OpenLogReplicator::OutputBuffer* outputBuffer = nullptr;
             if (strcmp("json", formatType) == 0) {
                 outputBuffer = new OpenLogReplicator::OutputBufferJson(messageFormat, ridFormat, xidFormat, timestampFormat, charFormat, scnFormat, unknownFormat,
-                        schemaFormat, columnFormat, unknownType, flushBuffer);
+                        schemaFormat, columnFormat, unknownType, numberFormat, flushBuffer);
             } else if (strcmp("protobuf", formatType) == 0) {
 #ifdef LINK_LIBRARY_PROTOBUF
                 outputBuffer = new OpenLogReplicator::OutputBufferProtobuf(messageFormat, ridFormat, xidFormat, timestampFormat, charFormat, scnFormat, unknownFormat,
-                        schemaFormat, columnFormat, unknownType, flushBuffer);
+                        schemaFormat, columnFormat, unknownType, numberFormat, flushBuffer);
 #else
                 RUNTIME_FAIL("format \"protobuf\" is not compiled, exiting");
 #endif /* LINK_LIBRARY_PROTOBUF */
-                } else {
+            } else if (strcmp("avro", formatType) == 0) {
+                if ((messageFormat & MESSAGE_FORMAT_FULL) != 0) {
+                    CONFIG_FAIL("bad JSON, invalid \"message\" value: " << std::dec << messageFormat << ", FULL mode (" << std::dec <<
+                            MESSAGE_FORMAT_FULL << ") is not supported for \"avro\" format");
+                }
+                const char* schemaRegistry = OpenLogReplicator::getJSONfieldS(fileName, MAX_PATH_LENGTH, formatJSON, "schema-registry");
+                outputBuffer = new OpenLogReplicator::OutputBufferAvro(messageFormat, ridFormat, xidFormat, timestampFormat, charFormat, scnFormat, unknownFormat,
+                        schemaFormat, columnFormat, unknownType, numberFormat, flushBuffer, schemaRegistry);
+            } else {
                 CONFIG_FAIL("bad JSON, invalid \"type\" value: " << formatType);
             }
 
             if (outputBuffer == nullptr) {
                 RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(OpenLogReplicator::OutputBuffer) << " bytes memory (for: command buffer)");
             }
+            outputBuffer->setBatch(batchRows, batchBytes, batchUs);
             buffers.push_back(outputBuffer);
 
 
@@ -579,6 +630,35 @@ int main(int argc, char** argv) {
                             }
                         } else
                             element->keysStr = "";
+
+                        if (tableElementJSON.HasMember("columns") && tableElementJSON.HasMember("exclude-columns")) {
+                            CONFIG_FAIL("bad JSON, invalid \"columns\" and \"exclude-columns\" values for " << element->owner << "." << element->table <<
+                                    ", only one of them can be used");
+                        }
+
+                        const char* columnsList = nullptr;
+                        if (tableElementJSON.HasMember("columns")) {
+                            columnsList = OpenLogReplicator::getJSONfieldS(fileName, JSON_KEY_LENGTH, tableElementJSON, "columns");
+                        } else if (tableElementJSON.HasMember("exclude-columns")) {
+                            columnsList = OpenLogReplicator::getJSONfieldS(fileName, JSON_KEY_LENGTH, tableElementJSON, "exclude-columns");
+                            element->columnsExclude = true;
+                        }
+
+                        if (columnsList != nullptr) {
+                            std::stringstream columnsStream(columnsList);
+
+                            while (columnsStream.good()) {
+                                std::string column;
+                                getline(columnsStream, column, ',');
+                                column.erase(remove(column.begin(), column.end(), ' '), column.end());
+                                transform(column.begin(), column.end(),column.begin(), ::toupper);
+                                if (column.length() > 0)
+                                    element->columns.push_back(column);
+                            }
+                        }
+
+                        if (tableElementJSON.HasMember("condition"))
+                            element->condition = OpenLogReplicator::getJSONfieldS(fileName, JSON_CONDITION_LENGTH, tableElementJSON, "condition");
                     }
                 }
 
@@ -691,8 +771,8 @@ int main(int argc, char** argv) {
 
             if (sourceJSON.HasMember("flags")) {
                 uint64_t flags = OpenLogReplicator::getJSONfieldU64(fileName, sourceJSON, "flags");
-                if (flags > 16383) {
-                    CONFIG_FAIL("bad JSON, invalid \"flags\" value: " << std::dec << flags << ", expected one of: {0 .. 16383}");
+                if (flags > 32767) {
+                    CONFIG_FAIL("bad JSON, invalid \"flags\" value: " << std::dec << flags << ", expected one of: {0 .. 32767}");
                 }
                 if ((flags & REDO_FLAGS_SCHEMALESS) != 0 && columnFormat > 0) {
                     CONFIG_FAIL("bad JSON, invalid \"column\" value: " << std::dec << columnFormat << " is invalid for schemaless mode");
@@ -716,6 +796,32 @@ int main(int argc, char** argv) {
                 }
             }
 
+            if (sourceJSON.HasMember("memory-report-interval-s"))
+                oracleAnalyzer->memoryReportIntervalS = OpenLogReplicator::getJSONfieldU64(fileName, sourceJSON, "memory-report-interval-s");
+
+            if (sourceJSON.HasMember("memory-output-buffer-max-mb")) {
+                uint64_t outputBufferMaxMb = OpenLogReplicator::getJSONfieldU64(fileName, sourceJSON, "memory-output-buffer-max-mb");
+                outputBufferMaxMb = (outputBufferMaxMb / MEMORY_CHUNK_SIZE_MB) * MEMORY_CHUNK_SIZE_MB;
+                if (outputBufferMaxMb > 0 && outputBufferMaxMb < MEMORY_OUTPUT_BUFFER_QUOTA_MIN_MB) {
+                    CONFIG_FAIL("bad JSON, \"memory-output-buffer-max-mb\" value must be at least " << std::dec << MEMORY_OUTPUT_BUFFER_QUOTA_MIN_MB);
+                }
+                if (outputBufferMaxMb > memoryMaxMb) {
+                    CONFIG_FAIL("bad JSON, \"memory-output-buffer-max-mb\" value can't be greater than \"memory-max-mb\" value");
+                }
+                if (outputBufferMaxMb > 0 && (messageFormat & MESSAGE_FORMAT_BATCH) != 0 && batchBytes >= outputBufferMaxMb * 1024 * 1024 / 2) {
+                    CONFIG_FAIL("bad JSON, \"batch-bytes\" value must be lower than half of \"memory-output-buffer-max-mb\" value");
+                }
+                oracleAnalyzer->memoryModulesMax[MEMORY_MODULE_OUTPUT_BUFFER] = outputBufferMaxMb / MEMORY_CHUNK_SIZE_MB;
+            }
+
+            if (sourceJSON.HasMember("transaction-stream-mb")) {
+                uint64_t transactionStreamMb = OpenLogReplicator::getJSONfieldU64(fileName, sourceJSON, "transaction-stream-mb");
+                if (transactionStreamMb >= memoryMaxMb) {
+                    CONFIG_FAIL("bad JSON, \"transaction-stream-mb\" value must be lower than \"memory-max-mb\" value");
+                }
+                oracleAnalyzer->transactionStreamMax = transactionStreamMb * 1024 * 1024;
+            }
+
             if (sourceJSON.HasMember("redo-read-sleep-us"))
                 oracleAnalyzer->redoReadSleepUs = OpenLogReplicator::getJSONfieldU64(fileName, sourceJSON, "redo-read-sleep-us");
 
@@ -907,11 +1013,76 @@ int main(int argc, char** argv) {
                     }
                 }
 
+                uint64_t batchMessages = 1024;
+                if (writerJSON.HasMember("batch-messages")) {
+                    batchMessages = OpenLogReplicator::getJSONfieldU64(fileName, writerJSON, "batch-messages");
+                    if (batchMessages < 1 || batchMessages > queueSize) {
+                        CONFIG_FAIL("bad JSON, invalid \"batch-messages\" value: " << std::dec << batchMessages << ", expected one of: {1 .. " << queueSize << "}");
+                    }
+                }
+                if (batchMessages > queueSize)
+                    batchMessages = queueSize;
+
+                uint64_t batchBytes = 1048576;
+                if (writerJSON.HasMember("batch-bytes")) {
+                    batchBytes = OpenLogReplicator::getJSONfieldU64(fileName, writerJSON, "batch-bytes");
+                    if (batchBytes < 1 || batchBytes > 1073741824) {
+                        CONFIG_FAIL("bad JSON, invalid \"batch-bytes\" value: " << std::dec << batchBytes << ", expected one of: {1 .. 1073741824}");
+                    }
+                }
+
+                uint64_t batchUs = 1000;
+                if (writerJSON.HasMember("batch-us")) {
+                    batchUs = OpenLogReplicator::getJSONfieldU64(fileName, writerJSON, "batch-us");
+                    if (batchUs < 1 || batchUs > 60000000) {
+                        CONFIG_FAIL("bad JSON, invalid \"batch-us\" value: " << std::dec << batchUs << ", expected one of: {1 .. 60000000}");
+                    }
+                }
+
                 writer = new OpenLogReplicator::WriterFile(alias, oracleAnalyzer, pollIntervalUs, checkpointIntervalS, queueSize, startScn,
-                        startSequence, startTime, startTimeRel, output, format, maxSize, newLine, append);
+                        startSequence, startTime, startTimeRel, output, format, maxSize, newLine, append, batchMessages, batchBytes, batchUs);
                 if (writer == nullptr) {
                     RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(OpenLogReplicator::WriterFile) << " bytes memory (for: file writer)");
                 }
+            } else if (strcmp(writerType, "parquet") == 0) {
+                //rows are passed by the output buffer directly, messages of any format only carry the checkpoints
+                const char* output = OpenLogReplicator::getJSONfieldS(fileName, JSON_PARAMETER_LENGTH, writerJSON, "output");
+
+                uint64_t maxSize = 134217728;
+                if (writerJSON.HasMember("max-size")) {
+                    maxSize = OpenLogReplicator::getJSONfieldU64(fileName, writerJSON, "max-size");
+                    if (maxSize < 1048576 || maxSize > 1073741824) {
+                        CONFIG_FAIL("bad JSON, invalid \"max-size\" value: " << std::dec << maxSize << ", expected one of: {1048576 .. 1073741824}");
+                    }
+                }
+
+                uint64_t codec = PARQUET_CODEC_UNCOMPRESSED;
+                if (writerJSON.HasMember("compression")) {
+                    const char* compression = OpenLogReplicator::getJSONfieldS(fileName, JSON_PARAMETER_LENGTH, writerJSON, "compression");
+                    if (strcmp(compression, "none") == 0)
+                        codec = PARQUET_CODEC_UNCOMPRESSED;
+                    else if (strcmp(compression, "snappy") == 0) {
+#ifdef LINK_LIBRARY_SNAPPY
+                        codec = PARQUET_CODEC_SNAPPY;
+#else
+                        CONFIG_FAIL("bad JSON, \"compression\" value: snappy is not compiled");
+#endif /* LINK_LIBRARY_SNAPPY */
+                    } else if (strcmp(compression, "zstd") == 0) {
+#ifdef LINK_LIBRARY_ZSTD
+                        codec = PARQUET_CODEC_ZSTD;
+#else
+                        CONFIG_FAIL("bad JSON, \"compression\" value: zstd is not compiled");
+#endif /* LINK_LIBRARY_ZSTD */
+                    } else {
+                        CONFIG_FAIL("bad JSON, invalid \"compression\" value: " << compression << ", expected one of: {\"none\", \"snappy\", \"zstd\"}");
+                    }
+                }
+
+                writer = new OpenLogReplicator::WriterParquet(alias, oracleAnalyzer, pollIntervalUs, checkpointIntervalS, queueSize, startScn,
+                        startSequence, startTime, startTimeRel, output, maxSize, codec);
+                if (writer == nullptr) {
+                    RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(OpenLogReplicator::WriterParquet) << " bytes memory (for: parquet writer)");
+                }
             } else if (strcmp(writerType, "kafka") == 0) {
 #ifdef LINK_LIBRARY_RDKAFKA
                 uint64_t maxMessageMb = 100;
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3017000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3017003 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -43,15 +42,7 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_OraProtoBuf_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[7]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_OraProtoBuf_2eproto;
 namespace OpenLogReplicator {
@@ -59,6 +50,9 @@ namespace pb {
 class Column;
 struct ColumnDefaultTypeInternal;
 extern ColumnDefaultTypeInternal _Column_default_instance_;
+class Decimal;
+struct DecimalDefaultTypeInternal;
+extern DecimalDefaultTypeInternal _Decimal_default_instance_;
 class Payload;
 struct PayloadDefaultTypeInternal;
 extern PayloadDefaultTypeInternal _Payload_default_instance_;
@@ -81,6 +75,7 @@ extern ValueDefaultTypeInternal _Value_default_instance_;
 }  // namespace OpenLogReplicator
 PROTOBUF_NAMESPACE_OPEN
 template<> ::OpenLogReplicator::pb::Column* Arena::CreateMaybeMessage<::OpenLogReplicator::pb::Column>(Arena*);
+template<> ::OpenLogReplicator::pb::Decimal* Arena::CreateMaybeMessage<::OpenLogReplicator::pb::Decimal>(Arena*);
 template<> ::OpenLogReplicator::pb::Payload* Arena::CreateMaybeMessage<::OpenLogReplicator::pb::Payload>(Arena*);
 template<> ::OpenLogReplicator::pb::RedoRequest* Arena::CreateMaybeMessage<::OpenLogReplicator::pb::RedoRequest>(Arena*);
 template<> ::OpenLogReplicator::pb::RedoResponse* Arena::CreateMaybeMessage<::OpenLogReplicator::pb::RedoResponse>(Arena*);
@@ -99,12 +94,14 @@ enum Op : int {
   DELETE = 4,
   DDL = 5,
   CHKPT = 6,
-  Op_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  Op_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  ROLLBACK = 7,
+  UNDO = 8,
+  Op_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Op_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Op_IsValid(int value);
 constexpr Op Op_MIN = BEGIN;
-constexpr Op Op_MAX = CHKPT;
+constexpr Op Op_MAX = UNDO;
 constexpr int Op_ARRAYSIZE = Op_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Op_descriptor();
@@ -141,8 +138,8 @@ enum ColumnType : int {
   INTERVAL_DAY_TO_SECOND = 16,
   UROWID = 17,
   TIMESTAMP_WITH_LOCAL_TZ = 18,
-  ColumnType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  ColumnType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  ColumnType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ColumnType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool ColumnType_IsValid(int value);
 constexpr ColumnType ColumnType_MIN = UNKNOWN;
@@ -168,8 +165,8 @@ enum RequestCode : int {
   START = 1,
   REDO = 2,
   CONFIRM = 3,
-  RequestCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  RequestCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  RequestCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RequestCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool RequestCode_IsValid(int value);
 constexpr RequestCode RequestCode_MIN = INFO;
@@ -199,8 +196,8 @@ enum ResponseCode : int {
   PAYLOAD = 5,
   INVALID_DATABASE = 6,
   INVALID_COMMAND = 7,
-  ResponseCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  ResponseCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  ResponseCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ResponseCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool ResponseCode_IsValid(int value);
 constexpr ResponseCode ResponseCode_MIN = READY;
@@ -223,12 +220,171 @@ inline bool ResponseCode_Parse(
 }
 // ===================================================================
 
+class Decimal final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:OpenLogReplicator.pb.Decimal) */ {
+ public:
+  inline Decimal() : Decimal(nullptr) {}
+  ~Decimal() override;
+  explicit PROTOBUF_CONSTEXPR Decimal(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Decimal(const Decimal& from);
+  Decimal(Decimal&& from) noexcept
+    : Decimal() {
+    *this = ::std::move(from);
+  }
+
+  inline Decimal& operator=(const Decimal& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Decimal& operator=(Decimal&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Decimal& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Decimal* internal_default_instance() {
+    return reinterpret_cast<const Decimal*>(
+               &_Decimal_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Decimal& a, Decimal& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Decimal* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Decimal* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Decimal* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Decimal>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Decimal& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Decimal& from) {
+    Decimal::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Decimal* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "OpenLogReplicator.pb.Decimal";
+  }
+  protected:
+  explicit Decimal(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUnscaledFieldNumber = 1,
+    kScaleFieldNumber = 2,
+  };
+  // int64 unscaled = 1;
+  void clear_unscaled();
+  int64_t unscaled() const;
+  void set_unscaled(int64_t value);
+  private:
+  int64_t _internal_unscaled() const;
+  void _internal_set_unscaled(int64_t value);
+  public:
+
+  // uint32 scale = 2;
+  void clear_scale();
+  uint32_t scale() const;
+  void set_scale(uint32_t value);
+  private:
+  uint32_t _internal_scale() const;
+  void _internal_set_scale(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:OpenLogReplicator.pb.Decimal)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t unscaled_;
+    uint32_t scale_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_OraProtoBuf_2eproto;
+};
+// -------------------------------------------------------------------
+
 class Value final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:OpenLogReplicator.pb.Value) */ {
  public:
   inline Value() : Value(nullptr) {}
   ~Value() override;
-  explicit constexpr Value(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Value(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Value(const Value& from);
   Value(Value&& from) noexcept
@@ -242,7 +398,11 @@ class Value final :
   }
   inline Value& operator=(Value&& from) noexcept {
     if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -268,6 +428,7 @@ class Value final :
     kValueDouble = 4,
     kValueString = 5,
     kValueBytes = 6,
+    kValueDecimal = 7,
     DATUM_NOT_SET = 0,
   };
 
@@ -276,14 +437,19 @@ class Value final :
                &_Value_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    1;
 
   friend void swap(Value& a, Value& b) {
     a.Swap(&b);
   }
   inline void Swap(Value* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -297,34 +463,34 @@ class Value final :
 
   // implements Message ----------------------------------------------
 
-  inline Value* New() const final {
-    return new Value();
-  }
-
-  Value* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Value* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Value>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Value& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Value& from);
+  void MergeFrom( const Value& from) {
+    Value::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message*to, const ::PROTOBUF_NAMESPACE_ID::Message&from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Value* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "OpenLogReplicator.pb.Value";
@@ -332,9 +498,6 @@ class Value final :
   protected:
   explicit Value(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -353,6 +516,7 @@ class Value final :
     kValueDoubleFieldNumber = 4,
     kValueStringFieldNumber = 5,
     kValueBytesFieldNumber = 6,
+    kValueDecimalFieldNumber = 7,
   };
   // string name = 1;
   void clear_name();
@@ -360,7 +524,7 @@ class Value final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  PROTOBUF_MUST_USE_RESULT std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
@@ -374,11 +538,11 @@ class Value final :
   bool _internal_has_value_int() const;
   public:
   void clear_value_int();
-  ::PROTOBUF_NAMESPACE_ID::int64 value_int() const;
-  void set_value_int(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t value_int() const;
+  void set_value_int(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_value_int() const;
-  void _internal_set_value_int(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_value_int() const;
+  void _internal_set_value_int(int64_t value);
   public:
 
   // float value_float = 3;
@@ -417,7 +581,7 @@ class Value final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_value_string(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value_string();
-  PROTOBUF_MUST_USE_RESULT std::string* release_value_string();
+  PROTOBUF_NODISCARD std::string* release_value_string();
   void set_allocated_value_string(std::string* value_string);
   private:
   const std::string& _internal_value_string() const;
@@ -435,7 +599,7 @@ class Value final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_value_bytes(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value_bytes();
-  PROTOBUF_MUST_USE_RESULT std::string* release_value_bytes();
+  PROTOBUF_NODISCARD std::string* release_value_bytes();
   void set_allocated_value_bytes(std::string* value_bytes);
   private:
   const std::string& _internal_value_bytes() const;
@@ -443,6 +607,24 @@ class Value final :
   std::string* _internal_mutable_value_bytes();
   public:
 
+  // .OpenLogReplicator.pb.Decimal value_decimal = 7;
+  bool has_value_decimal() const;
+  private:
+  bool _internal_has_value_decimal() const;
+  public:
+  void clear_value_decimal();
+  const ::OpenLogReplicator::pb::Decimal& value_decimal() const;
+  PROTOBUF_NODISCARD ::OpenLogReplicator::pb::Decimal* release_value_decimal();
+  ::OpenLogReplicator::pb::Decimal* mutable_value_decimal();
+  void set_allocated_value_decimal(::OpenLogReplicator::pb::Decimal* value_decimal);
+  private:
+  const ::OpenLogReplicator::pb::Decimal& _internal_value_decimal() const;
+  ::OpenLogReplicator::pb::Decimal* _internal_mutable_value_decimal();
+  public:
+  void unsafe_arena_set_allocated_value_decimal(
+      ::OpenLogReplicator::pb::Decimal* value_decimal);
+  ::OpenLogReplicator::pb::Decimal* unsafe_arena_release_value_decimal();
+
   void clear_datum();
   DatumCase datum_case() const;
   // @@protoc_insertion_point(class_scope:OpenLogReplicator.pb.Value)
@@ -453,6 +635,7 @@ class Value final :
   void set_has_value_double();
   void set_has_value_string();
   void set_has_value_bytes();
+  void set_has_value_decimal();
 
   inline bool has_datum() const;
   inline void clear_has_datum();
@@ -460,19 +643,23 @@ class Value final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  union DatumUnion {
-    constexpr DatumUnion() : _constinit_{} {}
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-    ::PROTOBUF_NAMESPACE_ID::int64 value_int_;
-    float value_float_;
-    double value_double_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_string_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_bytes_;
-  } datum_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    union DatumUnion {
+      constexpr DatumUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      int64_t value_int_;
+      float value_float_;
+      double value_double_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_string_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_bytes_;
+      ::OpenLogReplicator::pb::Decimal* value_decimal_;
+    } datum_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_OraProtoBuf_2eproto;
 };
 // -------------------------------------------------------------------
@@ -482,7 +669,7 @@ class Column final :
  public:
   inline Column() : Column(nullptr) {}
   ~Column() override;
-  explicit constexpr Column(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Column(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Column(const Column& from);
   Column(Column&& from) noexcept
@@ -496,7 +683,11 @@ class Column final :
   }
   inline Column& operator=(Column&& from) noexcept {
     if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -521,14 +712,19 @@ class Column final :
                &_Column_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
   friend void swap(Column& a, Column& b) {
     a.Swap(&b);
   }
   inline void Swap(Column* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -542,34 +738,34 @@ class Column final :
 
   // implements Message ----------------------------------------------
 
-  inline Column* New() const final {
-    return new Column();
-  }
-
-  Column* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Column* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Column>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Column& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Column& from);
+  void MergeFrom( const Column& from) {
+    Column::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message*to, const ::PROTOBUF_NAMESPACE_ID::Message&from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Column* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "OpenLogReplicator.pb.Column";
@@ -577,9 +773,6 @@ class Column final :
   protected:
   explicit Column(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -605,7 +798,7 @@ class Column final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  PROTOBUF_MUST_USE_RESULT std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
@@ -624,29 +817,29 @@ class Column final :
 
   // int32 length = 3;
   void clear_length();
-  ::PROTOBUF_NAMESPACE_ID::int32 length() const;
-  void set_length(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t length() const;
+  void set_length(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_length() const;
-  void _internal_set_length(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_length() const;
+  void _internal_set_length(int32_t value);
   public:
 
   // int32 precision = 4;
   void clear_precision();
-  ::PROTOBUF_NAMESPACE_ID::int32 precision() const;
-  void set_precision(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t precision() const;
+  void set_precision(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_precision() const;
-  void _internal_set_precision(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_precision() const;
+  void _internal_set_precision(int32_t value);
   public:
 
   // int32 scale = 5;
   void clear_scale();
-  ::PROTOBUF_NAMESPACE_ID::int32 scale() const;
-  void set_scale(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t scale() const;
+  void set_scale(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_scale() const;
-  void _internal_set_scale(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_scale() const;
+  void _internal_set_scale(int32_t value);
   public:
 
   // bool nullable = 6;
@@ -665,13 +858,16 @@ class Column final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  int type_;
-  ::PROTOBUF_NAMESPACE_ID::int32 length_;
-  ::PROTOBUF_NAMESPACE_ID::int32 precision_;
-  ::PROTOBUF_NAMESPACE_ID::int32 scale_;
-  bool nullable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int type_;
+    int32_t length_;
+    int32_t precision_;
+    int32_t scale_;
+    bool nullable_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_OraProtoBuf_2eproto;
 };
 // -------------------------------------------------------------------
@@ -681,7 +877,7 @@ class Schema final :
  public:
   inline Schema() : Schema(nullptr) {}
   ~Schema() override;
-  explicit constexpr Schema(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Schema(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Schema(const Schema& from);
   Schema(Schema&& from) noexcept
@@ -695,7 +891,11 @@ class Schema final :
   }
   inline Schema& operator=(Schema&& from) noexcept {
     if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -726,14 +926,19 @@ class Schema final :
                &_Schema_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(Schema& a, Schema& b) {
     a.Swap(&b);
   }
   inline void Swap(Schema* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -747,34 +952,34 @@ class Schema final :
 
   // implements Message ----------------------------------------------
 
-  inline Schema* New() const final {
-    return new Schema();
-  }
-
-  Schema* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Schema* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Schema>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Schema& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Schema& from);
+  void MergeFrom( const Schema& from) {
+    Schema::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message*to, const ::PROTOBUF_NAMESPACE_ID::Message&from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Schema* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "OpenLogReplicator.pb.Schema";
@@ -782,9 +987,6 @@ class Schema final :
   protected:
   explicit Schema(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -828,7 +1030,7 @@ class Schema final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_owner(ArgT0&& arg0, ArgT... args);
   std::string* mutable_owner();
-  PROTOBUF_MUST_USE_RESULT std::string* release_owner();
+  PROTOBUF_NODISCARD std::string* release_owner();
   void set_allocated_owner(std::string* owner);
   private:
   const std::string& _internal_owner() const;
@@ -842,7 +1044,7 @@ class Schema final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  PROTOBUF_MUST_USE_RESULT std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
@@ -852,11 +1054,11 @@ class Schema final :
 
   // uint32 obj = 3;
   void clear_obj();
-  ::PROTOBUF_NAMESPACE_ID::uint32 obj() const;
-  void set_obj(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t obj() const;
+  void set_obj(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_obj() const;
-  void _internal_set_obj(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_obj() const;
+  void _internal_set_obj(uint32_t value);
   public:
 
   // uint64 tm = 4;
@@ -865,11 +1067,11 @@ class Schema final :
   bool _internal_has_tm() const;
   public:
   void clear_tm();
-  ::PROTOBUF_NAMESPACE_ID::uint64 tm() const;
-  void set_tm(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t tm() const;
+  void set_tm(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_tm() const;
-  void _internal_set_tm(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_tm() const;
+  void _internal_set_tm(uint64_t value);
   public:
 
   // string tms = 5;
@@ -882,7 +1084,7 @@ class Schema final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_tms(ArgT0&& arg0, ArgT... args);
   std::string* mutable_tms();
-  PROTOBUF_MUST_USE_RESULT std::string* release_tms();
+  PROTOBUF_NODISCARD std::string* release_tms();
   void set_allocated_tms(std::string* tms);
   private:
   const std::string& _internal_tms() const;
@@ -904,19 +1106,22 @@ class Schema final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Column > column_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr owner_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 obj_;
-  union TmValUnion {
-    constexpr TmValUnion() : _constinit_{} {}
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-    ::PROTOBUF_NAMESPACE_ID::uint64 tm_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tms_;
-  } tm_val_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Column > column_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr owner_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t obj_;
+    union TmValUnion {
+      constexpr TmValUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      uint64_t tm_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tms_;
+    } tm_val_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_OraProtoBuf_2eproto;
 };
 // -------------------------------------------------------------------
@@ -926,7 +1131,7 @@ class Payload final :
  public:
   inline Payload() : Payload(nullptr) {}
   ~Payload() override;
-  explicit constexpr Payload(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Payload(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Payload(const Payload& from);
   Payload(Payload&& from) noexcept
@@ -940,7 +1145,11 @@ class Payload final :
   }
   inline Payload& operator=(Payload&& from) noexcept {
     if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -965,14 +1174,19 @@ class Payload final :
                &_Payload_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(Payload& a, Payload& b) {
     a.Swap(&b);
   }
   inline void Swap(Payload* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -986,34 +1200,34 @@ class Payload final :
 
   // implements Message ----------------------------------------------
 
-  inline Payload* New() const final {
-    return new Payload();
-  }
-
-  Payload* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Payload* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Payload>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Payload& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Payload& from);
+  void MergeFrom( const Payload& from) {
+    Payload::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message*to, const ::PROTOBUF_NAMESPACE_ID::Message&from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Payload* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "OpenLogReplicator.pb.Payload";
@@ -1021,9 +1235,6 @@ class Payload final :
   protected:
   explicit Payload(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1089,7 +1300,7 @@ class Payload final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_rid(ArgT0&& arg0, ArgT... args);
   std::string* mutable_rid();
-  PROTOBUF_MUST_USE_RESULT std::string* release_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
   void set_allocated_rid(std::string* rid);
   private:
   const std::string& _internal_rid() const;
@@ -1103,7 +1314,7 @@ class Payload final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_ddl(ArgT0&& arg0, ArgT... args);
   std::string* mutable_ddl();
-  PROTOBUF_MUST_USE_RESULT std::string* release_ddl();
+  PROTOBUF_NODISCARD std::string* release_ddl();
   void set_allocated_ddl(std::string* ddl);
   private:
   const std::string& _internal_ddl() const;
@@ -1118,7 +1329,7 @@ class Payload final :
   public:
   void clear_schema();
   const ::OpenLogReplicator::pb::Schema& schema() const;
-  PROTOBUF_MUST_USE_RESULT ::OpenLogReplicator::pb::Schema* release_schema();
+  PROTOBUF_NODISCARD ::OpenLogReplicator::pb::Schema* release_schema();
   ::OpenLogReplicator::pb::Schema* mutable_schema();
   void set_allocated_schema(::OpenLogReplicator::pb::Schema* schema);
   private:
@@ -1140,20 +1351,20 @@ class Payload final :
 
   // uint32 seq = 7;
   void clear_seq();
-  ::PROTOBUF_NAMESPACE_ID::uint32 seq() const;
-  void set_seq(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t seq() const;
+  void set_seq(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_seq() const;
-  void _internal_set_seq(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_seq() const;
+  void _internal_set_seq(uint32_t value);
   public:
 
   // uint64 offset = 8;
   void clear_offset();
-  ::PROTOBUF_NAMESPACE_ID::uint64 offset() const;
-  void set_offset(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_offset() const;
-  void _internal_set_offset(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
   public:
 
   // optional uint64 num = 10;
@@ -1162,11 +1373,11 @@ class Payload final :
   bool _internal_has_num() const;
   public:
   void clear_num();
-  ::PROTOBUF_NAMESPACE_ID::uint64 num() const;
-  void set_num(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t num() const;
+  void set_num(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_num() const;
-  void _internal_set_num(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_num() const;
+  void _internal_set_num(uint64_t value);
   public:
 
   // bool redo = 9;
@@ -1185,18 +1396,21 @@ class Payload final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Value > before_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Value > after_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ddl_;
-  ::OpenLogReplicator::pb::Schema* schema_;
-  int op_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 seq_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 offset_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 num_;
-  bool redo_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Value > before_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Value > after_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ddl_;
+    ::OpenLogReplicator::pb::Schema* schema_;
+    int op_;
+    uint32_t seq_;
+    uint64_t offset_;
+    uint64_t num_;
+    bool redo_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_OraProtoBuf_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1206,7 +1420,7 @@ class SchemaRequest final :
  public:
   inline SchemaRequest() : SchemaRequest(nullptr) {}
   ~SchemaRequest() override;
-  explicit constexpr SchemaRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR SchemaRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SchemaRequest(const SchemaRequest& from);
   SchemaRequest(SchemaRequest&& from) noexcept
@@ -1220,7 +1434,11 @@ class SchemaRequest final :
   }
   inline SchemaRequest& operator=(SchemaRequest&& from) noexcept {
     if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -1245,14 +1463,19 @@ class SchemaRequest final :
                &_SchemaRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(SchemaRequest& a, SchemaRequest& b) {
     a.Swap(&b);
   }
   inline void Swap(SchemaRequest* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1266,34 +1489,34 @@ class SchemaRequest final :
 
   // implements Message ----------------------------------------------
 
-  inline SchemaRequest* New() const final {
-    return new SchemaRequest();
-  }
-
-  SchemaRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SchemaRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SchemaRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SchemaRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const SchemaRequest& from);
+  void MergeFrom( const SchemaRequest& from) {
+    SchemaRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message*to, const ::PROTOBUF_NAMESPACE_ID::Message&from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SchemaRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "OpenLogReplicator.pb.SchemaRequest";
@@ -1301,9 +1524,6 @@ class SchemaRequest final :
   protected:
   explicit SchemaRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1325,7 +1545,7 @@ class SchemaRequest final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_mask(ArgT0&& arg0, ArgT... args);
   std::string* mutable_mask();
-  PROTOBUF_MUST_USE_RESULT std::string* release_mask();
+  PROTOBUF_NODISCARD std::string* release_mask();
   void set_allocated_mask(std::string* mask);
   private:
   const std::string& _internal_mask() const;
@@ -1339,7 +1559,7 @@ class SchemaRequest final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_filter(ArgT0&& arg0, ArgT... args);
   std::string* mutable_filter();
-  PROTOBUF_MUST_USE_RESULT std::string* release_filter();
+  PROTOBUF_NODISCARD std::string* release_filter();
   void set_allocated_filter(std::string* filter);
   private:
   const std::string& _internal_filter() const;
@@ -1354,9 +1574,12 @@ class SchemaRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mask_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mask_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_OraProtoBuf_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1366,7 +1589,7 @@ class RedoRequest final :
  public:
   inline RedoRequest() : RedoRequest(nullptr) {}
   ~RedoRequest() override;
-  explicit constexpr RedoRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR RedoRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RedoRequest(const RedoRequest& from);
   RedoRequest(RedoRequest&& from) noexcept
@@ -1380,7 +1603,11 @@ class RedoRequest final :
   }
   inline RedoRequest& operator=(RedoRequest&& from) noexcept {
     if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -1412,14 +1639,19 @@ class RedoRequest final :
                &_RedoRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
   friend void swap(RedoRequest& a, RedoRequest& b) {
     a.Swap(&b);
   }
   inline void Swap(RedoRequest* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1433,34 +1665,34 @@ class RedoRequest final :
 
   // implements Message ----------------------------------------------
 
-  inline RedoRequest* New() const final {
-    return new RedoRequest();
-  }
-
-  RedoRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RedoRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RedoRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RedoRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const RedoRequest& from);
+  void MergeFrom( const RedoRequest& from) {
+    RedoRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message*to, const ::PROTOBUF_NAMESPACE_ID::Message&from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RedoRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "OpenLogReplicator.pb.RedoRequest";
@@ -1468,9 +1700,6 @@ class RedoRequest final :
   protected:
   explicit RedoRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1485,8 +1714,8 @@ class RedoRequest final :
   enum : int {
     kSchemaFieldNumber = 7,
     kDatabaseNameFieldNumber = 2,
-    kCodeFieldNumber = 1,
     kSeqFieldNumber = 6,
+    kCodeFieldNumber = 1,
     kScnFieldNumber = 3,
     kTmsFieldNumber = 4,
     kTmRelFieldNumber = 5,
@@ -1515,7 +1744,7 @@ class RedoRequest final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_database_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_database_name();
-  PROTOBUF_MUST_USE_RESULT std::string* release_database_name();
+  PROTOBUF_NODISCARD std::string* release_database_name();
   void set_allocated_database_name(std::string* database_name);
   private:
   const std::string& _internal_database_name() const;
@@ -1523,26 +1752,26 @@ class RedoRequest final :
   std::string* _internal_mutable_database_name();
   public:
 
-  // .OpenLogReplicator.pb.RequestCode code = 1;
-  void clear_code();
-  ::OpenLogReplicator::pb::RequestCode code() const;
-  void set_code(::OpenLogReplicator::pb::RequestCode value);
-  private:
-  ::OpenLogReplicator::pb::RequestCode _internal_code() const;
-  void _internal_set_code(::OpenLogReplicator::pb::RequestCode value);
-  public:
-
   // optional uint64 seq = 6;
   bool has_seq() const;
   private:
   bool _internal_has_seq() const;
   public:
   void clear_seq();
-  ::PROTOBUF_NAMESPACE_ID::uint64 seq() const;
-  void set_seq(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_seq() const;
-  void _internal_set_seq(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
+
+  // .OpenLogReplicator.pb.RequestCode code = 1;
+  void clear_code();
+  ::OpenLogReplicator::pb::RequestCode code() const;
+  void set_code(::OpenLogReplicator::pb::RequestCode value);
+  private:
+  ::OpenLogReplicator::pb::RequestCode _internal_code() const;
+  void _internal_set_code(::OpenLogReplicator::pb::RequestCode value);
   public:
 
   // uint64 scn = 3;
@@ -1551,11 +1780,11 @@ class RedoRequest final :
   bool _internal_has_scn() const;
   public:
   void clear_scn();
-  ::PROTOBUF_NAMESPACE_ID::uint64 scn() const;
-  void set_scn(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t scn() const;
+  void set_scn(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_scn() const;
-  void _internal_set_scn(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_scn() const;
+  void _internal_set_scn(uint64_t value);
   public:
 
   // string tms = 4;
@@ -1568,7 +1797,7 @@ class RedoRequest final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_tms(ArgT0&& arg0, ArgT... args);
   std::string* mutable_tms();
-  PROTOBUF_MUST_USE_RESULT std::string* release_tms();
+  PROTOBUF_NODISCARD std::string* release_tms();
   void set_allocated_tms(std::string* tms);
   private:
   const std::string& _internal_tms() const;
@@ -1582,11 +1811,11 @@ class RedoRequest final :
   bool _internal_has_tm_rel() const;
   public:
   void clear_tm_rel();
-  ::PROTOBUF_NAMESPACE_ID::int64 tm_rel() const;
-  void set_tm_rel(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t tm_rel() const;
+  void set_tm_rel(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_tm_rel() const;
-  void _internal_set_tm_rel(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_tm_rel() const;
+  void _internal_set_tm_rel(int64_t value);
   public:
 
   void clear_tm_val();
@@ -1604,21 +1833,24 @@ class RedoRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::SchemaRequest > schema_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr database_name_;
-  int code_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 seq_;
-  union TmValUnion {
-    constexpr TmValUnion() : _constinit_{} {}
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-    ::PROTOBUF_NAMESPACE_ID::uint64 scn_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tms_;
-    ::PROTOBUF_NAMESPACE_ID::int64 tm_rel_;
-  } tm_val_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::SchemaRequest > schema_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr database_name_;
+    uint64_t seq_;
+    int code_;
+    union TmValUnion {
+      constexpr TmValUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      uint64_t scn_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tms_;
+      int64_t tm_rel_;
+    } tm_val_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_OraProtoBuf_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1628,7 +1860,7 @@ class RedoResponse final :
  public:
   inline RedoResponse() : RedoResponse(nullptr) {}
   ~RedoResponse() override;
-  explicit constexpr RedoResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR RedoResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RedoResponse(const RedoResponse& from);
   RedoResponse(RedoResponse&& from) noexcept
@@ -1642,7 +1874,11 @@ class RedoResponse final :
   }
   inline RedoResponse& operator=(RedoResponse&& from) noexcept {
     if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -1685,14 +1921,19 @@ class RedoResponse final :
                &_RedoResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
   friend void swap(RedoResponse& a, RedoResponse& b) {
     a.Swap(&b);
   }
   inline void Swap(RedoResponse* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1706,34 +1947,34 @@ class RedoResponse final :
 
   // implements Message ----------------------------------------------
 
-  inline RedoResponse* New() const final {
-    return new RedoResponse();
-  }
-
-  RedoResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RedoResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RedoResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RedoResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const RedoResponse& from);
+  void MergeFrom( const RedoResponse& from) {
+    RedoResponse::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message*to, const ::PROTOBUF_NAMESPACE_ID::Message&from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RedoResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "OpenLogReplicator.pb.RedoResponse";
@@ -1741,9 +1982,6 @@ class RedoResponse final :
   protected:
   explicit RedoResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -1758,6 +1996,7 @@ class RedoResponse final :
   enum : int {
     kPayloadFieldNumber = 8,
     kCodeFieldNumber = 1,
+    kProvisionalFieldNumber = 9,
     kScnFieldNumber = 2,
     kScnsFieldNumber = 3,
     kTmFieldNumber = 4,
@@ -1792,17 +2031,26 @@ class RedoResponse final :
   void _internal_set_code(::OpenLogReplicator::pb::ResponseCode value);
   public:
 
+  // bool provisional = 9;
+  void clear_provisional();
+  bool provisional() const;
+  void set_provisional(bool value);
+  private:
+  bool _internal_provisional() const;
+  void _internal_set_provisional(bool value);
+  public:
+
   // uint64 scn = 2;
   bool has_scn() const;
   private:
   bool _internal_has_scn() const;
   public:
   void clear_scn();
-  ::PROTOBUF_NAMESPACE_ID::uint64 scn() const;
-  void set_scn(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t scn() const;
+  void set_scn(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_scn() const;
-  void _internal_set_scn(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_scn() const;
+  void _internal_set_scn(uint64_t value);
   public:
 
   // string scns = 3;
@@ -1815,7 +2063,7 @@ class RedoResponse final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_scns(ArgT0&& arg0, ArgT... args);
   std::string* mutable_scns();
-  PROTOBUF_MUST_USE_RESULT std::string* release_scns();
+  PROTOBUF_NODISCARD std::string* release_scns();
   void set_allocated_scns(std::string* scns);
   private:
   const std::string& _internal_scns() const;
@@ -1829,11 +2077,11 @@ class RedoResponse final :
   bool _internal_has_tm() const;
   public:
   void clear_tm();
-  ::PROTOBUF_NAMESPACE_ID::uint64 tm() const;
-  void set_tm(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t tm() const;
+  void set_tm(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_tm() const;
-  void _internal_set_tm(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_tm() const;
+  void _internal_set_tm(uint64_t value);
   public:
 
   // string tms = 5;
@@ -1846,7 +2094,7 @@ class RedoResponse final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_tms(ArgT0&& arg0, ArgT... args);
   std::string* mutable_tms();
-  PROTOBUF_MUST_USE_RESULT std::string* release_tms();
+  PROTOBUF_NODISCARD std::string* release_tms();
   void set_allocated_tms(std::string* tms);
   private:
   const std::string& _internal_tms() const;
@@ -1864,7 +2112,7 @@ class RedoResponse final :
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_xid(ArgT0&& arg0, ArgT... args);
   std::string* mutable_xid();
-  PROTOBUF_MUST_USE_RESULT std::string* release_xid();
+  PROTOBUF_NODISCARD std::string* release_xid();
   void set_allocated_xid(std::string* xid);
   private:
   const std::string& _internal_xid() const;
@@ -1878,11 +2126,11 @@ class RedoResponse final :
   bool _internal_has_xidn() const;
   public:
   void clear_xidn();
-  ::PROTOBUF_NAMESPACE_ID::uint64 xidn() const;
-  void set_xidn(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t xidn() const;
+  void set_xidn(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_xidn() const;
-  void _internal_set_xidn(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_xidn() const;
+  void _internal_set_xidn(uint64_t value);
   public:
 
   void clear_scn_val();
@@ -1913,29 +2161,33 @@ class RedoResponse final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Payload > payload_;
-  int code_;
-  union ScnValUnion {
-    constexpr ScnValUnion() : _constinit_{} {}
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-    ::PROTOBUF_NAMESPACE_ID::uint64 scn_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scns_;
-  } scn_val_;
-  union TmValUnion {
-    constexpr TmValUnion() : _constinit_{} {}
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-    ::PROTOBUF_NAMESPACE_ID::uint64 tm_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tms_;
-  } tm_val_;
-  union XidValUnion {
-    constexpr XidValUnion() : _constinit_{} {}
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr xid_;
-    ::PROTOBUF_NAMESPACE_ID::uint64 xidn_;
-  } xid_val_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[3];
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Payload > payload_;
+    int code_;
+    bool provisional_;
+    union ScnValUnion {
+      constexpr ScnValUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      uint64_t scn_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scns_;
+    } scn_val_;
+    union TmValUnion {
+      constexpr TmValUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      uint64_t tm_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tms_;
+    } tm_val_;
+    union XidValUnion {
+      constexpr XidValUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr xid_;
+      uint64_t xidn_;
+    } xid_val_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[3];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_OraProtoBuf_2eproto;
 };
 // ===================================================================
@@ -1947,11 +2199,55 @@ class RedoResponse final :
   #pragma GCC diagnostic push
   #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif  // __GNUC__
+// Decimal
+
+// int64 unscaled = 1;
+inline void Decimal::clear_unscaled() {
+  _impl_.unscaled_ = int64_t{0};
+}
+inline int64_t Decimal::_internal_unscaled() const {
+  return _impl_.unscaled_;
+}
+inline int64_t Decimal::unscaled() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Decimal.unscaled)
+  return _internal_unscaled();
+}
+inline void Decimal::_internal_set_unscaled(int64_t value) {
+  
+  _impl_.unscaled_ = value;
+}
+inline void Decimal::set_unscaled(int64_t value) {
+  _internal_set_unscaled(value);
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Decimal.unscaled)
+}
+
+// uint32 scale = 2;
+inline void Decimal::clear_scale() {
+  _impl_.scale_ = 0u;
+}
+inline uint32_t Decimal::_internal_scale() const {
+  return _impl_.scale_;
+}
+inline uint32_t Decimal::scale() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Decimal.scale)
+  return _internal_scale();
+}
+inline void Decimal::_internal_set_scale(uint32_t value) {
+  
+  _impl_.scale_ = value;
+}
+inline void Decimal::set_scale(uint32_t value) {
+  _internal_set_scale(value);
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Decimal.scale)
+}
+
+// -------------------------------------------------------------------
+
 // Value
 
 // string name = 1;
 inline void Value::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& Value::name() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Value.name)
@@ -1961,7 +2257,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Value::set_name(ArgT0&& arg0, ArgT... args) {
  
- name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Value.name)
 }
 inline std::string* Value::mutable_name() {
@@ -1970,19 +2266,19 @@ inline std::string* Value::mutable_name() {
   return _s;
 }
 inline const std::string& Value::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void Value::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Value::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Value::release_name() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Value.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.name_.Release();
 }
 inline void Value::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -1990,8 +2286,12 @@ inline void Value::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Value.name)
 }
 
@@ -2003,32 +2303,32 @@ inline bool Value::has_value_int() const {
   return _internal_has_value_int();
 }
 inline void Value::set_has_value_int() {
-  _oneof_case_[0] = kValueInt;
+  _impl_._oneof_case_[0] = kValueInt;
 }
 inline void Value::clear_value_int() {
   if (_internal_has_value_int()) {
-    datum_.value_int_ = int64_t{0};
+    _impl_.datum_.value_int_ = int64_t{0};
     clear_has_datum();
   }
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 Value::_internal_value_int() const {
+inline int64_t Value::_internal_value_int() const {
   if (_internal_has_value_int()) {
-    return datum_.value_int_;
+    return _impl_.datum_.value_int_;
   }
   return int64_t{0};
 }
-inline void Value::_internal_set_value_int(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void Value::_internal_set_value_int(int64_t value) {
   if (!_internal_has_value_int()) {
     clear_datum();
     set_has_value_int();
   }
-  datum_.value_int_ = value;
+  _impl_.datum_.value_int_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 Value::value_int() const {
+inline int64_t Value::value_int() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Value.value_int)
   return _internal_value_int();
 }
-inline void Value::set_value_int(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void Value::set_value_int(int64_t value) {
   _internal_set_value_int(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Value.value_int)
 }
@@ -2041,17 +2341,17 @@ inline bool Value::has_value_float() const {
   return _internal_has_value_float();
 }
 inline void Value::set_has_value_float() {
-  _oneof_case_[0] = kValueFloat;
+  _impl_._oneof_case_[0] = kValueFloat;
 }
 inline void Value::clear_value_float() {
   if (_internal_has_value_float()) {
-    datum_.value_float_ = 0;
+    _impl_.datum_.value_float_ = 0;
     clear_has_datum();
   }
 }
 inline float Value::_internal_value_float() const {
   if (_internal_has_value_float()) {
-    return datum_.value_float_;
+    return _impl_.datum_.value_float_;
   }
   return 0;
 }
@@ -2060,7 +2360,7 @@ inline void Value::_internal_set_value_float(float value) {
     clear_datum();
     set_has_value_float();
   }
-  datum_.value_float_ = value;
+  _impl_.datum_.value_float_ = value;
 }
 inline float Value::value_float() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Value.value_float)
@@ -2079,17 +2379,17 @@ inline bool Value::has_value_double() const {
   return _internal_has_value_double();
 }
 inline void Value::set_has_value_double() {
-  _oneof_case_[0] = kValueDouble;
+  _impl_._oneof_case_[0] = kValueDouble;
 }
 inline void Value::clear_value_double() {
   if (_internal_has_value_double()) {
-    datum_.value_double_ = 0;
+    _impl_.datum_.value_double_ = 0;
     clear_has_datum();
   }
 }
 inline double Value::_internal_value_double() const {
   if (_internal_has_value_double()) {
-    return datum_.value_double_;
+    return _impl_.datum_.value_double_;
   }
   return 0;
 }
@@ -2098,7 +2398,7 @@ inline void Value::_internal_set_value_double(double value) {
     clear_datum();
     set_has_value_double();
   }
-  datum_.value_double_ = value;
+  _impl_.datum_.value_double_ = value;
 }
 inline double Value::value_double() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Value.value_double)
@@ -2117,11 +2417,11 @@ inline bool Value::has_value_string() const {
   return _internal_has_value_string();
 }
 inline void Value::set_has_value_string() {
-  _oneof_case_[0] = kValueString;
+  _impl_._oneof_case_[0] = kValueString;
 }
 inline void Value::clear_value_string() {
   if (_internal_has_value_string()) {
-    datum_.value_string_.Destroy(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+    _impl_.datum_.value_string_.Destroy();
     clear_has_datum();
   }
 }
@@ -2134,9 +2434,9 @@ inline void Value::set_value_string(ArgT0&& arg0, ArgT... args) {
   if (!_internal_has_value_string()) {
     clear_datum();
     set_has_value_string();
-    datum_.value_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.datum_.value_string_.InitDefault();
   }
-  datum_.value_string_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  _impl_.datum_.value_string_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Value.value_string)
 }
 inline std::string* Value::mutable_value_string() {
@@ -2146,7 +2446,7 @@ inline std::string* Value::mutable_value_string() {
 }
 inline const std::string& Value::_internal_value_string() const {
   if (_internal_has_value_string()) {
-    return datum_.value_string_.Get();
+    return _impl_.datum_.value_string_.Get();
   }
   return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
@@ -2154,24 +2454,23 @@ inline void Value::_internal_set_value_string(const std::string& value) {
   if (!_internal_has_value_string()) {
     clear_datum();
     set_has_value_string();
-    datum_.value_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.datum_.value_string_.InitDefault();
   }
-  datum_.value_string_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.datum_.value_string_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Value::_internal_mutable_value_string() {
   if (!_internal_has_value_string()) {
     clear_datum();
     set_has_value_string();
-    datum_.value_string_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.datum_.value_string_.InitDefault();
   }
-  return datum_.value_string_.Mutable(
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.datum_.value_string_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* Value::release_value_string() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Value.value_string)
   if (_internal_has_value_string()) {
     clear_has_datum();
-    return datum_.value_string_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+    return _impl_.datum_.value_string_.Release();
   } else {
     return nullptr;
   }
@@ -2182,11 +2481,7 @@ inline void Value::set_allocated_value_string(std::string* value_string) {
   }
   if (value_string != nullptr) {
     set_has_value_string();
-    datum_.value_string_.UnsafeSetDefault(value_string);
-    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArenaForAllocation();
-    if (arena != nullptr) {
-      arena->Own(value_string);
-    }
+    _impl_.datum_.value_string_.InitAllocated(value_string, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Value.value_string)
 }
@@ -2199,11 +2494,11 @@ inline bool Value::has_value_bytes() const {
   return _internal_has_value_bytes();
 }
 inline void Value::set_has_value_bytes() {
-  _oneof_case_[0] = kValueBytes;
+  _impl_._oneof_case_[0] = kValueBytes;
 }
 inline void Value::clear_value_bytes() {
   if (_internal_has_value_bytes()) {
-    datum_.value_bytes_.Destroy(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+    _impl_.datum_.value_bytes_.Destroy();
     clear_has_datum();
   }
 }
@@ -2216,9 +2511,9 @@ inline void Value::set_value_bytes(ArgT0&& arg0, ArgT... args) {
   if (!_internal_has_value_bytes()) {
     clear_datum();
     set_has_value_bytes();
-    datum_.value_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.datum_.value_bytes_.InitDefault();
   }
-  datum_.value_bytes_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  _impl_.datum_.value_bytes_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Value.value_bytes)
 }
 inline std::string* Value::mutable_value_bytes() {
@@ -2228,7 +2523,7 @@ inline std::string* Value::mutable_value_bytes() {
 }
 inline const std::string& Value::_internal_value_bytes() const {
   if (_internal_has_value_bytes()) {
-    return datum_.value_bytes_.Get();
+    return _impl_.datum_.value_bytes_.Get();
   }
   return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
@@ -2236,24 +2531,23 @@ inline void Value::_internal_set_value_bytes(const std::string& value) {
   if (!_internal_has_value_bytes()) {
     clear_datum();
     set_has_value_bytes();
-    datum_.value_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.datum_.value_bytes_.InitDefault();
   }
-  datum_.value_bytes_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.datum_.value_bytes_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Value::_internal_mutable_value_bytes() {
   if (!_internal_has_value_bytes()) {
     clear_datum();
     set_has_value_bytes();
-    datum_.value_bytes_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.datum_.value_bytes_.InitDefault();
   }
-  return datum_.value_bytes_.Mutable(
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.datum_.value_bytes_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* Value::release_value_bytes() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Value.value_bytes)
   if (_internal_has_value_bytes()) {
     clear_has_datum();
-    return datum_.value_bytes_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+    return _impl_.datum_.value_bytes_.Release();
   } else {
     return nullptr;
   }
@@ -2264,23 +2558,93 @@ inline void Value::set_allocated_value_bytes(std::string* value_bytes) {
   }
   if (value_bytes != nullptr) {
     set_has_value_bytes();
-    datum_.value_bytes_.UnsafeSetDefault(value_bytes);
-    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArenaForAllocation();
-    if (arena != nullptr) {
-      arena->Own(value_bytes);
-    }
+    _impl_.datum_.value_bytes_.InitAllocated(value_bytes, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Value.value_bytes)
 }
 
+// .OpenLogReplicator.pb.Decimal value_decimal = 7;
+inline bool Value::_internal_has_value_decimal() const {
+  return datum_case() == kValueDecimal;
+}
+inline bool Value::has_value_decimal() const {
+  return _internal_has_value_decimal();
+}
+inline void Value::set_has_value_decimal() {
+  _impl_._oneof_case_[0] = kValueDecimal;
+}
+inline void Value::clear_value_decimal() {
+  if (_internal_has_value_decimal()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.datum_.value_decimal_;
+    }
+    clear_has_datum();
+  }
+}
+inline ::OpenLogReplicator::pb::Decimal* Value::release_value_decimal() {
+  // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Value.value_decimal)
+  if (_internal_has_value_decimal()) {
+    clear_has_datum();
+    ::OpenLogReplicator::pb::Decimal* temp = _impl_.datum_.value_decimal_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.datum_.value_decimal_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::OpenLogReplicator::pb::Decimal& Value::_internal_value_decimal() const {
+  return _internal_has_value_decimal()
+      ? *_impl_.datum_.value_decimal_
+      : reinterpret_cast< ::OpenLogReplicator::pb::Decimal&>(::OpenLogReplicator::pb::_Decimal_default_instance_);
+}
+inline const ::OpenLogReplicator::pb::Decimal& Value::value_decimal() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Value.value_decimal)
+  return _internal_value_decimal();
+}
+inline ::OpenLogReplicator::pb::Decimal* Value::unsafe_arena_release_value_decimal() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:OpenLogReplicator.pb.Value.value_decimal)
+  if (_internal_has_value_decimal()) {
+    clear_has_datum();
+    ::OpenLogReplicator::pb::Decimal* temp = _impl_.datum_.value_decimal_;
+    _impl_.datum_.value_decimal_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Value::unsafe_arena_set_allocated_value_decimal(::OpenLogReplicator::pb::Decimal* value_decimal) {
+  clear_datum();
+  if (value_decimal) {
+    set_has_value_decimal();
+    _impl_.datum_.value_decimal_ = value_decimal;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:OpenLogReplicator.pb.Value.value_decimal)
+}
+inline ::OpenLogReplicator::pb::Decimal* Value::_internal_mutable_value_decimal() {
+  if (!_internal_has_value_decimal()) {
+    clear_datum();
+    set_has_value_decimal();
+    _impl_.datum_.value_decimal_ = CreateMaybeMessage< ::OpenLogReplicator::pb::Decimal >(GetArenaForAllocation());
+  }
+  return _impl_.datum_.value_decimal_;
+}
+inline ::OpenLogReplicator::pb::Decimal* Value::mutable_value_decimal() {
+  ::OpenLogReplicator::pb::Decimal* _msg = _internal_mutable_value_decimal();
+  // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.Value.value_decimal)
+  return _msg;
+}
+
 inline bool Value::has_datum() const {
   return datum_case() != DATUM_NOT_SET;
 }
 inline void Value::clear_has_datum() {
-  _oneof_case_[0] = DATUM_NOT_SET;
+  _impl_._oneof_case_[0] = DATUM_NOT_SET;
 }
 inline Value::DatumCase Value::datum_case() const {
-  return Value::DatumCase(_oneof_case_[0]);
+  return Value::DatumCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -2288,7 +2652,7 @@ inline Value::DatumCase Value::datum_case() const {
 
 // string name = 1;
 inline void Column::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& Column::name() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Column.name)
@@ -2298,7 +2662,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Column::set_name(ArgT0&& arg0, ArgT... args) {
  
- name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Column.name)
 }
 inline std::string* Column::mutable_name() {
@@ -2307,19 +2671,19 @@ inline std::string* Column::mutable_name() {
   return _s;
 }
 inline const std::string& Column::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void Column::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Column::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Column::release_name() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Column.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.name_.Release();
 }
 inline void Column::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -2327,17 +2691,21 @@ inline void Column::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Column.name)
 }
 
 // .OpenLogReplicator.pb.ColumnType type = 2;
 inline void Column::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
 }
 inline ::OpenLogReplicator::pb::ColumnType Column::_internal_type() const {
-  return static_cast< ::OpenLogReplicator::pb::ColumnType >(type_);
+  return static_cast< ::OpenLogReplicator::pb::ColumnType >(_impl_.type_);
 }
 inline ::OpenLogReplicator::pb::ColumnType Column::type() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Column.type)
@@ -2345,7 +2713,7 @@ inline ::OpenLogReplicator::pb::ColumnType Column::type() const {
 }
 inline void Column::_internal_set_type(::OpenLogReplicator::pb::ColumnType value) {
   
-  type_ = value;
+  _impl_.type_ = value;
 }
 inline void Column::set_type(::OpenLogReplicator::pb::ColumnType value) {
   _internal_set_type(value);
@@ -2354,70 +2722,70 @@ inline void Column::set_type(::OpenLogReplicator::pb::ColumnType value) {
 
 // int32 length = 3;
 inline void Column::clear_length() {
-  length_ = 0;
+  _impl_.length_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Column::_internal_length() const {
-  return length_;
+inline int32_t Column::_internal_length() const {
+  return _impl_.length_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Column::length() const {
+inline int32_t Column::length() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Column.length)
   return _internal_length();
 }
-inline void Column::_internal_set_length(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Column::_internal_set_length(int32_t value) {
   
-  length_ = value;
+  _impl_.length_ = value;
 }
-inline void Column::set_length(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Column::set_length(int32_t value) {
   _internal_set_length(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Column.length)
 }
 
 // int32 precision = 4;
 inline void Column::clear_precision() {
-  precision_ = 0;
+  _impl_.precision_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Column::_internal_precision() const {
-  return precision_;
+inline int32_t Column::_internal_precision() const {
+  return _impl_.precision_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Column::precision() const {
+inline int32_t Column::precision() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Column.precision)
   return _internal_precision();
 }
-inline void Column::_internal_set_precision(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Column::_internal_set_precision(int32_t value) {
   
-  precision_ = value;
+  _impl_.precision_ = value;
 }
-inline void Column::set_precision(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Column::set_precision(int32_t value) {
   _internal_set_precision(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Column.precision)
 }
 
 // int32 scale = 5;
 inline void Column::clear_scale() {
-  scale_ = 0;
+  _impl_.scale_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Column::_internal_scale() const {
-  return scale_;
+inline int32_t Column::_internal_scale() const {
+  return _impl_.scale_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Column::scale() const {
+inline int32_t Column::scale() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Column.scale)
   return _internal_scale();
 }
-inline void Column::_internal_set_scale(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Column::_internal_set_scale(int32_t value) {
   
-  scale_ = value;
+  _impl_.scale_ = value;
 }
-inline void Column::set_scale(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Column::set_scale(int32_t value) {
   _internal_set_scale(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Column.scale)
 }
 
 // bool nullable = 6;
 inline void Column::clear_nullable() {
-  nullable_ = false;
+  _impl_.nullable_ = false;
 }
 inline bool Column::_internal_nullable() const {
-  return nullable_;
+  return _impl_.nullable_;
 }
 inline bool Column::nullable() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Column.nullable)
@@ -2425,7 +2793,7 @@ inline bool Column::nullable() const {
 }
 inline void Column::_internal_set_nullable(bool value) {
   
-  nullable_ = value;
+  _impl_.nullable_ = value;
 }
 inline void Column::set_nullable(bool value) {
   _internal_set_nullable(value);
@@ -2438,7 +2806,7 @@ inline void Column::set_nullable(bool value) {
 
 // string owner = 1;
 inline void Schema::clear_owner() {
-  owner_.ClearToEmpty();
+  _impl_.owner_.ClearToEmpty();
 }
 inline const std::string& Schema::owner() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Schema.owner)
@@ -2448,7 +2816,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Schema::set_owner(ArgT0&& arg0, ArgT... args) {
  
- owner_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.owner_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Schema.owner)
 }
 inline std::string* Schema::mutable_owner() {
@@ -2457,19 +2825,19 @@ inline std::string* Schema::mutable_owner() {
   return _s;
 }
 inline const std::string& Schema::_internal_owner() const {
-  return owner_.Get();
+  return _impl_.owner_.Get();
 }
 inline void Schema::_internal_set_owner(const std::string& value) {
   
-  owner_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.owner_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Schema::_internal_mutable_owner() {
   
-  return owner_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.owner_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Schema::release_owner() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Schema.owner)
-  return owner_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.owner_.Release();
 }
 inline void Schema::set_allocated_owner(std::string* owner) {
   if (owner != nullptr) {
@@ -2477,14 +2845,18 @@ inline void Schema::set_allocated_owner(std::string* owner) {
   } else {
     
   }
-  owner_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), owner,
-      GetArenaForAllocation());
+  _impl_.owner_.SetAllocated(owner, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.owner_.IsDefault()) {
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Schema.owner)
 }
 
 // string name = 2;
 inline void Schema::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& Schema::name() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Schema.name)
@@ -2494,7 +2866,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Schema::set_name(ArgT0&& arg0, ArgT... args) {
  
- name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Schema.name)
 }
 inline std::string* Schema::mutable_name() {
@@ -2503,19 +2875,19 @@ inline std::string* Schema::mutable_name() {
   return _s;
 }
 inline const std::string& Schema::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void Schema::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Schema::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Schema::release_name() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Schema.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.name_.Release();
 }
 inline void Schema::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -2523,27 +2895,31 @@ inline void Schema::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Schema.name)
 }
 
 // uint32 obj = 3;
 inline void Schema::clear_obj() {
-  obj_ = 0u;
+  _impl_.obj_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Schema::_internal_obj() const {
-  return obj_;
+inline uint32_t Schema::_internal_obj() const {
+  return _impl_.obj_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Schema::obj() const {
+inline uint32_t Schema::obj() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Schema.obj)
   return _internal_obj();
 }
-inline void Schema::_internal_set_obj(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Schema::_internal_set_obj(uint32_t value) {
   
-  obj_ = value;
+  _impl_.obj_ = value;
 }
-inline void Schema::set_obj(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Schema::set_obj(uint32_t value) {
   _internal_set_obj(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Schema.obj)
 }
@@ -2556,32 +2932,32 @@ inline bool Schema::has_tm() const {
   return _internal_has_tm();
 }
 inline void Schema::set_has_tm() {
-  _oneof_case_[0] = kTm;
+  _impl_._oneof_case_[0] = kTm;
 }
 inline void Schema::clear_tm() {
   if (_internal_has_tm()) {
-    tm_val_.tm_ = uint64_t{0u};
+    _impl_.tm_val_.tm_ = uint64_t{0u};
     clear_has_tm_val();
   }
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Schema::_internal_tm() const {
+inline uint64_t Schema::_internal_tm() const {
   if (_internal_has_tm()) {
-    return tm_val_.tm_;
+    return _impl_.tm_val_.tm_;
   }
   return uint64_t{0u};
 }
-inline void Schema::_internal_set_tm(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void Schema::_internal_set_tm(uint64_t value) {
   if (!_internal_has_tm()) {
     clear_tm_val();
     set_has_tm();
   }
-  tm_val_.tm_ = value;
+  _impl_.tm_val_.tm_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Schema::tm() const {
+inline uint64_t Schema::tm() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Schema.tm)
   return _internal_tm();
 }
-inline void Schema::set_tm(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void Schema::set_tm(uint64_t value) {
   _internal_set_tm(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Schema.tm)
 }
@@ -2594,11 +2970,11 @@ inline bool Schema::has_tms() const {
   return _internal_has_tms();
 }
 inline void Schema::set_has_tms() {
-  _oneof_case_[0] = kTms;
+  _impl_._oneof_case_[0] = kTms;
 }
 inline void Schema::clear_tms() {
   if (_internal_has_tms()) {
-    tm_val_.tms_.Destroy(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+    _impl_.tm_val_.tms_.Destroy();
     clear_has_tm_val();
   }
 }
@@ -2611,9 +2987,9 @@ inline void Schema::set_tms(ArgT0&& arg0, ArgT... args) {
   if (!_internal_has_tms()) {
     clear_tm_val();
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.tm_val_.tms_.InitDefault();
   }
-  tm_val_.tms_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  _impl_.tm_val_.tms_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Schema.tms)
 }
 inline std::string* Schema::mutable_tms() {
@@ -2623,7 +2999,7 @@ inline std::string* Schema::mutable_tms() {
 }
 inline const std::string& Schema::_internal_tms() const {
   if (_internal_has_tms()) {
-    return tm_val_.tms_.Get();
+    return _impl_.tm_val_.tms_.Get();
   }
   return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
@@ -2631,24 +3007,23 @@ inline void Schema::_internal_set_tms(const std::string& value) {
   if (!_internal_has_tms()) {
     clear_tm_val();
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.tm_val_.tms_.InitDefault();
   }
-  tm_val_.tms_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.tm_val_.tms_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Schema::_internal_mutable_tms() {
   if (!_internal_has_tms()) {
     clear_tm_val();
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.tm_val_.tms_.InitDefault();
   }
-  return tm_val_.tms_.Mutable(
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.tm_val_.tms_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* Schema::release_tms() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Schema.tms)
   if (_internal_has_tms()) {
     clear_has_tm_val();
-    return tm_val_.tms_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+    return _impl_.tm_val_.tms_.Release();
   } else {
     return nullptr;
   }
@@ -2659,43 +3034,39 @@ inline void Schema::set_allocated_tms(std::string* tms) {
   }
   if (tms != nullptr) {
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(tms);
-    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArenaForAllocation();
-    if (arena != nullptr) {
-      arena->Own(tms);
-    }
+    _impl_.tm_val_.tms_.InitAllocated(tms, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Schema.tms)
 }
 
 // repeated .OpenLogReplicator.pb.Column column = 6;
 inline int Schema::_internal_column_size() const {
-  return column_.size();
+  return _impl_.column_.size();
 }
 inline int Schema::column_size() const {
   return _internal_column_size();
 }
 inline void Schema::clear_column() {
-  column_.Clear();
+  _impl_.column_.Clear();
 }
 inline ::OpenLogReplicator::pb::Column* Schema::mutable_column(int index) {
   // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.Schema.column)
-  return column_.Mutable(index);
+  return _impl_.column_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Column >*
 Schema::mutable_column() {
   // @@protoc_insertion_point(field_mutable_list:OpenLogReplicator.pb.Schema.column)
-  return &column_;
+  return &_impl_.column_;
 }
 inline const ::OpenLogReplicator::pb::Column& Schema::_internal_column(int index) const {
-  return column_.Get(index);
+  return _impl_.column_.Get(index);
 }
 inline const ::OpenLogReplicator::pb::Column& Schema::column(int index) const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Schema.column)
   return _internal_column(index);
 }
 inline ::OpenLogReplicator::pb::Column* Schema::_internal_add_column() {
-  return column_.Add();
+  return _impl_.column_.Add();
 }
 inline ::OpenLogReplicator::pb::Column* Schema::add_column() {
   ::OpenLogReplicator::pb::Column* _add = _internal_add_column();
@@ -2705,17 +3076,17 @@ inline ::OpenLogReplicator::pb::Column* Schema::add_column() {
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Column >&
 Schema::column() const {
   // @@protoc_insertion_point(field_list:OpenLogReplicator.pb.Schema.column)
-  return column_;
+  return _impl_.column_;
 }
 
 inline bool Schema::has_tm_val() const {
   return tm_val_case() != TM_VAL_NOT_SET;
 }
 inline void Schema::clear_has_tm_val() {
-  _oneof_case_[0] = TM_VAL_NOT_SET;
+  _impl_._oneof_case_[0] = TM_VAL_NOT_SET;
 }
 inline Schema::TmValCase Schema::tm_val_case() const {
-  return Schema::TmValCase(_oneof_case_[0]);
+  return Schema::TmValCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -2723,10 +3094,10 @@ inline Schema::TmValCase Schema::tm_val_case() const {
 
 // .OpenLogReplicator.pb.Op op = 1;
 inline void Payload::clear_op() {
-  op_ = 0;
+  _impl_.op_ = 0;
 }
 inline ::OpenLogReplicator::pb::Op Payload::_internal_op() const {
-  return static_cast< ::OpenLogReplicator::pb::Op >(op_);
+  return static_cast< ::OpenLogReplicator::pb::Op >(_impl_.op_);
 }
 inline ::OpenLogReplicator::pb::Op Payload::op() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Payload.op)
@@ -2734,7 +3105,7 @@ inline ::OpenLogReplicator::pb::Op Payload::op() const {
 }
 inline void Payload::_internal_set_op(::OpenLogReplicator::pb::Op value) {
   
-  op_ = value;
+  _impl_.op_ = value;
 }
 inline void Payload::set_op(::OpenLogReplicator::pb::Op value) {
   _internal_set_op(value);
@@ -2743,19 +3114,19 @@ inline void Payload::set_op(::OpenLogReplicator::pb::Op value) {
 
 // .OpenLogReplicator.pb.Schema schema = 2;
 inline bool Payload::_internal_has_schema() const {
-  return this != internal_default_instance() && schema_ != nullptr;
+  return this != internal_default_instance() && _impl_.schema_ != nullptr;
 }
 inline bool Payload::has_schema() const {
   return _internal_has_schema();
 }
 inline void Payload::clear_schema() {
-  if (GetArenaForAllocation() == nullptr && schema_ != nullptr) {
-    delete schema_;
+  if (GetArenaForAllocation() == nullptr && _impl_.schema_ != nullptr) {
+    delete _impl_.schema_;
   }
-  schema_ = nullptr;
+  _impl_.schema_ = nullptr;
 }
 inline const ::OpenLogReplicator::pb::Schema& Payload::_internal_schema() const {
-  const ::OpenLogReplicator::pb::Schema* p = schema_;
+  const ::OpenLogReplicator::pb::Schema* p = _impl_.schema_;
   return p != nullptr ? *p : reinterpret_cast<const ::OpenLogReplicator::pb::Schema&>(
       ::OpenLogReplicator::pb::_Schema_default_instance_);
 }
@@ -2766,9 +3137,9 @@ inline const ::OpenLogReplicator::pb::Schema& Payload::schema() const {
 inline void Payload::unsafe_arena_set_allocated_schema(
     ::OpenLogReplicator::pb::Schema* schema) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(schema_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.schema_);
   }
-  schema_ = schema;
+  _impl_.schema_ = schema;
   if (schema) {
     
   } else {
@@ -2778,8 +3149,8 @@ inline void Payload::unsafe_arena_set_allocated_schema(
 }
 inline ::OpenLogReplicator::pb::Schema* Payload::release_schema() {
   
-  ::OpenLogReplicator::pb::Schema* temp = schema_;
-  schema_ = nullptr;
+  ::OpenLogReplicator::pb::Schema* temp = _impl_.schema_;
+  _impl_.schema_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -2794,17 +3165,17 @@ inline ::OpenLogReplicator::pb::Schema* Payload::release_schema() {
 inline ::OpenLogReplicator::pb::Schema* Payload::unsafe_arena_release_schema() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Payload.schema)
   
-  ::OpenLogReplicator::pb::Schema* temp = schema_;
-  schema_ = nullptr;
+  ::OpenLogReplicator::pb::Schema* temp = _impl_.schema_;
+  _impl_.schema_ = nullptr;
   return temp;
 }
 inline ::OpenLogReplicator::pb::Schema* Payload::_internal_mutable_schema() {
   
-  if (schema_ == nullptr) {
+  if (_impl_.schema_ == nullptr) {
     auto* p = CreateMaybeMessage<::OpenLogReplicator::pb::Schema>(GetArenaForAllocation());
-    schema_ = p;
+    _impl_.schema_ = p;
   }
-  return schema_;
+  return _impl_.schema_;
 }
 inline ::OpenLogReplicator::pb::Schema* Payload::mutable_schema() {
   ::OpenLogReplicator::pb::Schema* _msg = _internal_mutable_schema();
@@ -2814,11 +3185,11 @@ inline ::OpenLogReplicator::pb::Schema* Payload::mutable_schema() {
 inline void Payload::set_allocated_schema(::OpenLogReplicator::pb::Schema* schema) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete schema_;
+    delete _impl_.schema_;
   }
   if (schema) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::OpenLogReplicator::pb::Schema>::GetOwningArena(schema);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(schema);
     if (message_arena != submessage_arena) {
       schema = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, schema, submessage_arena);
@@ -2827,13 +3198,13 @@ inline void Payload::set_allocated_schema(::OpenLogReplicator::pb::Schema* schem
   } else {
     
   }
-  schema_ = schema;
+  _impl_.schema_ = schema;
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Payload.schema)
 }
 
 // string rid = 3;
 inline void Payload::clear_rid() {
-  rid_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
 }
 inline const std::string& Payload::rid() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Payload.rid)
@@ -2843,7 +3214,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Payload::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Payload.rid)
 }
 inline std::string* Payload::mutable_rid() {
@@ -2852,19 +3223,19 @@ inline std::string* Payload::mutable_rid() {
   return _s;
 }
 inline const std::string& Payload::_internal_rid() const {
-  return rid_.Get();
+  return _impl_.rid_.Get();
 }
 inline void Payload::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Payload::_internal_mutable_rid() {
   
-  return rid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Payload::release_rid() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Payload.rid)
-  return rid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.rid_.Release();
 }
 inline void Payload::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
@@ -2872,39 +3243,43 @@ inline void Payload::set_allocated_rid(std::string* rid) {
   } else {
     
   }
-  rid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), rid,
-      GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Payload.rid)
 }
 
 // repeated .OpenLogReplicator.pb.Value before = 4;
 inline int Payload::_internal_before_size() const {
-  return before_.size();
+  return _impl_.before_.size();
 }
 inline int Payload::before_size() const {
   return _internal_before_size();
 }
 inline void Payload::clear_before() {
-  before_.Clear();
+  _impl_.before_.Clear();
 }
 inline ::OpenLogReplicator::pb::Value* Payload::mutable_before(int index) {
   // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.Payload.before)
-  return before_.Mutable(index);
+  return _impl_.before_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Value >*
 Payload::mutable_before() {
   // @@protoc_insertion_point(field_mutable_list:OpenLogReplicator.pb.Payload.before)
-  return &before_;
+  return &_impl_.before_;
 }
 inline const ::OpenLogReplicator::pb::Value& Payload::_internal_before(int index) const {
-  return before_.Get(index);
+  return _impl_.before_.Get(index);
 }
 inline const ::OpenLogReplicator::pb::Value& Payload::before(int index) const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Payload.before)
   return _internal_before(index);
 }
 inline ::OpenLogReplicator::pb::Value* Payload::_internal_add_before() {
-  return before_.Add();
+  return _impl_.before_.Add();
 }
 inline ::OpenLogReplicator::pb::Value* Payload::add_before() {
   ::OpenLogReplicator::pb::Value* _add = _internal_add_before();
@@ -2914,37 +3289,37 @@ inline ::OpenLogReplicator::pb::Value* Payload::add_before() {
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Value >&
 Payload::before() const {
   // @@protoc_insertion_point(field_list:OpenLogReplicator.pb.Payload.before)
-  return before_;
+  return _impl_.before_;
 }
 
 // repeated .OpenLogReplicator.pb.Value after = 5;
 inline int Payload::_internal_after_size() const {
-  return after_.size();
+  return _impl_.after_.size();
 }
 inline int Payload::after_size() const {
   return _internal_after_size();
 }
 inline void Payload::clear_after() {
-  after_.Clear();
+  _impl_.after_.Clear();
 }
 inline ::OpenLogReplicator::pb::Value* Payload::mutable_after(int index) {
   // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.Payload.after)
-  return after_.Mutable(index);
+  return _impl_.after_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Value >*
 Payload::mutable_after() {
   // @@protoc_insertion_point(field_mutable_list:OpenLogReplicator.pb.Payload.after)
-  return &after_;
+  return &_impl_.after_;
 }
 inline const ::OpenLogReplicator::pb::Value& Payload::_internal_after(int index) const {
-  return after_.Get(index);
+  return _impl_.after_.Get(index);
 }
 inline const ::OpenLogReplicator::pb::Value& Payload::after(int index) const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Payload.after)
   return _internal_after(index);
 }
 inline ::OpenLogReplicator::pb::Value* Payload::_internal_add_after() {
-  return after_.Add();
+  return _impl_.after_.Add();
 }
 inline ::OpenLogReplicator::pb::Value* Payload::add_after() {
   ::OpenLogReplicator::pb::Value* _add = _internal_add_after();
@@ -2954,12 +3329,12 @@ inline ::OpenLogReplicator::pb::Value* Payload::add_after() {
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Value >&
 Payload::after() const {
   // @@protoc_insertion_point(field_list:OpenLogReplicator.pb.Payload.after)
-  return after_;
+  return _impl_.after_;
 }
 
 // string ddl = 6;
 inline void Payload::clear_ddl() {
-  ddl_.ClearToEmpty();
+  _impl_.ddl_.ClearToEmpty();
 }
 inline const std::string& Payload::ddl() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Payload.ddl)
@@ -2969,7 +3344,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Payload::set_ddl(ArgT0&& arg0, ArgT... args) {
  
- ddl_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.ddl_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Payload.ddl)
 }
 inline std::string* Payload::mutable_ddl() {
@@ -2978,19 +3353,19 @@ inline std::string* Payload::mutable_ddl() {
   return _s;
 }
 inline const std::string& Payload::_internal_ddl() const {
-  return ddl_.Get();
+  return _impl_.ddl_.Get();
 }
 inline void Payload::_internal_set_ddl(const std::string& value) {
   
-  ddl_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.ddl_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Payload::_internal_mutable_ddl() {
   
-  return ddl_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.ddl_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Payload::release_ddl() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.Payload.ddl)
-  return ddl_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.ddl_.Release();
 }
 inline void Payload::set_allocated_ddl(std::string* ddl) {
   if (ddl != nullptr) {
@@ -2998,57 +3373,61 @@ inline void Payload::set_allocated_ddl(std::string* ddl) {
   } else {
     
   }
-  ddl_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ddl,
-      GetArenaForAllocation());
+  _impl_.ddl_.SetAllocated(ddl, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ddl_.IsDefault()) {
+    _impl_.ddl_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.Payload.ddl)
 }
 
 // uint32 seq = 7;
 inline void Payload::clear_seq() {
-  seq_ = 0u;
+  _impl_.seq_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Payload::_internal_seq() const {
-  return seq_;
+inline uint32_t Payload::_internal_seq() const {
+  return _impl_.seq_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Payload::seq() const {
+inline uint32_t Payload::seq() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Payload.seq)
   return _internal_seq();
 }
-inline void Payload::_internal_set_seq(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Payload::_internal_set_seq(uint32_t value) {
   
-  seq_ = value;
+  _impl_.seq_ = value;
 }
-inline void Payload::set_seq(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Payload::set_seq(uint32_t value) {
   _internal_set_seq(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Payload.seq)
 }
 
 // uint64 offset = 8;
 inline void Payload::clear_offset() {
-  offset_ = uint64_t{0u};
+  _impl_.offset_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Payload::_internal_offset() const {
-  return offset_;
+inline uint64_t Payload::_internal_offset() const {
+  return _impl_.offset_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Payload::offset() const {
+inline uint64_t Payload::offset() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Payload.offset)
   return _internal_offset();
 }
-inline void Payload::_internal_set_offset(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void Payload::_internal_set_offset(uint64_t value) {
   
-  offset_ = value;
+  _impl_.offset_ = value;
 }
-inline void Payload::set_offset(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void Payload::set_offset(uint64_t value) {
   _internal_set_offset(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Payload.offset)
 }
 
 // bool redo = 9;
 inline void Payload::clear_redo() {
-  redo_ = false;
+  _impl_.redo_ = false;
 }
 inline bool Payload::_internal_redo() const {
-  return redo_;
+  return _impl_.redo_;
 }
 inline bool Payload::redo() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Payload.redo)
@@ -3056,7 +3435,7 @@ inline bool Payload::redo() const {
 }
 inline void Payload::_internal_set_redo(bool value) {
   
-  redo_ = value;
+  _impl_.redo_ = value;
 }
 inline void Payload::set_redo(bool value) {
   _internal_set_redo(value);
@@ -3065,28 +3444,28 @@ inline void Payload::set_redo(bool value) {
 
 // optional uint64 num = 10;
 inline bool Payload::_internal_has_num() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool Payload::has_num() const {
   return _internal_has_num();
 }
 inline void Payload::clear_num() {
-  num_ = uint64_t{0u};
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Payload::_internal_num() const {
-  return num_;
+inline uint64_t Payload::_internal_num() const {
+  return _impl_.num_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Payload::num() const {
+inline uint64_t Payload::num() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.Payload.num)
   return _internal_num();
 }
-inline void Payload::_internal_set_num(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _has_bits_[0] |= 0x00000001u;
-  num_ = value;
+inline void Payload::_internal_set_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.num_ = value;
 }
-inline void Payload::set_num(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void Payload::set_num(uint64_t value) {
   _internal_set_num(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.Payload.num)
 }
@@ -3097,7 +3476,7 @@ inline void Payload::set_num(::PROTOBUF_NAMESPACE_ID::uint64 value) {
 
 // string mask = 1;
 inline void SchemaRequest::clear_mask() {
-  mask_.ClearToEmpty();
+  _impl_.mask_.ClearToEmpty();
 }
 inline const std::string& SchemaRequest::mask() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.SchemaRequest.mask)
@@ -3107,7 +3486,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void SchemaRequest::set_mask(ArgT0&& arg0, ArgT... args) {
  
- mask_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.mask_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.SchemaRequest.mask)
 }
 inline std::string* SchemaRequest::mutable_mask() {
@@ -3116,19 +3495,19 @@ inline std::string* SchemaRequest::mutable_mask() {
   return _s;
 }
 inline const std::string& SchemaRequest::_internal_mask() const {
-  return mask_.Get();
+  return _impl_.mask_.Get();
 }
 inline void SchemaRequest::_internal_set_mask(const std::string& value) {
   
-  mask_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.mask_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SchemaRequest::_internal_mutable_mask() {
   
-  return mask_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.mask_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SchemaRequest::release_mask() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.SchemaRequest.mask)
-  return mask_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.mask_.Release();
 }
 inline void SchemaRequest::set_allocated_mask(std::string* mask) {
   if (mask != nullptr) {
@@ -3136,14 +3515,18 @@ inline void SchemaRequest::set_allocated_mask(std::string* mask) {
   } else {
     
   }
-  mask_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), mask,
-      GetArenaForAllocation());
+  _impl_.mask_.SetAllocated(mask, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.mask_.IsDefault()) {
+    _impl_.mask_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.SchemaRequest.mask)
 }
 
 // string filter = 2;
 inline void SchemaRequest::clear_filter() {
-  filter_.ClearToEmpty();
+  _impl_.filter_.ClearToEmpty();
 }
 inline const std::string& SchemaRequest::filter() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.SchemaRequest.filter)
@@ -3153,7 +3536,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void SchemaRequest::set_filter(ArgT0&& arg0, ArgT... args) {
  
- filter_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.SchemaRequest.filter)
 }
 inline std::string* SchemaRequest::mutable_filter() {
@@ -3162,19 +3545,19 @@ inline std::string* SchemaRequest::mutable_filter() {
   return _s;
 }
 inline const std::string& SchemaRequest::_internal_filter() const {
-  return filter_.Get();
+  return _impl_.filter_.Get();
 }
 inline void SchemaRequest::_internal_set_filter(const std::string& value) {
   
-  filter_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.filter_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SchemaRequest::_internal_mutable_filter() {
   
-  return filter_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.filter_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SchemaRequest::release_filter() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.SchemaRequest.filter)
-  return filter_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.filter_.Release();
 }
 inline void SchemaRequest::set_allocated_filter(std::string* filter) {
   if (filter != nullptr) {
@@ -3182,8 +3565,12 @@ inline void SchemaRequest::set_allocated_filter(std::string* filter) {
   } else {
     
   }
-  filter_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), filter,
-      GetArenaForAllocation());
+  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filter_.IsDefault()) {
+    _impl_.filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.SchemaRequest.filter)
 }
 
@@ -3193,10 +3580,10 @@ inline void SchemaRequest::set_allocated_filter(std::string* filter) {
 
 // .OpenLogReplicator.pb.RequestCode code = 1;
 inline void RedoRequest::clear_code() {
-  code_ = 0;
+  _impl_.code_ = 0;
 }
 inline ::OpenLogReplicator::pb::RequestCode RedoRequest::_internal_code() const {
-  return static_cast< ::OpenLogReplicator::pb::RequestCode >(code_);
+  return static_cast< ::OpenLogReplicator::pb::RequestCode >(_impl_.code_);
 }
 inline ::OpenLogReplicator::pb::RequestCode RedoRequest::code() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoRequest.code)
@@ -3204,7 +3591,7 @@ inline ::OpenLogReplicator::pb::RequestCode RedoRequest::code() const {
 }
 inline void RedoRequest::_internal_set_code(::OpenLogReplicator::pb::RequestCode value) {
   
-  code_ = value;
+  _impl_.code_ = value;
 }
 inline void RedoRequest::set_code(::OpenLogReplicator::pb::RequestCode value) {
   _internal_set_code(value);
@@ -3213,7 +3600,7 @@ inline void RedoRequest::set_code(::OpenLogReplicator::pb::RequestCode value) {
 
 // string database_name = 2;
 inline void RedoRequest::clear_database_name() {
-  database_name_.ClearToEmpty();
+  _impl_.database_name_.ClearToEmpty();
 }
 inline const std::string& RedoRequest::database_name() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoRequest.database_name)
@@ -3223,7 +3610,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void RedoRequest::set_database_name(ArgT0&& arg0, ArgT... args) {
  
- database_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.database_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoRequest.database_name)
 }
 inline std::string* RedoRequest::mutable_database_name() {
@@ -3232,19 +3619,19 @@ inline std::string* RedoRequest::mutable_database_name() {
   return _s;
 }
 inline const std::string& RedoRequest::_internal_database_name() const {
-  return database_name_.Get();
+  return _impl_.database_name_.Get();
 }
 inline void RedoRequest::_internal_set_database_name(const std::string& value) {
   
-  database_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.database_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RedoRequest::_internal_mutable_database_name() {
   
-  return database_name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.database_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RedoRequest::release_database_name() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.RedoRequest.database_name)
-  return database_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  return _impl_.database_name_.Release();
 }
 inline void RedoRequest::set_allocated_database_name(std::string* database_name) {
   if (database_name != nullptr) {
@@ -3252,8 +3639,12 @@ inline void RedoRequest::set_allocated_database_name(std::string* database_name)
   } else {
     
   }
-  database_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), database_name,
-      GetArenaForAllocation());
+  _impl_.database_name_.SetAllocated(database_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.database_name_.IsDefault()) {
+    _impl_.database_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.RedoRequest.database_name)
 }
 
@@ -3265,32 +3656,32 @@ inline bool RedoRequest::has_scn() const {
   return _internal_has_scn();
 }
 inline void RedoRequest::set_has_scn() {
-  _oneof_case_[0] = kScn;
+  _impl_._oneof_case_[0] = kScn;
 }
 inline void RedoRequest::clear_scn() {
   if (_internal_has_scn()) {
-    tm_val_.scn_ = uint64_t{0u};
+    _impl_.tm_val_.scn_ = uint64_t{0u};
     clear_has_tm_val();
   }
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RedoRequest::_internal_scn() const {
+inline uint64_t RedoRequest::_internal_scn() const {
   if (_internal_has_scn()) {
-    return tm_val_.scn_;
+    return _impl_.tm_val_.scn_;
   }
   return uint64_t{0u};
 }
-inline void RedoRequest::_internal_set_scn(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void RedoRequest::_internal_set_scn(uint64_t value) {
   if (!_internal_has_scn()) {
     clear_tm_val();
     set_has_scn();
   }
-  tm_val_.scn_ = value;
+  _impl_.tm_val_.scn_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RedoRequest::scn() const {
+inline uint64_t RedoRequest::scn() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoRequest.scn)
   return _internal_scn();
 }
-inline void RedoRequest::set_scn(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void RedoRequest::set_scn(uint64_t value) {
   _internal_set_scn(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoRequest.scn)
 }
@@ -3303,11 +3694,11 @@ inline bool RedoRequest::has_tms() const {
   return _internal_has_tms();
 }
 inline void RedoRequest::set_has_tms() {
-  _oneof_case_[0] = kTms;
+  _impl_._oneof_case_[0] = kTms;
 }
 inline void RedoRequest::clear_tms() {
   if (_internal_has_tms()) {
-    tm_val_.tms_.Destroy(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+    _impl_.tm_val_.tms_.Destroy();
     clear_has_tm_val();
   }
 }
@@ -3320,9 +3711,9 @@ inline void RedoRequest::set_tms(ArgT0&& arg0, ArgT... args) {
   if (!_internal_has_tms()) {
     clear_tm_val();
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.tm_val_.tms_.InitDefault();
   }
-  tm_val_.tms_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  _impl_.tm_val_.tms_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoRequest.tms)
 }
 inline std::string* RedoRequest::mutable_tms() {
@@ -3332,7 +3723,7 @@ inline std::string* RedoRequest::mutable_tms() {
 }
 inline const std::string& RedoRequest::_internal_tms() const {
   if (_internal_has_tms()) {
-    return tm_val_.tms_.Get();
+    return _impl_.tm_val_.tms_.Get();
   }
   return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
@@ -3340,24 +3731,23 @@ inline void RedoRequest::_internal_set_tms(const std::string& value) {
   if (!_internal_has_tms()) {
     clear_tm_val();
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.tm_val_.tms_.InitDefault();
   }
-  tm_val_.tms_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.tm_val_.tms_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RedoRequest::_internal_mutable_tms() {
   if (!_internal_has_tms()) {
     clear_tm_val();
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.tm_val_.tms_.InitDefault();
   }
-  return tm_val_.tms_.Mutable(
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.tm_val_.tms_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* RedoRequest::release_tms() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.RedoRequest.tms)
   if (_internal_has_tms()) {
     clear_has_tm_val();
-    return tm_val_.tms_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+    return _impl_.tm_val_.tms_.Release();
   } else {
     return nullptr;
   }
@@ -3368,11 +3758,7 @@ inline void RedoRequest::set_allocated_tms(std::string* tms) {
   }
   if (tms != nullptr) {
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(tms);
-    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArenaForAllocation();
-    if (arena != nullptr) {
-      arena->Own(tms);
-    }
+    _impl_.tm_val_.tms_.InitAllocated(tms, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.RedoRequest.tms)
 }
@@ -3385,92 +3771,92 @@ inline bool RedoRequest::has_tm_rel() const {
   return _internal_has_tm_rel();
 }
 inline void RedoRequest::set_has_tm_rel() {
-  _oneof_case_[0] = kTmRel;
+  _impl_._oneof_case_[0] = kTmRel;
 }
 inline void RedoRequest::clear_tm_rel() {
   if (_internal_has_tm_rel()) {
-    tm_val_.tm_rel_ = int64_t{0};
+    _impl_.tm_val_.tm_rel_ = int64_t{0};
     clear_has_tm_val();
   }
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 RedoRequest::_internal_tm_rel() const {
+inline int64_t RedoRequest::_internal_tm_rel() const {
   if (_internal_has_tm_rel()) {
-    return tm_val_.tm_rel_;
+    return _impl_.tm_val_.tm_rel_;
   }
   return int64_t{0};
 }
-inline void RedoRequest::_internal_set_tm_rel(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void RedoRequest::_internal_set_tm_rel(int64_t value) {
   if (!_internal_has_tm_rel()) {
     clear_tm_val();
     set_has_tm_rel();
   }
-  tm_val_.tm_rel_ = value;
+  _impl_.tm_val_.tm_rel_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 RedoRequest::tm_rel() const {
+inline int64_t RedoRequest::tm_rel() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoRequest.tm_rel)
   return _internal_tm_rel();
 }
-inline void RedoRequest::set_tm_rel(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void RedoRequest::set_tm_rel(int64_t value) {
   _internal_set_tm_rel(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoRequest.tm_rel)
 }
 
 // optional uint64 seq = 6;
 inline bool RedoRequest::_internal_has_seq() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool RedoRequest::has_seq() const {
   return _internal_has_seq();
 }
 inline void RedoRequest::clear_seq() {
-  seq_ = uint64_t{0u};
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.seq_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RedoRequest::_internal_seq() const {
-  return seq_;
+inline uint64_t RedoRequest::_internal_seq() const {
+  return _impl_.seq_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RedoRequest::seq() const {
+inline uint64_t RedoRequest::seq() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoRequest.seq)
   return _internal_seq();
 }
-inline void RedoRequest::_internal_set_seq(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _has_bits_[0] |= 0x00000001u;
-  seq_ = value;
+inline void RedoRequest::_internal_set_seq(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.seq_ = value;
 }
-inline void RedoRequest::set_seq(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void RedoRequest::set_seq(uint64_t value) {
   _internal_set_seq(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoRequest.seq)
 }
 
 // repeated .OpenLogReplicator.pb.SchemaRequest schema = 7;
 inline int RedoRequest::_internal_schema_size() const {
-  return schema_.size();
+  return _impl_.schema_.size();
 }
 inline int RedoRequest::schema_size() const {
   return _internal_schema_size();
 }
 inline void RedoRequest::clear_schema() {
-  schema_.Clear();
+  _impl_.schema_.Clear();
 }
 inline ::OpenLogReplicator::pb::SchemaRequest* RedoRequest::mutable_schema(int index) {
   // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.RedoRequest.schema)
-  return schema_.Mutable(index);
+  return _impl_.schema_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::SchemaRequest >*
 RedoRequest::mutable_schema() {
   // @@protoc_insertion_point(field_mutable_list:OpenLogReplicator.pb.RedoRequest.schema)
-  return &schema_;
+  return &_impl_.schema_;
 }
 inline const ::OpenLogReplicator::pb::SchemaRequest& RedoRequest::_internal_schema(int index) const {
-  return schema_.Get(index);
+  return _impl_.schema_.Get(index);
 }
 inline const ::OpenLogReplicator::pb::SchemaRequest& RedoRequest::schema(int index) const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoRequest.schema)
   return _internal_schema(index);
 }
 inline ::OpenLogReplicator::pb::SchemaRequest* RedoRequest::_internal_add_schema() {
-  return schema_.Add();
+  return _impl_.schema_.Add();
 }
 inline ::OpenLogReplicator::pb::SchemaRequest* RedoRequest::add_schema() {
   ::OpenLogReplicator::pb::SchemaRequest* _add = _internal_add_schema();
@@ -3480,17 +3866,17 @@ inline ::OpenLogReplicator::pb::SchemaRequest* RedoRequest::add_schema() {
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::SchemaRequest >&
 RedoRequest::schema() const {
   // @@protoc_insertion_point(field_list:OpenLogReplicator.pb.RedoRequest.schema)
-  return schema_;
+  return _impl_.schema_;
 }
 
 inline bool RedoRequest::has_tm_val() const {
   return tm_val_case() != TM_VAL_NOT_SET;
 }
 inline void RedoRequest::clear_has_tm_val() {
-  _oneof_case_[0] = TM_VAL_NOT_SET;
+  _impl_._oneof_case_[0] = TM_VAL_NOT_SET;
 }
 inline RedoRequest::TmValCase RedoRequest::tm_val_case() const {
-  return RedoRequest::TmValCase(_oneof_case_[0]);
+  return RedoRequest::TmValCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -3498,10 +3884,10 @@ inline RedoRequest::TmValCase RedoRequest::tm_val_case() const {
 
 // .OpenLogReplicator.pb.ResponseCode code = 1;
 inline void RedoResponse::clear_code() {
-  code_ = 0;
+  _impl_.code_ = 0;
 }
 inline ::OpenLogReplicator::pb::ResponseCode RedoResponse::_internal_code() const {
-  return static_cast< ::OpenLogReplicator::pb::ResponseCode >(code_);
+  return static_cast< ::OpenLogReplicator::pb::ResponseCode >(_impl_.code_);
 }
 inline ::OpenLogReplicator::pb::ResponseCode RedoResponse::code() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoResponse.code)
@@ -3509,7 +3895,7 @@ inline ::OpenLogReplicator::pb::ResponseCode RedoResponse::code() const {
 }
 inline void RedoResponse::_internal_set_code(::OpenLogReplicator::pb::ResponseCode value) {
   
-  code_ = value;
+  _impl_.code_ = value;
 }
 inline void RedoResponse::set_code(::OpenLogReplicator::pb::ResponseCode value) {
   _internal_set_code(value);
@@ -3524,32 +3910,32 @@ inline bool RedoResponse::has_scn() const {
   return _internal_has_scn();
 }
 inline void RedoResponse::set_has_scn() {
-  _oneof_case_[0] = kScn;
+  _impl_._oneof_case_[0] = kScn;
 }
 inline void RedoResponse::clear_scn() {
   if (_internal_has_scn()) {
-    scn_val_.scn_ = uint64_t{0u};
+    _impl_.scn_val_.scn_ = uint64_t{0u};
     clear_has_scn_val();
   }
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RedoResponse::_internal_scn() const {
+inline uint64_t RedoResponse::_internal_scn() const {
   if (_internal_has_scn()) {
-    return scn_val_.scn_;
+    return _impl_.scn_val_.scn_;
   }
   return uint64_t{0u};
 }
-inline void RedoResponse::_internal_set_scn(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void RedoResponse::_internal_set_scn(uint64_t value) {
   if (!_internal_has_scn()) {
     clear_scn_val();
     set_has_scn();
   }
-  scn_val_.scn_ = value;
+  _impl_.scn_val_.scn_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RedoResponse::scn() const {
+inline uint64_t RedoResponse::scn() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoResponse.scn)
   return _internal_scn();
 }
-inline void RedoResponse::set_scn(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void RedoResponse::set_scn(uint64_t value) {
   _internal_set_scn(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoResponse.scn)
 }
@@ -3562,11 +3948,11 @@ inline bool RedoResponse::has_scns() const {
   return _internal_has_scns();
 }
 inline void RedoResponse::set_has_scns() {
-  _oneof_case_[0] = kScns;
+  _impl_._oneof_case_[0] = kScns;
 }
 inline void RedoResponse::clear_scns() {
   if (_internal_has_scns()) {
-    scn_val_.scns_.Destroy(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+    _impl_.scn_val_.scns_.Destroy();
     clear_has_scn_val();
   }
 }
@@ -3579,9 +3965,9 @@ inline void RedoResponse::set_scns(ArgT0&& arg0, ArgT... args) {
   if (!_internal_has_scns()) {
     clear_scn_val();
     set_has_scns();
-    scn_val_.scns_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.scn_val_.scns_.InitDefault();
   }
-  scn_val_.scns_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  _impl_.scn_val_.scns_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoResponse.scns)
 }
 inline std::string* RedoResponse::mutable_scns() {
@@ -3591,7 +3977,7 @@ inline std::string* RedoResponse::mutable_scns() {
 }
 inline const std::string& RedoResponse::_internal_scns() const {
   if (_internal_has_scns()) {
-    return scn_val_.scns_.Get();
+    return _impl_.scn_val_.scns_.Get();
   }
   return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
@@ -3599,24 +3985,23 @@ inline void RedoResponse::_internal_set_scns(const std::string& value) {
   if (!_internal_has_scns()) {
     clear_scn_val();
     set_has_scns();
-    scn_val_.scns_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.scn_val_.scns_.InitDefault();
   }
-  scn_val_.scns_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.scn_val_.scns_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RedoResponse::_internal_mutable_scns() {
   if (!_internal_has_scns()) {
     clear_scn_val();
     set_has_scns();
-    scn_val_.scns_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.scn_val_.scns_.InitDefault();
   }
-  return scn_val_.scns_.Mutable(
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.scn_val_.scns_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* RedoResponse::release_scns() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.RedoResponse.scns)
   if (_internal_has_scns()) {
     clear_has_scn_val();
-    return scn_val_.scns_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+    return _impl_.scn_val_.scns_.Release();
   } else {
     return nullptr;
   }
@@ -3627,11 +4012,7 @@ inline void RedoResponse::set_allocated_scns(std::string* scns) {
   }
   if (scns != nullptr) {
     set_has_scns();
-    scn_val_.scns_.UnsafeSetDefault(scns);
-    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArenaForAllocation();
-    if (arena != nullptr) {
-      arena->Own(scns);
-    }
+    _impl_.scn_val_.scns_.InitAllocated(scns, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.RedoResponse.scns)
 }
@@ -3644,32 +4025,32 @@ inline bool RedoResponse::has_tm() const {
   return _internal_has_tm();
 }
 inline void RedoResponse::set_has_tm() {
-  _oneof_case_[1] = kTm;
+  _impl_._oneof_case_[1] = kTm;
 }
 inline void RedoResponse::clear_tm() {
   if (_internal_has_tm()) {
-    tm_val_.tm_ = uint64_t{0u};
+    _impl_.tm_val_.tm_ = uint64_t{0u};
     clear_has_tm_val();
   }
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RedoResponse::_internal_tm() const {
+inline uint64_t RedoResponse::_internal_tm() const {
   if (_internal_has_tm()) {
-    return tm_val_.tm_;
+    return _impl_.tm_val_.tm_;
   }
   return uint64_t{0u};
 }
-inline void RedoResponse::_internal_set_tm(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void RedoResponse::_internal_set_tm(uint64_t value) {
   if (!_internal_has_tm()) {
     clear_tm_val();
     set_has_tm();
   }
-  tm_val_.tm_ = value;
+  _impl_.tm_val_.tm_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RedoResponse::tm() const {
+inline uint64_t RedoResponse::tm() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoResponse.tm)
   return _internal_tm();
 }
-inline void RedoResponse::set_tm(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void RedoResponse::set_tm(uint64_t value) {
   _internal_set_tm(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoResponse.tm)
 }
@@ -3682,11 +4063,11 @@ inline bool RedoResponse::has_tms() const {
   return _internal_has_tms();
 }
 inline void RedoResponse::set_has_tms() {
-  _oneof_case_[1] = kTms;
+  _impl_._oneof_case_[1] = kTms;
 }
 inline void RedoResponse::clear_tms() {
   if (_internal_has_tms()) {
-    tm_val_.tms_.Destroy(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+    _impl_.tm_val_.tms_.Destroy();
     clear_has_tm_val();
   }
 }
@@ -3699,9 +4080,9 @@ inline void RedoResponse::set_tms(ArgT0&& arg0, ArgT... args) {
   if (!_internal_has_tms()) {
     clear_tm_val();
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.tm_val_.tms_.InitDefault();
   }
-  tm_val_.tms_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  _impl_.tm_val_.tms_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoResponse.tms)
 }
 inline std::string* RedoResponse::mutable_tms() {
@@ -3711,7 +4092,7 @@ inline std::string* RedoResponse::mutable_tms() {
 }
 inline const std::string& RedoResponse::_internal_tms() const {
   if (_internal_has_tms()) {
-    return tm_val_.tms_.Get();
+    return _impl_.tm_val_.tms_.Get();
   }
   return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
@@ -3719,24 +4100,23 @@ inline void RedoResponse::_internal_set_tms(const std::string& value) {
   if (!_internal_has_tms()) {
     clear_tm_val();
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.tm_val_.tms_.InitDefault();
   }
-  tm_val_.tms_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.tm_val_.tms_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RedoResponse::_internal_mutable_tms() {
   if (!_internal_has_tms()) {
     clear_tm_val();
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.tm_val_.tms_.InitDefault();
   }
-  return tm_val_.tms_.Mutable(
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.tm_val_.tms_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* RedoResponse::release_tms() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.RedoResponse.tms)
   if (_internal_has_tms()) {
     clear_has_tm_val();
-    return tm_val_.tms_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+    return _impl_.tm_val_.tms_.Release();
   } else {
     return nullptr;
   }
@@ -3747,11 +4127,7 @@ inline void RedoResponse::set_allocated_tms(std::string* tms) {
   }
   if (tms != nullptr) {
     set_has_tms();
-    tm_val_.tms_.UnsafeSetDefault(tms);
-    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArenaForAllocation();
-    if (arena != nullptr) {
-      arena->Own(tms);
-    }
+    _impl_.tm_val_.tms_.InitAllocated(tms, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.RedoResponse.tms)
 }
@@ -3764,11 +4140,11 @@ inline bool RedoResponse::has_xid() const {
   return _internal_has_xid();
 }
 inline void RedoResponse::set_has_xid() {
-  _oneof_case_[2] = kXid;
+  _impl_._oneof_case_[2] = kXid;
 }
 inline void RedoResponse::clear_xid() {
   if (_internal_has_xid()) {
-    xid_val_.xid_.Destroy(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+    _impl_.xid_val_.xid_.Destroy();
     clear_has_xid_val();
   }
 }
@@ -3781,9 +4157,9 @@ inline void RedoResponse::set_xid(ArgT0&& arg0, ArgT... args) {
   if (!_internal_has_xid()) {
     clear_xid_val();
     set_has_xid();
-    xid_val_.xid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.xid_val_.xid_.InitDefault();
   }
-  xid_val_.xid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  _impl_.xid_val_.xid_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoResponse.xid)
 }
 inline std::string* RedoResponse::mutable_xid() {
@@ -3793,7 +4169,7 @@ inline std::string* RedoResponse::mutable_xid() {
 }
 inline const std::string& RedoResponse::_internal_xid() const {
   if (_internal_has_xid()) {
-    return xid_val_.xid_.Get();
+    return _impl_.xid_val_.xid_.Get();
   }
   return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
@@ -3801,24 +4177,23 @@ inline void RedoResponse::_internal_set_xid(const std::string& value) {
   if (!_internal_has_xid()) {
     clear_xid_val();
     set_has_xid();
-    xid_val_.xid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.xid_val_.xid_.InitDefault();
   }
-  xid_val_.xid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_.xid_val_.xid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RedoResponse::_internal_mutable_xid() {
   if (!_internal_has_xid()) {
     clear_xid_val();
     set_has_xid();
-    xid_val_.xid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.xid_val_.xid_.InitDefault();
   }
-  return xid_val_.xid_.Mutable(
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  return _impl_.xid_val_.xid_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* RedoResponse::release_xid() {
   // @@protoc_insertion_point(field_release:OpenLogReplicator.pb.RedoResponse.xid)
   if (_internal_has_xid()) {
     clear_has_xid_val();
-    return xid_val_.xid_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+    return _impl_.xid_val_.xid_.Release();
   } else {
     return nullptr;
   }
@@ -3829,11 +4204,7 @@ inline void RedoResponse::set_allocated_xid(std::string* xid) {
   }
   if (xid != nullptr) {
     set_has_xid();
-    xid_val_.xid_.UnsafeSetDefault(xid);
-    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArenaForAllocation();
-    if (arena != nullptr) {
-      arena->Own(xid);
-    }
+    _impl_.xid_val_.xid_.InitAllocated(xid, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:OpenLogReplicator.pb.RedoResponse.xid)
 }
@@ -3846,64 +4217,64 @@ inline bool RedoResponse::has_xidn() const {
   return _internal_has_xidn();
 }
 inline void RedoResponse::set_has_xidn() {
-  _oneof_case_[2] = kXidn;
+  _impl_._oneof_case_[2] = kXidn;
 }
 inline void RedoResponse::clear_xidn() {
   if (_internal_has_xidn()) {
-    xid_val_.xidn_ = uint64_t{0u};
+    _impl_.xid_val_.xidn_ = uint64_t{0u};
     clear_has_xid_val();
   }
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RedoResponse::_internal_xidn() const {
+inline uint64_t RedoResponse::_internal_xidn() const {
   if (_internal_has_xidn()) {
-    return xid_val_.xidn_;
+    return _impl_.xid_val_.xidn_;
   }
   return uint64_t{0u};
 }
-inline void RedoResponse::_internal_set_xidn(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void RedoResponse::_internal_set_xidn(uint64_t value) {
   if (!_internal_has_xidn()) {
     clear_xid_val();
     set_has_xidn();
   }
-  xid_val_.xidn_ = value;
+  _impl_.xid_val_.xidn_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RedoResponse::xidn() const {
+inline uint64_t RedoResponse::xidn() const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoResponse.xidn)
   return _internal_xidn();
 }
-inline void RedoResponse::set_xidn(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void RedoResponse::set_xidn(uint64_t value) {
   _internal_set_xidn(value);
   // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoResponse.xidn)
 }
 
 // repeated .OpenLogReplicator.pb.Payload payload = 8;
 inline int RedoResponse::_internal_payload_size() const {
-  return payload_.size();
+  return _impl_.payload_.size();
 }
 inline int RedoResponse::payload_size() const {
   return _internal_payload_size();
 }
 inline void RedoResponse::clear_payload() {
-  payload_.Clear();
+  _impl_.payload_.Clear();
 }
 inline ::OpenLogReplicator::pb::Payload* RedoResponse::mutable_payload(int index) {
   // @@protoc_insertion_point(field_mutable:OpenLogReplicator.pb.RedoResponse.payload)
-  return payload_.Mutable(index);
+  return _impl_.payload_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Payload >*
 RedoResponse::mutable_payload() {
   // @@protoc_insertion_point(field_mutable_list:OpenLogReplicator.pb.RedoResponse.payload)
-  return &payload_;
+  return &_impl_.payload_;
 }
 inline const ::OpenLogReplicator::pb::Payload& RedoResponse::_internal_payload(int index) const {
-  return payload_.Get(index);
+  return _impl_.payload_.Get(index);
 }
 inline const ::OpenLogReplicator::pb::Payload& RedoResponse::payload(int index) const {
   // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoResponse.payload)
   return _internal_payload(index);
 }
 inline ::OpenLogReplicator::pb::Payload* RedoResponse::_internal_add_payload() {
-  return payload_.Add();
+  return _impl_.payload_.Add();
 }
 inline ::OpenLogReplicator::pb::Payload* RedoResponse::add_payload() {
   ::OpenLogReplicator::pb::Payload* _add = _internal_add_payload();
@@ -3913,35 +4284,55 @@ inline ::OpenLogReplicator::pb::Payload* RedoResponse::add_payload() {
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::OpenLogReplicator::pb::Payload >&
 RedoResponse::payload() const {
   // @@protoc_insertion_point(field_list:OpenLogReplicator.pb.RedoResponse.payload)
-  return payload_;
+  return _impl_.payload_;
+}
+
+// bool provisional = 9;
+inline void RedoResponse::clear_provisional() {
+  _impl_.provisional_ = false;
+}
+inline bool RedoResponse::_internal_provisional() const {
+  return _impl_.provisional_;
+}
+inline bool RedoResponse::provisional() const {
+  // @@protoc_insertion_point(field_get:OpenLogReplicator.pb.RedoResponse.provisional)
+  return _internal_provisional();
+}
+inline void RedoResponse::_internal_set_provisional(bool value) {
+  
+  _impl_.provisional_ = value;
+}
+inline void RedoResponse::set_provisional(bool value) {
+  _internal_set_provisional(value);
+  // @@protoc_insertion_point(field_set:OpenLogReplicator.pb.RedoResponse.provisional)
 }
 
 inline bool RedoResponse::has_scn_val() const {
   return scn_val_case() != SCN_VAL_NOT_SET;
 }
 inline void RedoResponse::clear_has_scn_val() {
-  _oneof_case_[0] = SCN_VAL_NOT_SET;
+  _impl_._oneof_case_[0] = SCN_VAL_NOT_SET;
 }
 inline bool RedoResponse::has_tm_val() const {
   return tm_val_case() != TM_VAL_NOT_SET;
 }
 inline void RedoResponse::clear_has_tm_val() {
-  _oneof_case_[1] = TM_VAL_NOT_SET;
+  _impl_._oneof_case_[1] = TM_VAL_NOT_SET;
 }
 inline bool RedoResponse::has_xid_val() const {
   return xid_val_case() != XID_VAL_NOT_SET;
 }
 inline void RedoResponse::clear_has_xid_val() {
-  _oneof_case_[2] = XID_VAL_NOT_SET;
+  _impl_._oneof_case_[2] = XID_VAL_NOT_SET;
 }
 inline RedoResponse::ScnValCase RedoResponse::scn_val_case() const {
-  return RedoResponse::ScnValCase(_oneof_case_[0]);
+  return RedoResponse::ScnValCase(_impl_._oneof_case_[0]);
 }
 inline RedoResponse::TmValCase RedoResponse::tm_val_case() const {
-  return RedoResponse::TmValCase(_oneof_case_[1]);
+  return RedoResponse::TmValCase(_impl_._oneof_case_[1]);
 }
 inline RedoResponse::XidValCase RedoResponse::xid_val_case() const {
-  return RedoResponse::XidValCase(_oneof_case_[2]);
+  return RedoResponse::XidValCase(_impl_._oneof_case_[2]);
 }
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
@@ -3958,6 +4349,8 @@ inline RedoResponse::XidValCase RedoResponse::xid_val_case() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
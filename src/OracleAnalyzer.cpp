@@ -39,6 +39,17 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "TransactionBuffer.h"
 
 namespace OpenLogReplicator {
+    //magazines of the current thread, by allocator id, ids are never reused
+    struct MemoryMagazineRef {
+        uint64_t allocatorId;
+        MemoryMagazine* magazine;
+    };
+    static thread_local MemoryMagazineRef threadMagazines[MEMORY_MAGAZINE_THREAD_CACHE];
+    static thread_local uint64_t threadMagazinesNext = 0;
+    static std::atomic<uint64_t> memoryAllocatorIds(0);
+
+    const char* OracleAnalyzer::MEMORY_MODULE_NAME[] = {"read buffer", "LWN", "transactions", "output buffer", "protobuf arena"};
+
     OracleAnalyzer::OracleAnalyzer(OutputBuffer* outputBuffer, uint64_t dumpRedoLog, uint64_t dumpRawData, const char* dumpPath,
             const char* alias, const char* database, uint64_t memoryMinMb, uint64_t memoryMaxMb, uint64_t readBufferMax,
             uint64_t disableChecks) :
@@ -57,6 +68,10 @@ namespace OpenLogReplicator {
         memoryChunksMax(memoryMaxMb / MEMORY_CHUNK_SIZE_MB),
         memoryChunksHWM(0),
         memoryChunksSupplemental(0),
+        memoryAllocatorId(++memoryAllocatorIds),
+        memoryDepotLocks(0),
+        memoryDepotContended(0),
+        memoryReportLastTime(0),
         database(database),
         dbBlockChecksum(""),
         logArchiveFormat("o1_mf_%t_%s_%h_.arc"),
@@ -95,6 +110,7 @@ namespace OpenLogReplicator {
         archReadTries(10),
         redoVerifyDelayUs((flags & REDO_FLAGS_DIRECT_DISABLE) != 0 ? 500000 : 0),
         refreshIntervalUs(10000000),
+        memoryReportIntervalS(0),
         version(0),
         conId(-1),
         resetlogs(0),
@@ -103,6 +119,7 @@ namespace OpenLogReplicator {
         stopCheckpoints(0),
         stopTransactions(0),
         transactionMax(0),
+        transactionStreamMax(0),
         stopFlushBuffer(false),
         oiCurrent(nullptr),
         bigEndian(false),
@@ -122,6 +139,14 @@ namespace OpenLogReplicator {
         write56(write56Little),
         write64(write64Little),
         writeSCN(writeSCNLittle) {
+
+        for (uint64_t module = 0; module < MEMORY_MODULES_NUM; ++module) {
+            memoryModulesAllocated[module] = 0;
+            memoryModulesHWM[module] = 0;
+            memoryModulesAllocations[module] = 0;
+            memoryModulesAllocationsReported[module] = 0;
+            memoryModulesMax[module] = 0;
+        }
     }
 
     OracleAnalyzer::~OracleAnalyzer() {
@@ -153,6 +178,12 @@ namespace OpenLogReplicator {
             transactionBuffer = nullptr;
         }
 
+        if (memoryChunks != nullptr)
+            reclaimMemoryMagazines();
+        for (MemoryMagazine* magazine : memoryMagazines)
+            delete magazine;
+        memoryMagazines.clear();
+
         while (memoryChunksAllocated > 0) {
             --memoryChunksAllocated;
             free(memoryChunks[memoryChunksAllocated]);
@@ -772,6 +803,20 @@ namespace OpenLogReplicator {
 
         INFO("Oracle analyzer for: " << database << " is shut down, allocated at most " << std::dec <<
                 (memoryChunksHWM * MEMORY_CHUNK_SIZE_MB) << "MB memory, max disk read buffer: " << (buffersMax * MEMORY_CHUNK_SIZE_MB) << "MB");
+        reportMemoryUsage(true);
+        if ((trace2 & TRACE2_MEMORY) != 0) {
+            uint64_t magazineHits = 0;
+            uint64_t magazineMisses = 0;
+            {
+                std::unique_lock<std::mutex> lck(mtx);
+                for (MemoryMagazine* magazine : memoryMagazines) {
+                    magazineHits += magazine->hits;
+                    magazineMisses += magazine->misses;
+                }
+            }
+            TRACE(TRACE2_MEMORY, "MEMORY: magazine hits: " << std::dec << magazineHits << ", misses: " << magazineMisses <<
+                    ", depot locks: " << memoryDepotLocks << ", contended: " << memoryDepotContended << ", threads: " << memoryMagazines.size());
+        }
 
         TRACE(TRACE2_THREADS, "THREADS: ANALYZER (" << std::hex << std::this_thread::get_id() << ") STOP");
         return 0;
@@ -1298,19 +1343,212 @@ namespace OpenLogReplicator {
         return false;
     }
 
-    uint8_t* OracleAnalyzer::getMemoryChunk(const char* module, bool supp) {
-        TRACE(TRACE2_MEMORY, "MEMORY: " << module << " - get at: " << std::dec << memoryChunksFree << "/" << memoryChunksAllocated);
+    MemoryMagazine* OracleAnalyzer::getMemoryMagazine(void) {
+        for (uint64_t i = 0; i < MEMORY_MAGAZINE_THREAD_CACHE; ++i)
+            if (threadMagazines[i].allocatorId == memoryAllocatorId)
+                return threadMagazines[i].magazine;
+
+        MemoryMagazine* magazine = findMemoryMagazine();
+        MemoryMagazineRef& ref = threadMagazines[threadMagazinesNext++ % MEMORY_MAGAZINE_THREAD_CACHE];
+        ref.allocatorId = memoryAllocatorId;
+        ref.magazine = magazine;
+        return magazine;
+    }
+
+    MemoryMagazine* OracleAnalyzer::findMemoryMagazine(void) {
+        std::unique_lock<std::mutex> lck(mtx);
+        for (MemoryMagazine* magazine : memoryMagazines) {
+            if (magazine->threadId == std::this_thread::get_id())
+                return magazine;
+        }
+
+        MemoryMagazine* magazine = new MemoryMagazine();
+        if (magazine == nullptr) {
+            RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(MemoryMagazine) << " bytes memory (for: memory magazine)");
+        }
+        magazine->threadId = std::this_thread::get_id();
+        for (uint64_t i = 0; i < MEMORY_MAGAZINE_SIZE; ++i)
+            magazine->chunks[i] = nullptr;
+        magazine->hits = 0;
+        magazine->misses = 0;
+        memoryMagazines.push_back(magazine);
+        return magazine;
+    }
+
+    //take a chunk from the magazine, only called by the owning thread
+    uint8_t* OracleAnalyzer::magazineGet(MemoryMagazine* magazine) {
+        for (uint64_t i = MEMORY_MAGAZINE_SIZE; i > 0; --i) {
+            if (magazine->chunks[i - 1].load(std::memory_order_relaxed) == nullptr)
+                continue;
+            uint8_t* chunk = magazine->chunks[i - 1].exchange(nullptr, std::memory_order_acquire);
+            if (chunk != nullptr)
+                return chunk;
+        }
+        return nullptr;
+    }
+
+    //put a chunk to the magazine, only called by the owning thread: an empty slot stays empty until it is filled here
+    bool OracleAnalyzer::magazinePut(MemoryMagazine* magazine, uint8_t* chunk) {
+        for (uint64_t i = 0; i < MEMORY_MAGAZINE_SIZE; ++i) {
+            if (magazine->chunks[i].load(std::memory_order_relaxed) == nullptr) {
+                magazine->chunks[i].store(chunk, std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //counters are written only by the owning thread
+    void OracleAnalyzer::magazineCount(std::atomic<uint64_t>& counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    void OracleAnalyzer::lockMemoryDepot(std::unique_lock<std::mutex>& lck) {
+        ++memoryDepotLocks;
+        if (!lck.try_lock()) {
+            ++memoryDepotContended;
+            lck.lock();
+        }
+    }
+
+    //move all chunks cached by threads back to the depot, requires mtx
+    void OracleAnalyzer::reclaimMemoryMagazines(void) {
+        for (MemoryMagazine* magazine : memoryMagazines) {
+            for (uint64_t i = 0; i < MEMORY_MAGAZINE_SIZE; ++i) {
+                uint8_t* chunk = magazine->chunks[i].exchange(nullptr, std::memory_order_acquire);
+                if (chunk != nullptr)
+                    memoryChunks[memoryChunksFree++] = chunk;
+            }
+        }
+    }
+
+    //return chunk to the depot, requires mtx
+    void OracleAnalyzer::releaseMemoryChunk(uint64_t module, uint8_t* chunk) {
+        if (memoryChunksFree == memoryChunksAllocated) {
+            RUNTIME_FAIL("trying to free unknown memory block for: " << MEMORY_MODULE_NAME[module]);
+        }
+
+        //keep 25% reserved
+        if (memoryChunksAllocated > memoryChunksMin && memoryChunksFree > memoryChunksAllocated / 4) {
+            free(chunk);
+            --memoryChunksAllocated;
+        } else {
+            memoryChunks[memoryChunksFree] = chunk;
+            ++memoryChunksFree;
+        }
+    }
+
+    //block until the writer releases memory below the consumer quota
+    void OracleAnalyzer::waitMemoryQuota(uint64_t module) {
+        std::unique_lock<std::mutex> lck(mtx);
+        if (memoryModulesAllocated[module] < memoryModulesMax[module] || shutdown)
+            return;
+
+        if (module != MEMORY_MODULE_OUTPUT_BUFFER) {
+            RUNTIME_FAIL("memory quota exhausted for: " << MEMORY_MODULE_NAME[module]);
+        }
+
+        WARNING("memory quota for " << MEMORY_MODULE_NAME[module] << " (" << std::dec << (memoryModulesMax[module] * MEMORY_CHUNK_SIZE_MB) <<
+                "MB) exhausted, sleeping until memory is released");
+        time_t waitStart = getTime();
+        time_t idleStart = waitStart;
+        uint64_t waitReported = 0;
+        while (memoryModulesAllocated[module] >= memoryModulesMax[module] && !shutdown) {
+            time_t now = getTime();
+            if (waitingForWriter)
+                idleStart = now;
+
+            //writer has nothing left to send, the quota is held by messages which are not complete yet
+            if ((uint64_t)(now - idleStart) >= MEMORY_QUOTA_WRITER_IDLE_S * 1000000) {
+                ERROR("HINT: increase \"memory-output-buffer-max-mb\", it must fit the biggest message (or batch of messages) being built");
+                shutdown = true;
+                readerCond.notify_all();
+                sleepingCond.notify_all();
+                analyzerCond.notify_all();
+                memoryCond.notify_all();
+                writerCond.notify_all();
+                RUNTIME_FAIL("output buffer quota too small (" << std::dec << (memoryModulesMax[module] * MEMORY_CHUNK_SIZE_MB) <<
+                        "MB), writer is idle and no memory can be released");
+            }
+
+            uint64_t waitS = (now - waitStart) / 1000000;
+            if (waitS >= waitReported + MEMORY_QUOTA_REPORT_S) {
+                waitReported = waitS;
+                WARNING("still waiting for " << MEMORY_MODULE_NAME[module] << " memory to be released: " << std::dec << waitS << "s, used: " <<
+                        (memoryModulesAllocated[module] * MEMORY_CHUNK_SIZE_MB) << "MB, writer " << (waitingForWriter ? "busy" : "idle"));
+            }
+
+            memoryCond.wait_for(lck, std::chrono::seconds(1));
+        }
+    }
+
+    void OracleAnalyzer::reportMemoryUsage(bool force) {
+        if (memoryReportIntervalS == 0 && !force)
+            return;
+
+        time_t now = time(nullptr);
+        if (memoryReportLastTime == 0)
+            memoryReportLastTime = now;
+        if (!force && (uint64_t)(now - memoryReportLastTime) < memoryReportIntervalS)
+            return;
+        uint64_t elapsedS = (now > memoryReportLastTime) ? (now - memoryReportLastTime) : 1;
+        memoryReportLastTime = now;
+
+        std::stringstream ss;
+        ss << "memory: {\"allocated-mb\": " << std::dec << (memoryChunksAllocated * MEMORY_CHUNK_SIZE_MB) <<
+                ", \"hwm-mb\": " << (memoryChunksHWM * MEMORY_CHUNK_SIZE_MB) <<
+                ", \"max-mb\": " << (memoryChunksMax * MEMORY_CHUNK_SIZE_MB);
+        for (uint64_t module = 0; module < MEMORY_MODULES_NUM; ++module) {
+            uint64_t allocations = memoryModulesAllocations[module];
+            ss << ", \"" << MEMORY_MODULE_NAME[module] << "\": {\"current-mb\": " << (memoryModulesAllocated[module] * MEMORY_CHUNK_SIZE_MB) <<
+                    ", \"peak-mb\": " << (memoryModulesHWM[module] * MEMORY_CHUNK_SIZE_MB) <<
+                    ", \"alloc-per-s\": " << ((allocations - memoryModulesAllocationsReported[module]) / elapsedS);
+            if (memoryModulesMax[module] > 0)
+                ss << ", \"max-mb\": " << (memoryModulesMax[module] * MEMORY_CHUNK_SIZE_MB);
+            ss << "}";
+            memoryModulesAllocationsReported[module] = allocations;
+        }
+        ss << "}";
+        INFO(ss.str());
+    }
+
+    uint8_t* OracleAnalyzer::getMemoryChunk(uint64_t module, bool supp) {
+        MemoryMagazine* magazine = getMemoryMagazine();
+        TRACE(TRACE2_MEMORY, "MEMORY: " << MEMORY_MODULE_NAME[module] << " - get at: " << std::dec << memoryChunksFree << "/" << memoryChunksAllocated);
+
+        if (memoryModulesMax[module] > 0 && memoryModulesAllocated[module] >= memoryModulesMax[module])
+            waitMemoryQuota(module);
+
+        uint64_t allocated = ++memoryModulesAllocated[module];
+        ++memoryModulesAllocations[module];
+        uint64_t hwm = memoryModulesHWM[module];
+        while (allocated > hwm && !memoryModulesHWM[module].compare_exchange_weak(hwm, allocated)) {
+        }
+
+        uint8_t* chunk = magazineGet(magazine);
+        if (chunk != nullptr) {
+            magazineCount(magazine->hits);
+            if (supp)
+                ++memoryChunksSupplemental;
+            return chunk;
+        }
+        magazineCount(magazine->misses);
 
         {
-            std::unique_lock<std::mutex> lck(mtx);
+            std::unique_lock<std::mutex> lck(mtx, std::defer_lock);
+            lockMemoryDepot(lck);
+
+            if (memoryChunksFree == 0 && memoryChunksAllocated == memoryChunksMax)
+                reclaimMemoryMagazines();
 
             if (memoryChunksFree == 0) {
                 if (memoryChunksAllocated == memoryChunksMax) {
                     if (memoryChunksSupplemental > 0 && waitingForWriter) {
                         WARNING("out of memory, sleeping until writer buffers are flushed and memory is released");
                         memoryCond.wait(lck);
+                        reclaimMemoryMagazines();
                     }
-                    if (memoryChunksAllocated == memoryChunksMax) {
+                    if (memoryChunksFree == 0 && memoryChunksAllocated == memoryChunksMax) {
                         ERROR("HINT: try to restart with higher value of \"memory-max-mb\" parameter or if big transaction - add to \"skip-xid\" list; transaction would be skipped");
                         shutdown = true;
                         readerCond.notify_all();
@@ -1318,10 +1556,12 @@ namespace OpenLogReplicator {
                         analyzerCond.notify_all();
                         memoryCond.notify_all();
                         writerCond.notify_all();
-                        RUNTIME_FAIL("memory exhausted when needed for: " << module);
+                        RUNTIME_FAIL("memory exhausted when needed for: " << MEMORY_MODULE_NAME[module]);
                     }
                 }
+            }
 
+            if (memoryChunksFree == 0) {
                 memoryChunks[0] = (uint8_t*) aligned_alloc(MEMORY_ALIGNMENT, MEMORY_CHUNK_SIZE);
                 if (memoryChunks[0] == nullptr) {
                     RUNTIME_FAIL("couldn't allocate " << std::dec << (MEMORY_CHUNK_SIZE_MB) << " bytes memory (for: memory chunks#6)");
@@ -1334,32 +1574,48 @@ namespace OpenLogReplicator {
             }
 
             --memoryChunksFree;
+            chunk = memoryChunks[memoryChunksFree];
+
+            //refill magazine only with chunks already free in the depot
+            for (uint64_t i = 0; i < MEMORY_MAGAZINE_BATCH && memoryChunksFree > 0; ++i) {
+                if (!magazinePut(magazine, memoryChunks[memoryChunksFree - 1]))
+                    break;
+                --memoryChunksFree;
+            }
+
             if (supp)
                 ++memoryChunksSupplemental;
-            return memoryChunks[memoryChunksFree];
+            return chunk;
         }
     }
 
-    void OracleAnalyzer::freeMemoryChunk(const char* module, uint8_t* chunk, bool supp) {
-        TRACE(TRACE2_MEMORY, "MEMORY: " << module << " - free at: " << std::dec << memoryChunksFree << "/" << memoryChunksAllocated);
+    void OracleAnalyzer::freeMemoryChunk(uint64_t module, uint8_t* chunk, bool supp) {
+        MemoryMagazine* magazine = getMemoryMagazine();
+        TRACE(TRACE2_MEMORY, "MEMORY: " << MEMORY_MODULE_NAME[module] << " - free at: " << std::dec << memoryChunksFree << "/" << memoryChunksAllocated);
 
-        {
-            std::unique_lock<std::mutex> lck(mtx);
+        --memoryModulesAllocated[module];
+        if (supp)
+            --memoryChunksSupplemental;
 
-            if (memoryChunksFree == memoryChunksAllocated) {
-                RUNTIME_FAIL("trying to free unknown memory block for: " << module);
-            }
+        if (magazinePut(magazine, chunk)) {
+            magazineCount(magazine->hits);
+            return;
+        }
+        magazineCount(magazine->misses);
 
-            //keep 25% reserved
-            if (memoryChunksAllocated > memoryChunksMin && memoryChunksFree > memoryChunksAllocated / 4) {
-                free(chunk);
-                --memoryChunksAllocated;
-            } else {
-                memoryChunks[memoryChunksFree] = chunk;
-                ++memoryChunksFree;
+        {
+            std::unique_lock<std::mutex> lck(mtx, std::defer_lock);
+            lockMemoryDepot(lck);
+
+            //drain magazine to the depot in a batch
+            for (uint64_t i = 0; i < MEMORY_MAGAZINE_BATCH; ++i) {
+                uint8_t* chunkDrained = magazineGet(magazine);
+                if (chunkDrained == nullptr)
+                    break;
+                releaseMemoryChunk(module, chunkDrained);
             }
-            if (supp)
-                --memoryChunksSupplemental;
+            if (!magazinePut(magazine, chunk))
+                releaseMemoryChunk(module, chunk);
         }
     }
 
@@ -18,8 +18,10 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
 #include <fstream>
+#include <mutex>
 #include <queue>
 #include <set>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -50,6 +52,15 @@ namespace OpenLogReplicator {
         bool operator()(RedoLog* const& p1, RedoLog* const& p2);
     };
 
+    //per-thread cache of memory chunks in front of the global pool, only the owning thread puts chunks in,
+    //the depot may take them out when reclaiming, so every slot is swapped atomically and no lock is needed
+    struct MemoryMagazine {
+        std::thread::id threadId;
+        std::atomic<uint8_t*> chunks[MEMORY_MAGAZINE_SIZE];
+        std::atomic<uint64_t> hits;
+        std::atomic<uint64_t> misses;
+    };
+
     class OracleAnalyzer : public Thread {
     protected:
         typeSEQ sequence;
@@ -68,7 +79,16 @@ namespace OpenLogReplicator {
         uint64_t memoryChunksFree;
         uint64_t memoryChunksMax;
         uint64_t memoryChunksHWM;
-        uint64_t memoryChunksSupplemental;
+        std::atomic<uint64_t> memoryChunksSupplemental;
+        std::vector<MemoryMagazine*> memoryMagazines;
+        uint64_t memoryAllocatorId;
+        std::atomic<uint64_t> memoryDepotLocks;
+        std::atomic<uint64_t> memoryDepotContended;
+        std::atomic<uint64_t> memoryModulesAllocated[MEMORY_MODULES_NUM];
+        std::atomic<uint64_t> memoryModulesHWM[MEMORY_MODULES_NUM];
+        std::atomic<uint64_t> memoryModulesAllocations[MEMORY_MODULES_NUM];
+        uint64_t memoryModulesAllocationsReported[MEMORY_MODULES_NUM];
+        time_t memoryReportLastTime;
         std::string nlsCharacterSet;
         std::string nlsNcharCharacterSet;
         std::string dbRecoveryFileDest;
@@ -109,6 +129,15 @@ namespace OpenLogReplicator {
         bool readerCheckRedoLog(Reader* reader);
         uint64_t readerDropAll(void);
         void updateResetlogs(void);
+        MemoryMagazine* getMemoryMagazine(void);
+        MemoryMagazine* findMemoryMagazine(void);
+        static uint8_t* magazineGet(MemoryMagazine* magazine);
+        static bool magazinePut(MemoryMagazine* magazine, uint8_t* chunk);
+        static void magazineCount(std::atomic<uint64_t>& counter);
+        void lockMemoryDepot(std::unique_lock<std::mutex>& lck);
+        void reclaimMemoryMagazines(void);
+        void releaseMemoryChunk(uint64_t module, uint8_t* chunk);
+        void waitMemoryQuota(uint64_t module);
         static uint64_t getSequenceFromFileName(OracleAnalyzer* oracleAnalyzer, const std::string& file);
         virtual const char* getModeName(void) const;
         virtual bool checkConnection(void);
@@ -148,6 +177,9 @@ namespace OpenLogReplicator {
         uint64_t archReadTries;
         uint64_t redoVerifyDelayUs;
         uint64_t refreshIntervalUs;
+        uint64_t memoryReportIntervalS;
+        uint64_t memoryModulesMax[MEMORY_MODULES_NUM];
+        static const char* MEMORY_MODULE_NAME[MEMORY_MODULES_NUM];
         SystemTransaction* systemTransaction;
         TransactionBuffer* transactionBuffer;
         typeRESETLOGS resetlogs;
@@ -156,6 +188,7 @@ namespace OpenLogReplicator {
         uint64_t stopCheckpoints;
         uint64_t stopTransactions;
         uint64_t transactionMax;
+        uint64_t transactionStreamMax;
         std::set<typeXID> skipXidList;
         std::set<typeXIDMAP> brokenXidMapList;
         bool stopFlushBuffer;
@@ -218,8 +251,9 @@ namespace OpenLogReplicator {
         void readCheckpoints(void);
         bool readCheckpoint(std::string& jsonName, typeSCN fileScn);
         void skipEmptyFields(RedoLogRecord* redoLogRecord, typeFIELD& fieldNum, uint64_t& fieldPos, uint16_t& fieldLength);
-        uint8_t* getMemoryChunk(const char* module, bool supp);
-        void freeMemoryChunk(const char* module, uint8_t* chunk, bool supp);
+        uint8_t* getMemoryChunk(uint64_t module, bool supp);
+        void freeMemoryChunk(uint64_t module, uint8_t* chunk, bool supp);
+        void reportMemoryUsage(bool force);
 
         bool nextFieldOpt(RedoLogRecord* redoLogRecord, typeFIELD& fieldNum, uint64_t& fieldPos, uint16_t& fieldLength, uint32_t code) {
             if (fieldNum >= redoLogRecord->fieldCnt)
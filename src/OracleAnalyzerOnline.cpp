@@ -756,7 +756,8 @@ namespace OpenLogReplicator {
         schemaScn = firstScn;
 
         for (SchemaElement* element : schema->elements)
-            createSchemaForTable(element->owner, element->table, element->keys, element->keysStr, element->options);
+            createSchemaForTable(element->owner, element->table, element->keys, element->keysStr, element->columns, element->columnsExclude,
+                    element->condition, element->options);
     }
 
     void OracleAnalyzerOnline::readSystemDictionariesDetails(typeUSER user, typeOBJ obj) {
@@ -1180,11 +1181,12 @@ namespace OpenLogReplicator {
         }
     }
 
-    void OracleAnalyzerOnline::createSchemaForTable(std::string& owner, std::string& table, std::vector<std::string>& keys, std::string& keysStr, typeOPTIONS options) {
+    void OracleAnalyzerOnline::createSchemaForTable(std::string& owner, std::string& table, std::vector<std::string>& keys, std::string& keysStr,
+            std::vector<std::string>& columns, bool columnsExclude, std::string& condition, typeOPTIONS options) {
         DEBUG("- creating table schema for owner: " << owner << " table: " << table << " options: " << (uint64_t) options);
 
         readSystemDictionaries(owner, table, options);
-        schema->buildMaps(owner, table, keys, keysStr, options, true);
+        schema->buildMaps(owner, table, keys, keysStr, columns, columnsExclude, condition, options, true);
         if ((options & OPTIONS_SYSTEM_TABLE) == 0 && schema->users.find(owner) == schema->users.end())
             schema->users.insert(owner);
     }
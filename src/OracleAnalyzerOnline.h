@@ -78,7 +78,8 @@ namespace OpenLogReplicator {
         virtual void createSchema(void);
         void readSystemDictionariesDetails(typeUSER user, typeOBJ obj);
         void readSystemDictionaries(std::string& owner, std::string& table, typeOPTIONS options);
-        void createSchemaForTable(std::string& owner, std::string& table, std::vector<std::string>& keys, std::string& keysStr, typeOPTIONS options);
+        void createSchemaForTable(std::string& owner, std::string& table, std::vector<std::string>& keys, std::string& keysStr,
+                std::vector<std::string>& columns, bool columnsExclude, std::string& condition, typeOPTIONS options);
         virtual void updateOnlineRedoLogData(void);
 
     public:
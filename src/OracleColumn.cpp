@@ -40,7 +40,8 @@ namespace OpenLogReplicator {
         nested(nested),
         unused(unused),
         added(added),
-        guard(guard) {
+        guard(guard),
+        characterSet(nullptr) {
     }
 
     OracleColumn::~OracleColumn() {
@@ -23,6 +23,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define ORACLECOLUMN_H_
 
 namespace OpenLogReplicator {
+    class CharacterSet;
+
     class OracleColumn {
     public:
         typeCOL colNo;
@@ -43,6 +45,10 @@ namespace OpenLogReplicator {
         bool unused;
         bool added;
         bool guard;
+        //pre-serialized JSON key, built on first use
+        std::string jsonKey;
+        //character set of the value, resolved on first use
+        CharacterSet* characterSet;
 
         OracleColumn(typeCOL colNo, typeCOL guardSegNo, typeCOL segColNo, std::string& name, uint64_t typeNo, uint64_t length, int64_t precision,
                 int64_t scale, typeCOL numPk, uint64_t charsetId, bool nullable, bool invisible, bool storedAsLob, bool constraint,
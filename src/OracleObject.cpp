@@ -20,6 +20,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "ConfigurationException.h"
 #include "OracleColumn.h"
 #include "OracleObject.h"
+#include "RowFilter.h"
 
 namespace OpenLogReplicator {
     OracleObject::OracleObject(typeOBJ obj, typeDATAOBJ dataObj, typeUSER user, typeCOL cluCols, typeOPTIONS options, std::string& owner, std::string& name) :
@@ -32,7 +33,9 @@ namespace OpenLogReplicator {
         maxSegCol(0),
         guardSegNo(-1),
         owner(owner),
-        name(name) {
+        name(name),
+        avroFingerprint(0),
+        filter(nullptr) {
 
         systemTable = 0;
         if (this->owner.compare("SYS") == 0) {
@@ -64,6 +67,11 @@ namespace OpenLogReplicator {
     }
 
     OracleObject::~OracleObject() {
+        if (filter != nullptr) {
+            delete filter;
+            filter = nullptr;
+        }
+
         for (OracleColumn* column: columns)
             delete column;
         pk.clear();
@@ -102,6 +110,35 @@ namespace OpenLogReplicator {
         }
     }
 
+    void OracleObject::setColumnsSkip(std::vector<std::string>& names, bool exclude) {
+        columnsSkip.assign((columns.size() + 63) >> 6, 0);
+        std::vector<bool> found(names.size(), false);
+
+        for (typeCOL i = 0; i < columns.size(); ++i) {
+            if (columns[i] == nullptr)
+                continue;
+
+            bool listed = false;
+            for (uint64_t j = 0; j < names.size(); ++j) {
+                if (columns[i]->name.compare(names[j]) == 0) {
+                    listed = true;
+                    found[j] = true;
+                    break;
+                }
+            }
+
+            //guard column is needed to decode the remaining ones
+            if (listed == exclude && !columns[i]->guard)
+                columnsSkip[i >> 6] |= ((uint64_t)1) << (i & 0x3F);
+        }
+
+        for (uint64_t j = 0; j < names.size(); ++j) {
+            if (!found[j]) {
+                WARNING("table " << owner << "." << name << ": column " << names[j] << " listed in projection does not exist");
+            }
+        }
+    }
+
     std::ostream& operator<<(std::ostream& os, const OracleObject& object) {
         os << "(\"" << object.owner << "\".\"" << object.name << "\", " << std::dec << object.obj << ", " <<
                 object.dataObj << ", " << object.cluCols << ", " << object.maxSegCol << ")" << std::endl;
@@ -26,6 +26,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 
 namespace OpenLogReplicator {
     class OracleColumn;
+    class RowFilter;
 
     class OracleObject {
     public:
@@ -44,10 +45,24 @@ namespace OpenLogReplicator {
         std::vector<uint16_t> pk;
         uint64_t systemTable;
         bool sys;
+        //pre-serialized JSON schema fragments, built on first use
+        std::string jsonSchema;
+        std::string jsonColumns;
+        //Avro schema and the columns it covers, built on first use
+        std::string avroSchema;
+        uint64_t avroFingerprint;
+        std::vector<typeCOL> avroColumns;
+        //projection: bit set for columns which are never decoded nor sent, 64 columns per entry
+        std::vector<uint64_t> columnsSkip;
+        RowFilter* filter;
 
         void addColumn(OracleColumn* column);
         void addPartition(typeOBJ partitionObj, typeDATAOBJ partitionDataObj);
         void updatePK(void);
+        void setColumnsSkip(std::vector<std::string>& names, bool exclude);
+        bool columnSkipped(typeCOL col) const {
+            return (col >> 6) < columnsSkip.size() && (columnsSkip[col >> 6] & (((uint64_t)1) << (col & 0x3F))) != 0;
+        }
 
         OracleObject(typeOBJ obj, typeDATAOBJ dataObj, typeUSER user, typeCOL cluCols, typeOPTIONS options, std::string& owner, std::string& name);
         virtual ~OracleObject();
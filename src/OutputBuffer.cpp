@@ -39,6 +39,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "OutputBuffer.h"
 #include "Reader.h"
 #include "RedoLogRecord.h"
+#include "RowFilter.h"
 #include "RowId.h"
 #include "Schema.h"
 #include "SystemTransaction.h"
@@ -46,9 +47,15 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     const char OutputBuffer::map64[65] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
     const char OutputBuffer::map16[17] = "0123456789abcdef";
+    const char OutputBuffer::numberPairs[201] =
+            "0001020304050607080910111213141516171819"
+            "2021222324252627282930313233343536373839"
+            "4041424344454647484950515253545556575859"
+            "6061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
 
     OutputBuffer::OutputBuffer(uint64_t messageFormat, uint64_t ridFormat, uint64_t xidFormat, uint64_t timestampFormat, uint64_t charFormat,
-            uint64_t scnFormat, uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType, uint64_t flushBuffer) :
+            uint64_t scnFormat, uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType, uint64_t numberFormat, uint64_t flushBuffer) :
         oracleAnalyzer(nullptr),
         messageFormat(messageFormat),
         ridFormat(ridFormat),
@@ -60,20 +67,40 @@ namespace OpenLogReplicator {
         schemaFormat(schemaFormat),
         columnFormat(columnFormat),
         unknownType(unknownType),
+        numberFormat(numberFormat),
         unconfirmedLength(0),
         messageLength(0),
         flushBuffer(flushBuffer),
+        batchRows(0),
+        batchBytes(0),
+        batchUs(0),
+        batchCount(0),
+        batchStart(0),
+        batchOpen(false),
         valueLength(0),
+        numberMantissa(0),
+        numberScale(0),
+        numberNative(false),
+        valueColumn(nullptr),
+        lastCivilKey(-1),
+        lastCivilDays(0),
         lastTime(0),
         lastScn(0),
         lastSequence(0),
         lastXid(0),
+        timeZoneKeys(nullptr),
+        timeZoneNames(nullptr),
+        timeZoneMultiplier(0),
+        timeZoneShift(32),
         valuesMax(0),
         mergesMax(0),
         id(0),
         num(0),
         transactionType(0),
+        rowCallback(nullptr),
         newTran(false),
+        provisional(false),
+        streamed(false),
         defaultCharacterMapId(0),
         defaultCharacterNcharMapId(0),
         writer(nullptr),
@@ -92,11 +119,19 @@ namespace OpenLogReplicator {
         }
         characterMap.clear();
         timeZoneMap.clear();
+        if (timeZoneKeys != nullptr) {
+            delete[] timeZoneKeys;
+            timeZoneKeys = nullptr;
+        }
+        if (timeZoneNames != nullptr) {
+            delete[] timeZoneNames;
+            timeZoneNames = nullptr;
+        }
         objects.clear();
 
         while (firstBuffer != nullptr) {
             OutputBufferQueue* nextBuffer = firstBuffer->next;
-            oracleAnalyzer->freeMemoryChunk("output buffer", (uint8_t*)firstBuffer, true);
+            oracleAnalyzer->freeMemoryChunk(MEMORY_MODULE_OUTPUT_BUFFER, (uint8_t*)firstBuffer, true);
             firstBuffer = nextBuffer;
             --buffersAllocated;
         }
@@ -847,6 +882,8 @@ namespace OpenLogReplicator {
         timeZoneMap[0x85b4] = "WET";
         timeZoneMap[0x8e48] = "W-SU";
         timeZoneMap[0xa070] = "Zulu";
+        buildTimeZoneHash();
+
         memset(valuesSet, 0, sizeof(valuesSet));
         memset(valuesMerge, 0, sizeof(valuesMerge));
         memset(values, 0, sizeof(values));
@@ -855,7 +892,7 @@ namespace OpenLogReplicator {
         this->oracleAnalyzer = oracleAnalyzer;
 
         buffersAllocated = 1;
-        firstBuffer = (OutputBufferQueue*) oracleAnalyzer->getMemoryChunk("output buffer", false);
+        firstBuffer = (OutputBufferQueue*) oracleAnalyzer->getMemoryChunk(MEMORY_MODULE_OUTPUT_BUFFER, false);
         firstBuffer->id = 0;
         firstBuffer->next = nullptr;
         firstBuffer->data = ((uint8_t*)firstBuffer) + sizeof(struct OutputBufferQueue);
@@ -863,20 +900,130 @@ namespace OpenLogReplicator {
         lastBuffer = firstBuffer;
     }
 
+    void OutputBuffer::buildTimeZoneHash(void) {
+        //search for a multiplicative hash without collisions, starting with a table of 4x the number of zones
+        uint64_t bits = 1;
+        while (((uint64_t)1 << bits) < timeZoneMap.size() * 4)
+            ++bits;
+
+        for (; bits <= 16; ++bits) {
+            uint64_t size = (uint64_t)1 << bits;
+            uint16_t* keys = new uint16_t[size];
+            const char** names = new const char*[size];
+            if (keys == nullptr || names == nullptr) {
+                RUNTIME_FAIL("couldn't allocate " << std::dec << (size * (sizeof(uint16_t) + sizeof(const char*))) << " bytes memory (for: time zone map)");
+            }
+
+            uint32_t multiplier = 0x9E3779B1;
+            for (uint64_t attempt = 0; attempt < 4096; ++attempt, multiplier += 2) {
+                memset(keys, 0, size * sizeof(uint16_t));
+                memset(names, 0, size * sizeof(const char*));
+                bool collision = false;
+
+                for (auto it : timeZoneMap) {
+                    uint64_t pos = ((uint32_t)(it.first * multiplier)) >> (32 - bits);
+                    if (keys[pos] != 0) {
+                        collision = true;
+                        break;
+                    }
+                    keys[pos] = it.first;
+                    names[pos] = it.second;
+                }
+
+                if (!collision) {
+                    timeZoneKeys = keys;
+                    timeZoneNames = names;
+                    timeZoneMultiplier = multiplier;
+                    timeZoneShift = 32 - bits;
+                    return;
+                }
+            }
+
+            delete[] keys;
+            delete[] names;
+        }
+
+        RUNTIME_FAIL("couldn't build time zone map");
+    }
+
+    int64_t OutputBuffer::daysFromCivil(int64_t year, int64_t month, int64_t day) {
+        //consecutive rows mostly share the same date, keep the last one
+        int64_t key = year * 512 + month * 32 + day;
+        if (key == lastCivilKey)
+            return lastCivilDays;
+
+        //days since 1970-01-01 in proleptic Gregorian calendar, year starting on March 1st
+        if (month <= 2)
+            --year;
+        int64_t era = (year >= 0 ? year : year - 399) / 400;
+        int64_t yearOfEra = year - era * 400;
+        int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+        lastCivilKey = key;
+        lastCivilDays = era * 146097 + dayOfEra - 719468;
+        return lastCivilDays;
+    }
+
+    uint64_t OutputBuffer::timestampToIso8601(char* buffer, struct tm& epochTime, uint64_t fraction) {
+        //2012-04-23T18:25:43.511Z - ISO 8601 format
+        //year is variable width, the rest is fixed width and written in place
+        uint64_t pos = 0;
+        uint64_t year;
+        if (epochTime.tm_year > 0)
+            year = epochTime.tm_year;
+        else
+            year = -epochTime.tm_year;
+
+        char yearBuffer[21];
+        uint64_t yearLength = 0;
+        do {
+            yearBuffer[yearLength++] = '0' + (year % 10);
+            year /= 10;
+        } while (year > 0);
+        while (yearLength > 0)
+            buffer[pos++] = yearBuffer[--yearLength];
+        if (epochTime.tm_year <= 0) {
+            buffer[pos++] = 'B';
+            buffer[pos++] = 'C';
+        }
+
+        buffer[pos++] = '-';
+        buffer[pos++] = '0' + epochTime.tm_mon / 10;
+        buffer[pos++] = '0' + epochTime.tm_mon % 10;
+        buffer[pos++] = '-';
+        buffer[pos++] = '0' + epochTime.tm_mday / 10;
+        buffer[pos++] = '0' + epochTime.tm_mday % 10;
+        buffer[pos++] = 'T';
+        buffer[pos++] = '0' + epochTime.tm_hour / 10;
+        buffer[pos++] = '0' + epochTime.tm_hour % 10;
+        buffer[pos++] = ':';
+        buffer[pos++] = '0' + epochTime.tm_min / 10;
+        buffer[pos++] = '0' + epochTime.tm_min % 10;
+        buffer[pos++] = ':';
+        buffer[pos++] = '0' + epochTime.tm_sec / 10;
+        buffer[pos++] = '0' + epochTime.tm_sec % 10;
+
+        if (fraction > 0) {
+            buffer[pos++] = '.';
+            for (uint64_t i = 9; i > 0; --i) {
+                buffer[pos + i - 1] = '0' + (fraction % 10);
+                fraction /= 10;
+            }
+            pos += 9;
+        }
+        return pos;
+    }
+
     void OutputBuffer::processValue(OracleObject* object, typeCOL col, const uint8_t* data, uint64_t length) {
         if (object == nullptr) {
-            std::string columnName("COL_" + std::to_string(col));
-            columnRaw(columnName, data, length);
+            valueColumn = nullptr;
+            valueRaw(col, unknownColumnName(col), data, length);
             return;
         }
         OracleColumn* column = object->columns[col];
-        if (column->constraint && (oracleAnalyzer->flags & REDO_FLAGS_SHOW_CONSTRAINT_COLUMNS) == 0)
-            return;
-        if (column->nested && (oracleAnalyzer->flags & REDO_FLAGS_SHOW_NESTED_COLUMNS) == 0)
-            return;
-        if (column->invisible && (oracleAnalyzer->flags & REDO_FLAGS_SHOW_INVISIBLE_COLUMNS) == 0)
-            return;
-        if (column->unused && (oracleAnalyzer->flags & REDO_FLAGS_SHOW_UNUSED_COLUMNS) == 0)
+        valueColumn = column;
+        if (!columnIncluded(column))
             return;
 
         uint64_t typeNo = column->typeNo;
@@ -898,19 +1045,23 @@ namespace OpenLogReplicator {
         switch(typeNo) {
         case 1: //varchar2/nvarchar2
         case 96: //char/nchar
-            parseString(data, length, charsetId);
-            columnString(column->name);
+            if (column->characterSet == nullptr)
+                column->characterSet = characterMap[charsetId];
+            parseString(data, length, column->characterSet, charsetId);
+            valueString(col, column->name);
             break;
 
         case 2: //number/float
-            parseNumber(data, length);
-            columnNumber(column->name, column->precision, column->scale);
+            if (parseNumber(data, length))
+                valueNumber(col, column->name, column->precision, column->scale);
+            else
+                columnUnknown(col, column->name, data, length);
             break;
 
         case 12:  //date
         case 180: //timestamp
             if (length != 7 && length != 11)
-                columnUnknown(column->name, data, length);
+                columnUnknown(col, column->name, data, length);
             else {
                 struct tm epochTime;
                 epochTime.tm_sec = data[6] - 1; //0..59
@@ -942,35 +1093,35 @@ namespace OpenLogReplicator {
                     epochTime.tm_hour < 0 || epochTime.tm_hour > 23 ||
                     epochTime.tm_mday < 1 || epochTime.tm_mday > 31 ||
                     epochTime.tm_mon < 1 || epochTime.tm_mon > 12) {
-                    columnUnknown(column->name, data, length);
+                    columnUnknown(col, column->name, data, length);
                 } else {
-                    columnTimestamp(column->name, epochTime, fraction, nullptr);
+                    valueTimestamp(col, column->name, epochTime, fraction, nullptr);
                 }
             }
             break;
 
         case 23: //raw
-            columnRaw(column->name, data, length);
+            valueRaw(col, column->name, data, length);
             break;
 
         case 100: //binary_float
             if (length == 4) {
-                columnFloat(column->name, *((float*) data));
+                valueFloat(col, column->name, *((float*) data));
             } else
-                columnUnknown(column->name, data, length);
+                columnUnknown(col, column->name, data, length);
             break;
 
         case 101: //binary_double
             if (length == 8) {
-                columnDouble(column->name, *((double*) data));
+                valueDouble(col, column->name, *((double*) data));
             } else
-                columnUnknown(column->name, data, length);
+                columnUnknown(col, column->name, data, length);
             break;
 
         //case 231: //timestamp with local time zone
         case 181: //timestamp with time zone
             if (length != 9 && length != 13) {
-                columnUnknown(column->name, data, length);
+                columnUnknown(col, column->name, data, length);
             } else {
                 struct tm epochTime;
                 epochTime.tm_sec = data[6] - 1; //0..59
@@ -1032,10 +1183,8 @@ namespace OpenLogReplicator {
                     tz = tz2;
                 } else {
                     uint16_t tzkey = (data[11] << 8) | data[12];
-                    auto it = timeZoneMap.find(tzkey);
-                    if (it != timeZoneMap.end())
-                        tz = it->second;
-                    else
+                    tz = findTimeZone(tzkey);
+                    if (tz == nullptr)
                         tz = "TZ?";
                 }
 
@@ -1044,21 +1193,78 @@ namespace OpenLogReplicator {
                     epochTime.tm_hour < 0 || epochTime.tm_hour > 23 ||
                     epochTime.tm_mday < 1 || epochTime.tm_mday > 31 ||
                     epochTime.tm_mon < 1 || epochTime.tm_mon > 12) {
-                    columnUnknown(column->name, data, length);
+                    columnUnknown(col, column->name, data, length);
                 } else {
-                    columnTimestamp(column->name, epochTime, fraction, tz);
+                    valueTimestamp(col, column->name, epochTime, fraction, tz);
                 }
             }
             break;
 
         default:
             if (unknownType == UNKNOWN_TYPE_SHOW)
-                columnUnknown(column->name, data, length);
+                columnUnknown(col, column->name, data, length);
         }
     };
 
+    //values go to the row callback when it is set, otherwise they are formatted into the message
+    void OutputBuffer::valueString(typeCOL col, std::string& columnName) {
+        if (rowCallback != nullptr)
+            rowCallback->rowString(col, valueBuffer, valueLength);
+        else
+            columnString(columnName);
+    }
+
+    void OutputBuffer::valueNumber(typeCOL col, std::string& columnName, uint64_t precision, uint64_t scale) {
+        if (rowCallback != nullptr)
+            rowCallback->rowString(col, valueBuffer, valueLength);
+        else
+            columnNumber(columnName, precision, scale);
+    }
+
+    void OutputBuffer::valueRaw(typeCOL col, std::string& columnName, const uint8_t* data, uint64_t length) {
+        if (rowCallback != nullptr)
+            rowCallback->rowBytes(col, data, length);
+        else
+            columnRaw(columnName, data, length);
+    }
+
+    //timestamp with time zone is passed as text, without as microseconds since epoch
+    void OutputBuffer::valueTimestamp(typeCOL col, std::string& columnName, struct tm& epochTime, uint64_t fraction, const char* tz) {
+        if (rowCallback == nullptr) {
+            columnTimestamp(columnName, epochTime, fraction, tz);
+            return;
+        }
+
+        if (tz != nullptr) {
+            valueLength = timestampToIso8601(valueBuffer, epochTime, fraction);
+            valueBuffer[valueLength++] = ' ';
+            uint64_t tzLength = strlen(tz);
+            memcpy(valueBuffer + valueLength, tz, tzLength);
+            valueLength += tzLength;
+            rowCallback->rowString(col, valueBuffer, valueLength);
+        } else {
+            int64_t seconds = daysFromCivil(epochTime.tm_year, epochTime.tm_mon, epochTime.tm_mday) * 86400 +
+                    epochTime.tm_hour * 3600 + epochTime.tm_min * 60 + epochTime.tm_sec;
+            rowCallback->rowTimestamp(col, seconds * 1000000 + fraction / 1000);
+        }
+    }
+
+    void OutputBuffer::valueFloat(typeCOL col, std::string& columnName, float value) {
+        if (rowCallback != nullptr)
+            rowCallback->rowFloat(col, value);
+        else
+            columnFloat(columnName, value);
+    }
+
+    void OutputBuffer::valueDouble(typeCOL col, std::string& columnName, double value) {
+        if (rowCallback != nullptr)
+            rowCallback->rowDouble(col, value);
+        else
+            columnDouble(columnName, value);
+    }
+
     void OutputBuffer::outputBufferRotate(bool copy) {
-        OutputBufferQueue* nextBuffer = (OutputBufferQueue*) oracleAnalyzer->getMemoryChunk("output buffer", true);
+        OutputBufferQueue* nextBuffer = (OutputBufferQueue*) oracleAnalyzer->getMemoryChunk(MEMORY_MODULE_OUTPUT_BUFFER, true);
         nextBuffer->next = nullptr;
         nextBuffer->id = lastBuffer->id + 1;
         nextBuffer->data = ((uint8_t*)nextBuffer) + sizeof(struct OutputBufferQueue);
@@ -1081,6 +1287,45 @@ namespace OpenLogReplicator {
         }
     };
 
+    //messages across transactions are packed into one output message, commit markers stay inside
+    void OutputBuffer::outputBufferBatchBegin(void) {
+        batchOpen = true;
+        batchCount = 0;
+        batchStart = oracleAnalyzer->getTime();
+        appendBatchBegin();
+    }
+
+    void OutputBuffer::outputBufferBatchEnd(void) {
+        appendBatchEnd();
+        batchOpen = false;
+        msg->scn = lastScn;
+        msg->sequence = lastSequence;
+    }
+
+    bool OutputBuffer::outputBufferBatchFull(void) {
+        if (batchCount >= batchRows || messageLength >= batchBytes)
+            return true;
+        return (uint64_t)(oracleAnalyzer->getTime() - batchStart) >= batchUs;
+    }
+
+    void OutputBuffer::appendBatchBegin(void) {
+    }
+
+    void OutputBuffer::appendBatchSeparator(void) {
+    }
+
+    void OutputBuffer::appendBatchEnd(void) {
+    }
+
+    //called when there is no more redo data to process
+    void OutputBuffer::outputBufferFlush(void) {
+        if (!batchOpen)
+            return;
+
+        outputBufferBatchEnd();
+        outputBufferCommit(true);
+    }
+
     uint64_t OutputBuffer::outputBufferSize(void) const {
         return ((messageLength + 7) & 0xFFFFFFFFFFFFFFF8) + sizeof(struct OutputBufferMsg);
     }
@@ -1089,6 +1334,16 @@ namespace OpenLogReplicator {
         this->writer = writer;
     }
 
+    void OutputBuffer::setRowCallback(RowCallback* rowCallback) {
+        this->rowCallback = rowCallback;
+    }
+
+    void OutputBuffer::setBatch(uint64_t batchRows, uint64_t batchBytes, uint64_t batchUs) {
+        this->batchRows = batchRows;
+        this->batchBytes = batchBytes;
+        this->batchUs = batchUs;
+    }
+
     void OutputBuffer::setNlsCharset(std::string& nlsCharset, std::string& nlsNcharCharset) {
         INFO("loading character mapping for " << nlsCharset);
 
@@ -1116,14 +1371,174 @@ namespace OpenLogReplicator {
         }
     }
 
+    void OutputBuffer::releaseObject(OracleObject* object) {
+        //object is about to be deleted, schema must be sent again for the new definition
+        objects.erase(object);
+        if (rowCallback != nullptr)
+            rowCallback->releaseObject(object);
+    }
+
+    bool OutputBuffer::columnIncluded(OracleColumn* column) const {
+        if (column == nullptr)
+            return false;
+        if (column->constraint && (oracleAnalyzer->flags & REDO_FLAGS_SHOW_CONSTRAINT_COLUMNS) == 0)
+            return false;
+        if (column->nested && (oracleAnalyzer->flags & REDO_FLAGS_SHOW_NESTED_COLUMNS) == 0)
+            return false;
+        if (column->invisible && (oracleAnalyzer->flags & REDO_FLAGS_SHOW_INVISIBLE_COLUMNS) == 0)
+            return false;
+        if (column->unused && (oracleAnalyzer->flags & REDO_FLAGS_SHOW_UNUSED_COLUMNS) == 0)
+            return false;
+        return true;
+    }
+
     void OutputBuffer::processBegin(typeSCN scn, typeTIME time_, typeSEQ sequence, typeXID xid) {
+        processBegin(scn, time_, sequence, xid, false, false);
+    }
+
+    void OutputBuffer::processBegin(typeSCN scn, typeTIME time_, typeSEQ sequence, typeXID xid, bool provisional_, bool streamed_) {
+        //provisional batches keep position of last commit, checkpoint must not pass uncommitted data
+        if (!provisional_) {
+            lastScn = scn;
+            lastSequence = sequence;
+        }
         lastTime = time_;
-        lastScn = scn;
-        lastSequence = sequence;
         lastXid = xid;
+        provisional = provisional_;
+        streamed = streamed_;
         newTran = true;
     }
 
+    void OutputBuffer::processRollback(typeTIME time_, typeXID xid) {
+        lastTime = time_;
+        lastXid = xid;
+        provisional = false;
+        streamed = true;
+        newTran = false;
+        processRollback();
+    }
+
+    //drop values of columns excluded by table projection before they are merged or decoded,
+    //columns used by row filter are dropped only after the filter is evaluated
+    void OutputBuffer::valuesProject(OracleObject* object, bool filtered) {
+        if (object == nullptr || object->columnsSkip.size() == 0)
+            return;
+
+        uint64_t baseMax = valuesMax >> 6;
+        if (baseMax >= object->columnsSkip.size())
+            baseMax = object->columnsSkip.size() - 1;
+        for (uint64_t base = 0; base <= baseMax; ++base) {
+            uint64_t skip = valuesSet[base] & object->columnsSkip[base];
+            if (!filtered && object->filter != nullptr && base < object->filter->columns.size())
+                skip &= ~object->filter->columns[base];
+            if (skip == 0)
+                continue;
+
+            typeCOL column = base << 6;
+            for (uint64_t mask = 1; mask != 0; mask <<= 1, ++column) {
+                if (skip < mask)
+                    break;
+                if ((skip & mask) == 0)
+                    continue;
+
+                for (uint64_t j = 0; j < 4; ++j) {
+                    values[column][j] = nullptr;
+                    valuesPart[0][column][j] = nullptr;
+                    valuesPart[1][column][j] = nullptr;
+                    valuesPart[2][column][j] = nullptr;
+                }
+            }
+            valuesSet[base] &= ~skip;
+            valuesMerge[base] &= ~skip;
+        }
+    }
+
+    //compare before and after image of a column on raw bytes, parts of split values are compared without merging
+    bool OutputBuffer::valuesEqual(typeCOL column) {
+        const uint8_t* data[2][3];
+        uint64_t length[2][3];
+        uint64_t pieces[2] = {0, 0};
+        uint64_t total[2] = {0, 0};
+
+        for (uint64_t i = 0; i < 2; ++i) {
+            uint64_t type = (i == 0) ? VALUE_BEFORE : VALUE_AFTER;
+            if (values[column][type] != nullptr) {
+                data[i][0] = values[column][type];
+                length[i][0] = lengths[column][type];
+                pieces[i] = 1;
+            } else {
+                for (uint64_t j = 0; j < 3; ++j) {
+                    if (valuesPart[j][column][type] == nullptr || lengthsPart[j][column][type] == 0)
+                        continue;
+                    data[i][pieces[i]] = valuesPart[j][column][type];
+                    length[i][pieces[i]] = lengthsPart[j][column][type];
+                    ++pieces[i];
+                }
+                //value not present in this image, can't tell if changed
+                if (pieces[i] == 0)
+                    return false;
+            }
+
+            for (uint64_t j = 0; j < pieces[i]; ++j)
+                total[i] += length[i][j];
+        }
+
+        if (total[0] != total[1])
+            return false;
+
+        uint64_t piece0 = 0, piece1 = 0, pos0 = 0, pos1 = 0;
+        while (piece0 < pieces[0] && piece1 < pieces[1]) {
+            uint64_t left0 = length[0][piece0] - pos0;
+            uint64_t left1 = length[1][piece1] - pos1;
+            uint64_t chunk = (left0 < left1) ? left0 : left1;
+
+            if (chunk > 0 && memcmp(data[0][piece0] + pos0, data[1][piece1] + pos1, chunk) != 0)
+                return false;
+
+            pos0 += chunk;
+            pos1 += chunk;
+            if (pos0 == length[0][piece0]) {
+                ++piece0;
+                pos0 = 0;
+            }
+            if (pos1 == length[1][piece1]) {
+                ++piece1;
+                pos1 = 0;
+            }
+        }
+        return true;
+    }
+
+    //drop non-key columns with identical before and after image, before they are merged
+    void OutputBuffer::valuesSkipUnchanged(OracleObject* object) {
+        uint64_t baseMax = valuesMax >> 6;
+        for (uint64_t base = 0; base <= baseMax; ++base) {
+            typeCOL column = base << 6;
+            for (uint64_t mask = 1; mask != 0; mask <<= 1, ++column) {
+                if (valuesSet[base] < mask)
+                    break;
+                if ((valuesSet[base] & mask) == 0)
+                    continue;
+                if (object->columns[column]->numPk > 0 || column == object->guardSegNo)
+                    continue;
+                //needed by row filter, removed later with other unchanged columns
+                if (object->filter != nullptr && object->filter->hasColumn(column))
+                    continue;
+                if (!valuesEqual(column))
+                    continue;
+
+                for (uint64_t j = 0; j < 4; ++j) {
+                    values[column][j] = nullptr;
+                    valuesPart[0][column][j] = nullptr;
+                    valuesPart[1][column][j] = nullptr;
+                    valuesPart[2][column][j] = nullptr;
+                }
+                valuesSet[base] &= ~mask;
+                valuesMerge[base] &= ~mask;
+            }
+        }
+    }
+
     //0x05010B0B
     void OutputBuffer::processInsertMultiple(RedoLogRecord* redoLogRecord1, RedoLogRecord* redoLogRecord2, bool system) {
         uint64_t pos = 0;
@@ -1175,7 +1590,8 @@ namespace OpenLogReplicator {
                     }
                 }
 
-                if (colLength > 0 || columnFormat >= COLUMN_FORMAT_FULL_INS_DEC || object == nullptr || object->columns[i]->numPk > 0)
+                if ((colLength > 0 || columnFormat >= COLUMN_FORMAT_FULL_INS_DEC || object == nullptr || object->columns[i]->numPk > 0) &&
+                        (object == nullptr || !object->columnSkipped(i) || (object->filter != nullptr && object->filter->hasColumn(i))))
                     valueSet(VALUE_AFTER, i, redoLogRecord2->data + fieldPos + pos, colLength, 0);
                 pos += colLength;
             }
@@ -1184,11 +1600,12 @@ namespace OpenLogReplicator {
                 oracleAnalyzer->systemTransaction->processInsert(object, redoLogRecord2->dataObj, redoLogRecord2->bdba,
                         oracleAnalyzer->read16(redoLogRecord2->data + redoLogRecord2->slotsDelta + r * 2), redoLogRecord1->xid);
                 if ((oracleAnalyzer->flags & REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS) != 0)
-                    processInsert(object, redoLogRecord2->dataObj, redoLogRecord2->bdba,
+                    processRow(TRANSACTION_INSERT, object, redoLogRecord2->dataObj, redoLogRecord2->bdba,
                             oracleAnalyzer->read16(redoLogRecord2->data + redoLogRecord2->slotsDelta + r * 2), redoLogRecord1->xid);
-            } else {
+            } else if (object == nullptr || object->filter == nullptr || object->filter->evaluate(values, lengths, TRANSACTION_INSERT)) {
+                valuesProject(object, true);
                 if (object == nullptr || (object->options & OPTIONS_DEBUG_TABLE) == 0)
-                    processInsert(object, redoLogRecord2->dataObj, redoLogRecord2->bdba,
+                    processRow(TRANSACTION_INSERT, object, redoLogRecord2->dataObj, redoLogRecord2->bdba,
                             oracleAnalyzer->read16(redoLogRecord2->data + redoLogRecord2->slotsDelta + r * 2), redoLogRecord1->xid);
             }
 
@@ -1249,7 +1666,8 @@ namespace OpenLogReplicator {
                     }
                 }
 
-                if (colLength > 0 || columnFormat >= COLUMN_FORMAT_FULL_INS_DEC || object == nullptr || object->columns[i]->numPk > 0)
+                if ((colLength > 0 || columnFormat >= COLUMN_FORMAT_FULL_INS_DEC || object == nullptr || object->columns[i]->numPk > 0) &&
+                        (object == nullptr || !object->columnSkipped(i) || (object->filter != nullptr && object->filter->hasColumn(i))))
                     valueSet(VALUE_BEFORE, i, redoLogRecord1->data + fieldPos + pos, colLength, 0);
                 pos += colLength;
             }
@@ -1258,11 +1676,12 @@ namespace OpenLogReplicator {
                 oracleAnalyzer->systemTransaction->processDelete(object, redoLogRecord2->dataObj, redoLogRecord2->bdba,
                         oracleAnalyzer->read16(redoLogRecord1->data + redoLogRecord1->slotsDelta + r * 2), redoLogRecord1->xid);
                 if ((oracleAnalyzer->flags & REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS) != 0)
-                    processDelete(object, redoLogRecord2->dataObj, redoLogRecord2->bdba,
+                    processRow(TRANSACTION_DELETE, object, redoLogRecord2->dataObj, redoLogRecord2->bdba,
                             oracleAnalyzer->read16(redoLogRecord1->data + redoLogRecord1->slotsDelta + r * 2), redoLogRecord1->xid);
-            } else {
+            } else if (object == nullptr || object->filter == nullptr || object->filter->evaluate(values, lengths, TRANSACTION_DELETE)) {
+                valuesProject(object, true);
                 if (object == nullptr || (object->options & OPTIONS_DEBUG_TABLE) == 0)
-                    processDelete(object, redoLogRecord2->dataObj, redoLogRecord2->bdba,
+                    processRow(TRANSACTION_DELETE, object, redoLogRecord2->dataObj, redoLogRecord2->bdba,
                             oracleAnalyzer->read16(redoLogRecord1->data + redoLogRecord1->slotsDelta + r * 2), redoLogRecord1->xid);
             }
 
@@ -1571,6 +1990,13 @@ namespace OpenLogReplicator {
         if (object != nullptr && object->guardSegNo != -1)
             guardPos = object->guardSegNo;
 
+        valuesProject(object, false);
+
+        bool skipNoop = type == TRANSACTION_UPDATE && !system && object != nullptr && columnFormat < COLUMN_FORMAT_FULL_UPD &&
+                (oracleAnalyzer->flags & REDO_FLAGS_SKIP_NOOP_UPDATES) != 0;
+        if (skipNoop)
+            valuesSkipUnchanged(object);
+
         uint64_t baseMax = valuesMax >> 6;
         for (uint64_t base = 0; base <= baseMax; ++base) {
             typeCOL column = base << 6;
@@ -1721,6 +2147,15 @@ namespace OpenLogReplicator {
             }
         }
 
+        //row filter, evaluated before any value is decoded
+        if (!system && object != nullptr && object->filter != nullptr) {
+            if (!object->filter->evaluate(values, lengths, type)) {
+                valuesRelease();
+                return;
+            }
+            valuesProject(object, true);
+        }
+
         if (type == TRANSACTION_UPDATE) {
             uint64_t baseMax = valuesMax >> 6;
             for (uint64_t base = 0; base <= baseMax; ++base) {
@@ -1791,14 +2226,41 @@ namespace OpenLogReplicator {
                 }
             }
 
+            //drop update which changes no column value
+            if (skipNoop) {
+                bool changed = false;
+                for (uint64_t base = 0; base <= baseMax && !changed; ++base) {
+                    typeCOL column = base << 6;
+                    for (uint64_t mask = 1; mask != 0; mask <<= 1, ++column) {
+                        if (valuesSet[base] < mask)
+                            break;
+                        if ((valuesSet[base] & mask) == 0)
+                            continue;
+                        if (column == object->guardSegNo)
+                            continue;
+                        if (object->columns[column]->numPk == 0 || lengths[column][VALUE_BEFORE] != lengths[column][VALUE_AFTER] ||
+                                (lengths[column][VALUE_BEFORE] > 0 &&
+                                memcmp(values[column][VALUE_BEFORE], values[column][VALUE_AFTER], lengths[column][VALUE_BEFORE]) != 0)) {
+                            changed = true;
+                            break;
+                        }
+                    }
+                }
+
+                if (!changed) {
+                    TRACE(TRACE2_DML, "DML: skipping unchanged update of " << object->owner << "." << object->name);
+                    valuesRelease();
+                    return;
+                }
+            }
 
             if (system) {
                 oracleAnalyzer->systemTransaction->processUpdate(object, dataObj, bdba, slot, redoLogRecord1->xid);
                 if ((oracleAnalyzer->flags & REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS) != 0)
-                    processUpdate(object, dataObj, bdba, slot, redoLogRecord1->xid);
+                    processRow(TRANSACTION_UPDATE, object, dataObj, bdba, slot, redoLogRecord1->xid);
             } else {
                 if (object == nullptr || (object->options & OPTIONS_DEBUG_TABLE) == 0)
-                    processUpdate(object, dataObj, bdba, slot, redoLogRecord1->xid);
+                    processRow(TRANSACTION_UPDATE, object, dataObj, bdba, slot, redoLogRecord1->xid);
             }
 
         } else if (type == TRANSACTION_INSERT) {
@@ -1852,10 +2314,10 @@ namespace OpenLogReplicator {
             if (system) {
                 oracleAnalyzer->systemTransaction->processInsert(object, dataObj, bdba, slot, redoLogRecord1->xid);
                 if ((oracleAnalyzer->flags & REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS) != 0)
-                    processInsert(object, dataObj, bdba, slot, redoLogRecord1->xid);
+                    processRow(TRANSACTION_INSERT, object, dataObj, bdba, slot, redoLogRecord1->xid);
             } else {
                 if (object == nullptr || (object->options & OPTIONS_DEBUG_TABLE) == 0)
-                    processInsert(object, dataObj, bdba, slot, redoLogRecord1->xid);
+                    processRow(TRANSACTION_INSERT, object, dataObj, bdba, slot, redoLogRecord1->xid);
             }
 
         } else if (type == TRANSACTION_DELETE) {
@@ -1909,16 +2371,104 @@ namespace OpenLogReplicator {
             if (system) {
                 oracleAnalyzer->systemTransaction->processDelete(object, dataObj, bdba, slot, redoLogRecord1->xid);
                 if ((oracleAnalyzer->flags & REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS) != 0)
-                    processDelete(object, dataObj, bdba, slot, redoLogRecord1->xid);
+                    processRow(TRANSACTION_DELETE, object, dataObj, bdba, slot, redoLogRecord1->xid);
             } else {
                 if (object == nullptr || (object->options & OPTIONS_DEBUG_TABLE) == 0)
-                    processDelete(object, dataObj, bdba, slot, redoLogRecord1->xid);
+                    processRow(TRANSACTION_DELETE, object, dataObj, bdba, slot, redoLogRecord1->xid);
             }
         }
 
         valuesRelease();
     }
 
+    //row of processDML, passed to the row callback when it is set, otherwise formatted as a message
+    void OutputBuffer::processRow(uint64_t type, OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) {
+        if (rowCallback == nullptr) {
+            switch (type) {
+            case TRANSACTION_INSERT:
+                processInsert(object, dataObj, bdba, slot, xid);
+                break;
+
+            case TRANSACTION_DELETE:
+                processDelete(object, dataObj, bdba, slot, xid);
+                break;
+
+            case TRANSACTION_UPDATE:
+                processUpdate(object, dataObj, bdba, slot, xid);
+                break;
+
+            case TRANSACTION_UNDO:
+                processUndo(object, dataObj, bdba, slot, xid);
+                break;
+            }
+            return;
+        }
+
+        //begin and commit are still sent as messages, the writer confirms them once the rows are stored
+        if (newTran)
+            processBegin();
+
+        rowCallback->rowBegin(object, dataObj, bdba, slot, type, lastScn, lastTime, lastXid, provisional, num);
+        if (type == TRANSACTION_DELETE || type == TRANSACTION_UPDATE)
+            processRowImage(object, VALUE_BEFORE);
+        if (type == TRANSACTION_INSERT || type == TRANSACTION_UPDATE)
+            processRowImage(object, VALUE_AFTER);
+        rowCallback->rowEnd();
+        ++num;
+    }
+
+    //columns not present in redo are not passed
+    void OutputBuffer::processRowImage(OracleObject* object, uint64_t type) {
+        rowCallback->rowImage(type);
+
+        uint64_t baseMax = valuesMax >> 6;
+        for (uint64_t base = 0; base <= baseMax; ++base) {
+            typeCOL column = base << 6;
+            for (uint64_t mask = 1; mask != 0; mask <<= 1, ++column) {
+                if (valuesSet[base] < mask)
+                    break;
+                if ((valuesSet[base] & mask) == 0)
+                    continue;
+
+                if (values[column][type] != nullptr) {
+                    if (lengths[column][type] > 0)
+                        processValue(object, column, values[column][type], lengths[column][type]);
+                    else
+                        rowCallback->rowNull(column);
+                }
+            }
+        }
+    }
+
+    //rollback to savepoint of rows already sent with a streamed batch, one message per row changed by the reverted redo record
+    void OutputBuffer::processUndo(RedoLogRecord* redoLogRecord) {
+        OracleObject* object = oracleAnalyzer->schema->checkDict(redoLogRecord->obj, redoLogRecord->dataObj);
+        if (object != nullptr && (object->options & OPTIONS_DEBUG_TABLE) != 0)
+            return;
+
+        switch (redoLogRecord->opCode) {
+        //insert, delete, update or overwrite of a row piece
+        case 0x0B02:
+        case 0x0B03:
+        case 0x0B05:
+        case 0x0B06:
+            processRow(TRANSACTION_UNDO, object, redoLogRecord->dataObj, redoLogRecord->bdba, redoLogRecord->slot, lastXid);
+            break;
+
+        //insert or delete of multiple rows
+        case 0x0B0B:
+        case 0x0B0C:
+            for (uint64_t r = 0; r < redoLogRecord->nrow; ++r)
+                processRow(TRANSACTION_UNDO, object, redoLogRecord->dataObj, redoLogRecord->bdba,
+                        oracleAnalyzer->read16(redoLogRecord->data + redoLogRecord->slotsDelta + r * 2), lastXid);
+            break;
+
+        //supplemental log and logminer support records don't change rows
+        default:
+            break;
+        }
+    }
+
     //0x18010000
     void OutputBuffer::processDDLheader(RedoLogRecord* redoLogRecord1) {
         uint64_t fieldPos = 0;
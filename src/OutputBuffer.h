@@ -21,6 +21,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "types.h"
 #include "CharacterSet.h"
@@ -33,6 +34,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     class CharacterSet;
     class OracleAnalyzer;
+    class OracleColumn;
     class OracleObject;
     class RedoLogRecord;
     class Writer;
@@ -57,10 +59,29 @@ namespace OpenLogReplicator {
         uint16_t flags;
     };
 
+    //rows decoded by processDML for writers which store them without formatted messages, called by the analyzer thread
+    class RowCallback {
+    public:
+        virtual ~RowCallback() {};
+
+        virtual void rowBegin(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, uint64_t type, typeSCN scn, typeTIME time_,
+                typeXID xid, bool provisional, uint64_t num) = 0;
+        virtual void rowImage(uint64_t type) = 0;
+        virtual void rowNull(typeCOL col) = 0;
+        virtual void rowString(typeCOL col, const char* data, uint64_t length) = 0;
+        virtual void rowBytes(typeCOL col, const uint8_t* data, uint64_t length) = 0;
+        virtual void rowTimestamp(typeCOL col, int64_t micros) = 0;
+        virtual void rowFloat(typeCOL col, float value) = 0;
+        virtual void rowDouble(typeCOL col, double value) = 0;
+        virtual void rowEnd(void) = 0;
+        virtual void releaseObject(OracleObject* object) = 0;
+    };
+
     class OutputBuffer {
     protected:
         static const char map64[65];
         static const char map16[17];
+        static const char numberPairs[201];
         OracleAnalyzer* oracleAnalyzer;
         uint64_t messageFormat;
         uint64_t ridFormat;
@@ -72,12 +93,30 @@ namespace OpenLogReplicator {
         uint64_t schemaFormat;
         uint64_t columnFormat;
         uint64_t unknownType;
+        uint64_t numberFormat;
         uint64_t unconfirmedLength;
         uint64_t messageLength;
         uint64_t flushBuffer;
+        uint64_t batchRows;
+        uint64_t batchBytes;
+        uint64_t batchUs;
+        uint64_t batchCount;
+        time_t batchStart;
+        bool batchOpen;
         char valueBuffer[MAX_FIELD_LENGTH];
         uint64_t valueLength;
+        int64_t numberMantissa;
+        uint64_t numberScale;
+        bool numberNative;
+        OracleColumn* valueColumn;
+        int64_t lastCivilKey;
+        int64_t lastCivilDays;
+        std::vector<std::string> unknownColumnNames;
         std::unordered_map<uint16_t, const char*> timeZoneMap;
+        uint16_t* timeZoneKeys;
+        const char** timeZoneNames;
+        uint32_t timeZoneMultiplier;
+        uint64_t timeZoneShift;
         std::unordered_set<OracleObject*> objects;
         typeTIME lastTime;
         typeSCN lastScn;
@@ -96,10 +135,46 @@ namespace OpenLogReplicator {
         uint64_t id;
         uint64_t num;
         uint64_t transactionType;
+        RowCallback* rowCallback;
         bool newTran;
+        bool provisional;
+        bool streamed;
 
         void outputBufferRotate(bool copy);
+        void outputBufferBatchBegin(void);
+        void outputBufferBatchEnd(void);
+        bool outputBufferBatchFull(void);
+        virtual void appendBatchBegin(void);
+        virtual void appendBatchSeparator(void);
+        virtual void appendBatchEnd(void);
         void processValue(OracleObject* object, typeCOL col, const uint8_t* data, uint64_t length);
+        void valueString(typeCOL col, std::string& columnName);
+        void valueNumber(typeCOL col, std::string& columnName, uint64_t precision, uint64_t scale);
+        void valueRaw(typeCOL col, std::string& columnName, const uint8_t* data, uint64_t length);
+        void valueTimestamp(typeCOL col, std::string& columnName, struct tm& epochTime, uint64_t fraction, const char* tz);
+        void valueFloat(typeCOL col, std::string& columnName, float value);
+        void valueDouble(typeCOL col, std::string& columnName, double value);
+        void processRow(uint64_t type, OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
+        void processRowImage(OracleObject* object, uint64_t type);
+        void valuesProject(OracleObject* object, bool filtered);
+        void valuesSkipUnchanged(OracleObject* object);
+        bool valuesEqual(typeCOL column);
+        void buildTimeZoneHash(void);
+        int64_t daysFromCivil(int64_t year, int64_t month, int64_t day);
+        uint64_t timestampToIso8601(char* buffer, struct tm& epochTime, uint64_t fraction);
+
+        std::string& unknownColumnName(typeCOL col) {
+            while (unknownColumnNames.size() <= (uint64_t)col)
+                unknownColumnNames.push_back("COL_" + std::to_string(unknownColumnNames.size()));
+            return unknownColumnNames[col];
+        }
+
+        const char* findTimeZone(uint16_t key) const {
+            uint64_t pos = ((uint32_t)(key * timeZoneMultiplier)) >> timeZoneShift;
+            if (timeZoneKeys[pos] == key)
+                return timeZoneNames[pos];
+            return nullptr;
+        }
 
         void valuesRelease() {
             for (uint64_t i = 0; i < mergesMax; ++i)
@@ -125,6 +200,7 @@ namespace OpenLogReplicator {
             valuesMax = 0;
         };
 
+
         void valueSet(uint64_t type, uint16_t column, uint8_t* data, uint16_t length, uint8_t fb) {
             if ((trace2 & TRACE2_DML) != 0) {
                 std::stringstream strStr;
@@ -182,9 +258,18 @@ namespace OpenLogReplicator {
         };
 
         void outputBufferBegin(typeOBJ obj) {
-            messageLength = 0;
             transactionType = 0;
 
+            //next message of an open batch goes to the same output message
+            if (batchOpen) {
+                if (msg->obj != obj)
+                    msg->obj = 0;
+                appendBatchSeparator();
+                return;
+            }
+
+            messageLength = 0;
+
             if (lastBuffer->length + sizeof(struct OutputBufferMsg) >= OUTPUT_BUFFER_DATA_SIZE)
                 outputBufferRotate(true);
 
@@ -199,6 +284,9 @@ namespace OpenLogReplicator {
             msg->pos = 0;
             msg->flags = 0;
             msg->data = lastBuffer->data + lastBuffer->length;
+
+            if ((messageFormat & MESSAGE_FORMAT_BATCH) != 0)
+                outputBufferBatchBegin();
         };
 
         void outputBufferCommit(bool force) {
@@ -206,6 +294,14 @@ namespace OpenLogReplicator {
                 WARNING("JSON buffer - commit of empty transaction");
             }
 
+            if (batchOpen) {
+                ++batchCount;
+                if (!outputBufferBatchFull())
+                    return;
+                outputBufferBatchEnd();
+                force = true;
+            }
+
             msg->queueId = lastBuffer->id;
             outputBufferShift((8 - (messageLength & 7)) & 7, false);
             unconfirmedLength += messageLength;
@@ -228,29 +324,44 @@ namespace OpenLogReplicator {
         };
 
         void outputBufferAppend(const char* str, uint64_t length) {
-            for (uint64_t i = 0; i < length; ++i)
-                outputBufferAppend(*str++);
+            //copy up to the end of the chunk, rotate only at the boundary
+            while (length > 0) {
+                uint64_t size = OUTPUT_BUFFER_DATA_SIZE - lastBuffer->length;
+                if (size > length)
+                    size = length;
+
+                memcpy(lastBuffer->data + lastBuffer->length, str, size);
+                messageLength += size;
+                outputBufferShift(size, true);
+                str += size;
+                length -= size;
+            }
         };
 
         void outputBufferAppend(const char* str) {
-            char character = *str++;
-            while (character != 0) {
-                outputBufferAppend(character);
-                character = *str++;
-            }
+            outputBufferAppend(str, strlen(str));
         };
 
         void outputBufferAppend(std::string& str) {
-            const char* charstr = str.c_str();
-            uint64_t length = str.length();
-            for (uint64_t i = 0; i < length; ++i)
-                outputBufferAppend(*charstr++);
+            outputBufferAppend(str.c_str(), str.length());
         };
 
-        void columnUnknown(std::string& columnName, const uint8_t* data, uint64_t length) {
+        //direct write to the chunk, returns nullptr when less than length bytes are left
+        uint8_t* outputBufferReserve(uint64_t length) {
+            if (lastBuffer->length + length > OUTPUT_BUFFER_DATA_SIZE)
+                return nullptr;
+            return lastBuffer->data + lastBuffer->length;
+        };
+
+        void outputBufferReserveCommit(uint64_t length) {
+            messageLength += length;
+            outputBufferShift(length, true);
+        };
+
+        void columnUnknown(typeCOL col, std::string& columnName, const uint8_t* data, uint64_t length) {
             valueBuffer[0] = '?';
             valueLength = 1;
-            columnString(columnName);
+            valueString(col, columnName);
             if (unknownFormat == UNKNOWN_FORMAT_DUMP) {
                 std::stringstream ss;
                 for (uint64_t j = 0; j < length; ++j)
@@ -277,150 +388,162 @@ namespace OpenLogReplicator {
             };
         };
 
-        void parseNumber(const uint8_t* data, uint64_t length) {
+        //returns false for malformed digit bytes, the value is then not a number
+        bool parseNumber(const uint8_t* data, uint64_t length) {
             valueLength = 0;
+            numberMantissa = 0;
+            numberScale = 0;
+            numberNative = true;
 
             uint8_t digits = data[0];
             //just zero
             if (digits == 0x80) {
-                valueBufferAppend('0');
+                valueBuffer[valueLength++] = '0';
+                return true;
+            }
+
+            if (length < 2) {
+                RUNTIME_FAIL("got unknown numeric value");
+            }
+
+            //max 20 mantissa bytes - no need to check buffer size for every digit
+            uint64_t j = 1;
+            uint64_t jMax = length - 1;
+            uint64_t zeros = 0;
+            uint64_t pairs = 0;
+            bool negative = (digits < 0x80);
+            //positive: byte - 1, negative: 101 - byte, both must be 0..99
+            int64_t sign = negative ? -1 : 1;
+            int64_t offset = negative ? 101 : -1;
+            uint64_t value;
+            //only the first 18 digits are accumulated, they always fit in int64
+            uint64_t mantissa = 0;
+
+            if (negative) {
+                valueBuffer[valueLength++] = '-';
+                //terminator of negative number
+                jMax -= (data[jMax] == 0x66);
+                digits = 0xFF - digits;
+            }
+
+            //part of the total
+            if (digits <= 0xC0) {
+                valueBuffer[valueLength++] = '0';
+                zeros = 0xC0 - digits;
             } else {
-                uint64_t j = 1;
-                uint64_t jMax = length - 1;
-
-                //positive number
-                if (digits > 0x80 && jMax >= 1) {
-                    uint64_t value;
-                    uint64_t zeros = 0;
-                    //part of the total
-                    if (digits <= 0xC0) {
-                        valueBufferAppend('0');
-                        zeros = 0xC0 - digits;
-                    } else {
-                        digits -= 0xC0;
-                        //part of the total - omitting first zero for first digit
-                        value = data[j] - 1;
-                        if (value < 10)
-                            valueBufferAppend('0' + value);
-                        else {
-                            valueBufferAppend('0' + (value / 10));
-                            valueBufferAppend('0' + (value % 10));
-                        }
-
-                        ++j;
-                        --digits;
-
-                        while (digits > 0) {
-                            value = data[j] - 1;
-                            if (j <= jMax) {
-                                valueBufferAppend('0' + (value / 10));
-                                valueBufferAppend('0' + (value % 10));
-                                ++j;
-                            } else {
-                                valueBufferAppend('0');
-                                valueBufferAppend('0');
-                            }
-                            --digits;
-                        }
-                    }
+                digits -= 0xC0;
+                //omitting first zero for first digit
+                value = sign * data[j] + offset;
+                if (value > 99)
+                    return parseNumberInvalid();
+                if (value < 10)
+                    valueBuffer[valueLength++] = '0' + value;
+                else {
+                    memcpy(valueBuffer + valueLength, numberPairs + value * 2, 2);
+                    valueLength += 2;
+                }
+                mantissa = value;
+                ++pairs;
+                ++j;
+                --digits;
+
+                while (digits > 0) {
+                    value = (j <= jMax) ? sign * data[j] + offset : 0;
+                    if (value > 99)
+                        return parseNumberInvalid();
+                    memcpy(valueBuffer + valueLength, numberPairs + value * 2, 2);
+                    valueLength += 2;
+                    if (pairs < NUMBER_NATIVE_PAIRS)
+                        mantissa = mantissa * 100 + value;
+                    ++pairs;
+                    ++j;
+                    --digits;
+                }
+            }
 
-                    //fraction part
-                    if (j <= jMax) {
-                        valueBufferAppend('.');
-
-                        while (zeros > 0) {
-                            valueBufferAppend('0');
-                            valueBufferAppend('0');
-                            --zeros;
-                        }
-
-                        while (j <= jMax - 1) {
-                            value = data[j] - 1;
-                            valueBufferAppend('0' + (value / 10));
-                            valueBufferAppend('0' + (value % 10));
-                            ++j;
-                        }
-
-                        //last digit - omitting 0 at the end
-                        value = data[j] - 1;
-                        valueBufferAppend('0' + (value / 10));
-                        if ((value % 10) != 0)
-                            valueBufferAppend('0' + (value % 10));
-                    }
-                //negative number
-                } else if (digits < 0x80 && jMax >= 1) {
-                    uint64_t value;
-                    uint64_t zeros = 0;
-                    valueBufferAppend('-');
-
-                    if (data[jMax] == 0x66)
-                        --jMax;
-
-                    //part of the total
-                    if (digits >= 0x3F) {
-                        valueBufferAppend('0');
-                        zeros = digits - 0x3F;
-                    } else {
-                        digits = 0x3F - digits;
-
-                        value = 101 - data[j];
-                        if (value < 10)
-                            valueBufferAppend('0' + value);
-                        else {
-                            valueBufferAppend('0' + (value / 10));
-                            valueBufferAppend('0' + (value % 10));
-                        }
-                        ++j;
-                        --digits;
-
-                        while (digits > 0) {
-                            if (j <= jMax) {
-                                value = 101 - data[j];
-                                valueBufferAppend('0' + (value / 10));
-                                valueBufferAppend('0' + (value % 10));
-                                ++j;
-                            } else {
-                                valueBufferAppend('0');
-                                valueBufferAppend('0');
-                            }
-                            --digits;
-                        }
-                    }
+            //fraction part
+            if (j <= jMax) {
+                valueBuffer[valueLength++] = '.';
+
+                while (zeros > 0) {
+                    valueBuffer[valueLength++] = '0';
+                    valueBuffer[valueLength++] = '0';
+                    if (pairs < NUMBER_NATIVE_PAIRS)
+                        mantissa *= 100;
+                    numberScale += 2;
+                    ++pairs;
+                    --zeros;
+                }
 
-                    if (j <= jMax) {
-                        valueBufferAppend('.');
-
-                        while (zeros > 0) {
-                            valueBufferAppend('0');
-                            valueBufferAppend('0');
-                            --zeros;
-                        }
-
-                        while (j <= jMax - 1) {
-                            value = 101 - data[j];
-                            valueBufferAppend('0' + (value / 10));
-                            valueBufferAppend('0' + (value % 10));
-                            ++j;
-                        }
-
-                        value = 101 - data[j];
-                        valueBufferAppend('0' + (value / 10));
-                        if ((value % 10) != 0)
-                            valueBufferAppend('0' + (value % 10));
-                    }
+                while (j < jMax) {
+                    value = sign * data[j] + offset;
+                    if (value > 99)
+                        return parseNumberInvalid();
+                    memcpy(valueBuffer + valueLength, numberPairs + value * 2, 2);
+                    valueLength += 2;
+                    if (pairs < NUMBER_NATIVE_PAIRS)
+                        mantissa = mantissa * 100 + value;
+                    numberScale += 2;
+                    ++pairs;
+                    ++j;
+                }
+
+                //last digit - omitting 0 at the end
+                value = sign * data[j] + offset;
+                if (value > 99)
+                    return parseNumberInvalid();
+                valueBuffer[valueLength++] = numberPairs[value * 2];
+                if ((value % 10) != 0) {
+                    valueBuffer[valueLength++] = numberPairs[value * 2 + 1];
+                    if (pairs < NUMBER_NATIVE_PAIRS)
+                        mantissa = mantissa * 100 + value;
+                    numberScale += 2;
                 } else {
-                    RUNTIME_FAIL("got unknown numeric value");
+                    if (pairs < NUMBER_NATIVE_PAIRS)
+                        mantissa = mantissa * 10 + value / 10;
+                    numberScale += 1;
                 }
+                ++pairs;
             }
+
+            if (pairs > NUMBER_NATIVE_PAIRS)
+                numberNative = false;
+            else
+                numberMantissa = negative ? -(int64_t)mantissa : (int64_t)mantissa;
+            return true;
+        };
+
+        bool parseNumberInvalid(void) {
+            valueLength = 0;
+            numberMantissa = 0;
+            numberScale = 0;
+            numberNative = false;
+            return false;
         };
 
         void parseString(const uint8_t* data, uint64_t length, uint64_t charsetId) {
-            CharacterSet* characterSet = characterMap[charsetId];
+            parseString(data, length, characterMap[charsetId], charsetId);
+        };
+
+        void parseString(const uint8_t* data, uint64_t length, CharacterSet* characterSet, uint64_t charsetId) {
             if (characterSet == nullptr && (charFormat & CHAR_FORMAT_NOMAPPING) == 0) {
                 RUNTIME_FAIL("can't find character set map for id = " << std::dec << charsetId);
             }
             valueLength = 0;
 
+            //whole string transcoded at once, ASCII prefix is copied as it is
+            if ((charFormat & (CHAR_FORMAT_NOMAPPING | CHAR_FORMAT_HEX)) == 0 && length * 3 <= MAX_FIELD_LENGTH) {
+                if (characterSet->ascii) {
+                    valueLength = CharacterSet::asciiLength(data, length);
+                    memcpy(valueBuffer, data, valueLength);
+                    data += valueLength;
+                    length -= valueLength;
+                }
+                if (length > 0)
+                    valueLength += characterSet->transcodeToUtf8(data, length, (uint8_t*)valueBuffer + valueLength);
+                return;
+            }
+
             while (length > 0) {
                 typeunicode unicodeCharacter;
                 uint64_t unicodeCharacterLength;
@@ -479,9 +602,11 @@ namespace OpenLogReplicator {
         virtual void processInsert(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) = 0;
         virtual void processUpdate(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) = 0;
         virtual void processDelete(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) = 0;
+        virtual void processUndo(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) = 0;
         virtual void processDDL(OracleObject* object, typeDATAOBJ dataObj, uint16_t type, uint16_t seq, const char* operation,
                 const char* sql, uint64_t sqlLength) = 0;
         virtual void processBegin(void) = 0;
+        virtual void processRollback(void) = 0;
 
     public:
         uint64_t defaultCharacterMapId;
@@ -497,19 +622,27 @@ namespace OpenLogReplicator {
         OutputBufferMsg* msg;
 
         OutputBuffer(uint64_t messageFormat, uint64_t ridFormat, uint64_t xidFormat, uint64_t timestampFormat, uint64_t charFormat, uint64_t scnFormat,
-                uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType, uint64_t flushBuffer);
+                uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType, uint64_t numberFormat, uint64_t flushBuffer);
         virtual ~OutputBuffer();
 
         virtual void initialize(OracleAnalyzer* oracleAnalyzer);
         uint64_t outputBufferSize(void) const;
         void setWriter(Writer* writer);
+        void setRowCallback(RowCallback* rowCallback);
+        void setBatch(uint64_t batchRows, uint64_t batchBytes, uint64_t batchUs);
+        void outputBufferFlush(void);
         void setNlsCharset(std::string& nlsCharset, std::string& nlsNcharCharset);
+        void releaseObject(OracleObject* object);
+        bool columnIncluded(OracleColumn* column) const;
 
         void processBegin(typeSCN scn, typeTIME time_, typeSEQ sequence, typeXID xid);
+        void processBegin(typeSCN scn, typeTIME time_, typeSEQ sequence, typeXID xid, bool provisional_, bool streamed_);
+        void processRollback(typeTIME time_, typeXID xid);
         virtual void processCommit(void) = 0;
         void processInsertMultiple(RedoLogRecord* redoLogRecord1, RedoLogRecord* redoLogRecord2, bool system);
         void processDeleteMultiple(RedoLogRecord* redoLogRecord1, RedoLogRecord* redoLogRecord2, bool system);
         void processDML(RedoLogRecord* redoLogRecord1, RedoLogRecord* redoLogRecord2, uint64_t type, bool system);
+        void processUndo(RedoLogRecord* redoLogRecord);
         void processDDLheader(RedoLogRecord* redoLogRecord1);
         virtual void processCheckpoint(typeSCN scn, typeTIME time_, typeSEQ sequence, uint64_t offset, bool redo) = 0;
 
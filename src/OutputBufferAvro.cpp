@@ -0,0 +1,543 @@
+/* Memory buffer for handling output data in Avro format
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <errno.h>
+#include <fstream>
+#include <set>
+#include <sys/stat.h>
+
+#include "OracleAnalyzer.h"
+#include "OracleColumn.h"
+#include "OracleObject.h"
+#include "OutputBufferAvro.h"
+#include "RowId.h"
+#include "RuntimeException.h"
+
+namespace OpenLogReplicator {
+    //field layout shared by all change records, rows are appended as before/after
+    static const char* changeFields =
+            "{\"name\":\"scn\",\"type\":\"long\"},{\"name\":\"tm\",\"type\":\"long\"},{\"name\":\"xid\",\"type\":\"long\"},"
+            "{\"name\":\"provisional\",\"type\":\"boolean\"},"
+            "{\"name\":\"op\",\"type\":{\"name\":\"OpenLogReplicator.op\",\"type\":\"enum\",\"symbols\":[\"c\",\"u\",\"d\",\"undo\"]}},"
+            "{\"name\":\"num\",\"type\":\"long\"},{\"name\":\"dataobj\",\"type\":\"long\"},{\"name\":\"rid\",\"type\":[\"null\",\"string\"]},";
+
+    OutputBufferAvro::OutputBufferAvro(uint64_t messageFormat, uint64_t ridFormat, uint64_t xidFormat, uint64_t timestampFormat,
+            uint64_t charFormat, uint64_t scnFormat, uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType,
+            uint64_t numberFormat, uint64_t flushBuffer, const char* registryPath) :
+        OutputBuffer(messageFormat, ridFormat, xidFormat, timestampFormat, charFormat, scnFormat, unknownFormat, schemaFormat, columnFormat,
+                unknownType, numberFormat, flushBuffer),
+        controlFingerprint(0),
+        unknownFingerprint(0),
+        mapMode(false),
+        valueWritten(false),
+        registryPath(registryPath) {
+
+        controlSchema = "{\"name\":\"OpenLogReplicator.control\",\"type\":\"record\",\"fields\":["
+                "{\"name\":\"scn\",\"type\":\"long\"},{\"name\":\"tm\",\"type\":\"long\"},{\"name\":\"xid\",\"type\":\"long\"},"
+                "{\"name\":\"provisional\",\"type\":\"boolean\"},"
+                "{\"name\":\"op\",\"type\":{\"name\":\"OpenLogReplicator.controlop\",\"type\":\"enum\",\"symbols\":"
+                "[\"begin\",\"commit\",\"rollback\",\"ddl\",\"chkpt\"]}},"
+                "{\"name\":\"dataobj\",\"type\":\"long\"},{\"name\":\"sql\",\"type\":[\"null\",\"string\"]},"
+                "{\"name\":\"seq\",\"type\":\"long\"},{\"name\":\"offset\",\"type\":\"long\"},{\"name\":\"redo\",\"type\":\"boolean\"}]}";
+        controlFingerprint = fingerprint(controlSchema);
+
+        //tables without dictionary information: columns are sent as a map of raw values
+        unknownSchema = "{\"name\":\"OpenLogReplicator.unknown\",\"type\":\"record\",\"fields\":[";
+        unknownSchema.append(changeFields);
+        unknownSchema.append("{\"name\":\"before\",\"type\":[\"null\",{\"type\":\"map\",\"values\":[\"null\",\"bytes\"]}]},"
+                "{\"name\":\"after\",\"type\":[\"null\",{\"type\":\"map\",\"values\":[\"null\",\"bytes\"]}]}]}");
+        unknownFingerprint = fingerprint(unknownSchema);
+    }
+
+    OutputBufferAvro::~OutputBufferAvro() {
+    }
+
+    void OutputBufferAvro::initialize(OracleAnalyzer* oracleAnalyzer) {
+        OutputBuffer::initialize(oracleAnalyzer);
+
+        struct stat fileStat;
+        if (stat(registryPath.c_str(), &fileStat) != 0 || !S_ISDIR(fileStat.st_mode)) {
+            RUNTIME_FAIL("can't access schema registry directory: " << registryPath);
+        }
+
+        registerSchema(controlSchema, controlFingerprint);
+        registerSchema(unknownSchema, unknownFingerprint);
+    }
+
+    //CRC-64-AVRO (Rabin) fingerprint of parsing canonical form
+    uint64_t OutputBufferAvro::fingerprint(std::string& schema) {
+        const uint64_t empty = 0xC15D213AA4D7A795;
+        uint64_t fp = empty;
+
+        for (uint64_t i = 0; i < schema.length(); ++i) {
+            fp ^= (uint8_t)schema[i];
+            for (uint64_t j = 0; j < 8; ++j)
+                fp = (fp >> 1) ^ (empty & -(fp & 1));
+        }
+        return fp;
+    }
+
+    //avro names allow only [A-Za-z_][A-Za-z0-9_]*
+    std::string OutputBufferAvro::avroName(std::string& name) {
+        std::string str;
+        if (name.length() == 0 || (name[0] >= '0' && name[0] <= '9'))
+            str.push_back('_');
+
+        for (uint64_t i = 0; i < name.length(); ++i) {
+            char c = name[i];
+            if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_')
+                str.push_back(c);
+            else
+                str.push_back('_');
+        }
+        return str;
+    }
+
+    //registry file name, also used by readers of the registry: lowercase hex
+    std::string OutputBufferAvro::fingerprintName(uint64_t fingerprint) {
+        char name[17];
+        for (uint64_t i = 0; i < 16; ++i)
+            name[i] = map16[(fingerprint >> ((15 - i) * 4)) & 0xF];
+        name[16] = 0;
+        return std::string(name);
+    }
+
+    void OutputBufferAvro::registerSchema(std::string& schema, uint64_t fingerprint) {
+        //schemas are immutable, same fingerprint means same content
+        std::string fileName(registryPath + "/" + fingerprintName(fingerprint) + ".avsc");
+        struct stat fileStat;
+        if (stat(fileName.c_str(), &fileStat) == 0)
+            return;
+
+        std::string fileNameTmp(fileName + ".tmp");
+        std::ofstream outputStream;
+        outputStream.open(fileNameTmp.c_str(), std::ios::out | std::ios::trunc);
+        if (!outputStream.is_open()) {
+            RUNTIME_FAIL("writing schema to " << fileNameTmp);
+        }
+        outputStream << schema;
+        outputStream.close();
+
+        if (rename(fileNameTmp.c_str(), fileName.c_str()) != 0) {
+            RUNTIME_FAIL("can't rename file: " << fileNameTmp << " to " << fileName << " - " << strerror(errno));
+        }
+        TRACE(TRACE2_FILE, "FILE: registered schema: " << fileName);
+    }
+
+    void OutputBufferAvro::buildRecord(std::string& str, OracleObject* object, bool canonical) {
+        std::string fullName("OpenLogReplicator." + avroName(object->owner) + "." + avroName(object->name));
+
+        str.append("{\"name\":\"");
+        str.append(fullName);
+        str.append("\",\"type\":\"record\",\"fields\":[");
+        str.append(changeFields);
+        str.append("{\"name\":\"before\",\"type\":[\"null\",{\"name\":\"");
+        str.append(fullName);
+        str.append(".row\",\"type\":\"record\",\"fields\":[");
+
+        std::set<std::string> names;
+        bool hasPrev = false;
+        bool absentDefined = false;
+        for (typeCOL column : object->avroColumns) {
+            OracleColumn* oracleColumn = object->columns[column];
+            std::string name(avroName(oracleColumn->name));
+            if (names.count(name) > 0)
+                name += "_" + std::to_string(column);
+            names.insert(name);
+
+            if (hasPrev)
+                str.push_back(',');
+            else
+                hasPrev = true;
+
+            str.append("{\"name\":\"");
+            str.append(name);
+            str.append("\",\"type\":[\"null\",");
+
+            uint64_t typeNo = oracleColumn->typeNo;
+            if (oracleColumn->storedAsLob)
+                typeNo = 0;
+
+            switch (typeNo) {
+            case 12: //date
+            case 180: //timestamp
+                if (canonical)
+                    str.append("\"long\"");
+                else
+                    str.append("{\"type\":\"long\",\"logicalType\":\"timestamp-micros\"}");
+                break;
+
+            case 23: //raw
+                str.append("\"bytes\"");
+                break;
+
+            case 100: //binary_float
+                str.append("\"float\"");
+                break;
+
+            case 101: //binary_double
+                str.append("\"double\"");
+                break;
+
+            default:
+                //character data, numbers as text, timestamp with time zone and unknown values
+                str.append("\"string\"");
+            }
+
+            //column not present in redo is told apart from null by the third branch, an empty record
+            if (absentDefined)
+                str.append(",\"OpenLogReplicator.absent\"]}");
+            else {
+                str.append(",{\"name\":\"OpenLogReplicator.absent\",\"type\":\"record\",\"fields\":[]}]}");
+                absentDefined = true;
+            }
+        }
+
+        str.append("]}]},{\"name\":\"after\",\"type\":[\"null\",\"");
+        str.append(fullName);
+        str.append(".row\"]}]}");
+    }
+
+    void OutputBufferAvro::buildSchema(OracleObject* object) {
+        object->avroColumns.clear();
+        for (typeCOL column = 0; column < object->columns.size(); ++column)
+            if (columnIncluded(object->columns[column]) && !object->columnSkipped(column))
+                object->avroColumns.push_back(column);
+
+        //fingerprint is calculated on canonical form, registry keeps logical types
+        std::string canonical;
+        buildRecord(canonical, object, true);
+        buildRecord(object->avroSchema, object, false);
+        object->avroFingerprint = fingerprint(canonical);
+        registerSchema(object->avroSchema, object->avroFingerprint);
+    }
+
+    void OutputBufferAvro::columnNull(OracleObject* object, typeCOL col) {
+        if (mapMode) {
+            appendLong(1);
+            std::string& name = unknownColumnName(col);
+            appendBytes(name.c_str(), name.length());
+        }
+        appendLong(0);
+        valueWritten = true;
+    }
+
+    void OutputBufferAvro::columnFloat(std::string& columnName, float value) {
+        char buffer[4];
+        memcpy(buffer, &value, 4);
+        appendLong(1);
+        outputBufferAppend(buffer, 4);
+        valueWritten = true;
+    }
+
+    void OutputBufferAvro::columnDouble(std::string& columnName, double value) {
+        char buffer[8];
+        memcpy(buffer, &value, 8);
+        appendLong(1);
+        outputBufferAppend(buffer, 8);
+        valueWritten = true;
+    }
+
+    void OutputBufferAvro::columnString(std::string& columnName) {
+        //unknown value of a column with non-string type is sent as null
+        if (valueColumn != nullptr && !valueColumn->storedAsLob && (valueColumn->typeNo == 12 || valueColumn->typeNo == 180 ||
+                valueColumn->typeNo == 23 || valueColumn->typeNo == 100 || valueColumn->typeNo == 101)) {
+            appendLong(0);
+        } else {
+            appendLong(1);
+            appendBytes(valueBuffer, valueLength);
+        }
+        valueWritten = true;
+    }
+
+    void OutputBufferAvro::columnNumber(std::string& columnName, uint64_t precision, uint64_t scale) {
+        appendLong(1);
+        appendBytes(valueBuffer, valueLength);
+        valueWritten = true;
+    }
+
+    void OutputBufferAvro::columnRaw(std::string& columnName, const uint8_t* data, uint64_t length) {
+        if (mapMode) {
+            appendLong(1);
+            appendBytes(columnName.c_str(), columnName.length());
+        }
+        appendLong(1);
+        appendBytes((const char*)data, length);
+        valueWritten = true;
+    }
+
+    void OutputBufferAvro::columnTimestamp(std::string& columnName, struct tm &epochTime, uint64_t fraction, const char* tz) {
+        appendLong(1);
+        if (tz != nullptr) {
+            char buffer[48];
+            uint64_t length = timestampToIso8601(buffer, epochTime, fraction);
+            buffer[length++] = ' ';
+            uint64_t tzLength = strlen(tz);
+            appendLong(length + tzLength);
+            outputBufferAppend(buffer, length);
+            outputBufferAppend(tz, tzLength);
+        } else {
+            int64_t seconds = daysFromCivil(epochTime.tm_year, epochTime.tm_mon, epochTime.tm_mday) * 86400 +
+                    epochTime.tm_hour * 3600 + epochTime.tm_min * 60 + epochTime.tm_sec;
+            appendLong(seconds * 1000000 + fraction / 1000);
+        }
+        valueWritten = true;
+    }
+
+    void OutputBufferAvro::appendRowid(typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot) {
+        appendLong(num);
+        appendLong(dataObj);
+
+        if (ridFormat == RID_FORMAT_SKIP) {
+            appendLong(0);
+            return;
+        }
+
+        RowId rowId(dataObj, bdba, slot);
+        char str[19];
+        rowId.toString(str);
+        appendLong(1);
+        appendBytes(str, 18);
+    }
+
+    void OutputBufferAvro::appendHeader(bool first, bool showXid) {
+        //all fields are always present, the record layout is positional
+        appendLong(lastScn);
+        appendLong(lastTime.toTime() * 1000);
+        appendLong(lastXid);
+        outputBufferAppend(provisional ? (char)1 : (char)0);
+    }
+
+    void OutputBufferAvro::appendSchema(OracleObject* object, typeDATAOBJ dataObj) {
+        if (object == nullptr) {
+            appendFingerprint(unknownFingerprint);
+            return;
+        }
+
+        //schema is cached per object, new object version gets empty cache
+        if (object->avroSchema.length() == 0)
+            buildSchema(object);
+        appendFingerprint(object->avroFingerprint);
+    }
+
+    void OutputBufferAvro::appendRow(OracleObject* object, uint64_t type) {
+        appendLong(1);
+
+        if (object == nullptr) {
+            mapMode = true;
+            valueColumn = nullptr;
+            uint64_t baseMax = valuesMax >> 6;
+            for (uint64_t base = 0; base <= baseMax; ++base) {
+                typeCOL column = base << 6;
+                for (uint64_t mask = 1; mask != 0; mask <<= 1, ++column) {
+                    if (valuesSet[base] < mask)
+                        break;
+                    if ((valuesSet[base] & mask) == 0)
+                        continue;
+
+                    if (values[column][type] != nullptr) {
+                        if (lengths[column][type] > 0)
+                            processValue(object, column, values[column][type], lengths[column][type]);
+                        else
+                            columnNull(object, column);
+                    }
+                }
+            }
+            //end of map blocks
+            appendLong(0);
+            mapMode = false;
+            return;
+        }
+
+        //columns not present in redo are sent as the absent branch
+        for (typeCOL column : object->avroColumns) {
+            if (values[column][type] == nullptr) {
+                appendLong(2);
+                continue;
+            }
+            valueWritten = false;
+            if (lengths[column][type] > 0)
+                processValue(object, column, values[column][type], lengths[column][type]);
+            if (!valueWritten)
+                appendLong(0);
+        }
+    }
+
+    void OutputBufferAvro::appendControl(uint64_t op, typeDATAOBJ dataObj, const char* sql, uint64_t sqlLength, typeSEQ sequence,
+            uint64_t offset, bool redo) {
+        appendFingerprint(controlFingerprint);
+        appendHeader(true, true);
+        appendLong(op);
+        appendLong(dataObj);
+        if (sql != nullptr) {
+            appendLong(1);
+            appendBytes(sql, sqlLength);
+        } else
+            appendLong(0);
+        appendLong(sequence);
+        appendLong(offset);
+        outputBufferAppend(redo ? (char)1 : (char)0);
+    }
+
+    void OutputBufferAvro::processBegin(void) {
+        newTran = false;
+
+        if ((messageFormat & MESSAGE_FORMAT_SKIP_BEGIN) != 0)
+            return;
+
+        //begin of streamed transaction was already sent with first batch
+        if (streamed)
+            return;
+
+        outputBufferBegin(0);
+        appendControl(0, 0, nullptr, 0, 0, 0, false);
+        outputBufferCommit(false);
+    }
+
+    void OutputBufferAvro::processCommit(void) {
+        if (newTran) {
+            //skip empty transaction, final commit of streamed transaction is always sent
+            if (!streamed || provisional) {
+                newTran = false;
+                provisional = false;
+                return;
+            }
+            processBegin();
+        }
+
+        if ((messageFormat & MESSAGE_FORMAT_SKIP_COMMIT) == 0 && !provisional) {
+            outputBufferBegin(0);
+            appendControl(1, 0, nullptr, 0, 0, 0, false);
+            outputBufferCommit(true);
+        }
+        provisional = false;
+        num = 0;
+    }
+
+    void OutputBufferAvro::processRollback(void) {
+        outputBufferBegin(0);
+        appendControl(2, 0, nullptr, 0, 0, 0, false);
+        outputBufferCommit(true);
+        num = 0;
+    }
+
+    void OutputBufferAvro::processInsert(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) {
+        if (newTran)
+            processBegin();
+
+        if (object != nullptr)
+            outputBufferBegin(object->obj);
+        else
+            outputBufferBegin(0);
+
+        appendSchema(object, dataObj);
+        appendHeader(false, true);
+        appendLong(0);
+        appendRowid(dataObj, bdba, slot);
+        appendLong(0);
+        appendRow(object, VALUE_AFTER);
+
+        outputBufferCommit(false);
+        ++num;
+    }
+
+    void OutputBufferAvro::processUpdate(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) {
+        if (newTran)
+            processBegin();
+
+        if (object != nullptr)
+            outputBufferBegin(object->obj);
+        else
+            outputBufferBegin(0);
+
+        appendSchema(object, dataObj);
+        appendHeader(false, true);
+        appendLong(1);
+        appendRowid(dataObj, bdba, slot);
+        appendRow(object, VALUE_BEFORE);
+        appendRow(object, VALUE_AFTER);
+
+        outputBufferCommit(false);
+        ++num;
+    }
+
+    void OutputBufferAvro::processDelete(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) {
+        if (newTran)
+            processBegin();
+
+        if (object != nullptr)
+            outputBufferBegin(object->obj);
+        else
+            outputBufferBegin(0);
+
+        appendSchema(object, dataObj);
+        appendHeader(false, true);
+        appendLong(2);
+        appendRowid(dataObj, bdba, slot);
+        appendRow(object, VALUE_BEFORE);
+        appendLong(0);
+
+        outputBufferCommit(false);
+        ++num;
+    }
+
+    //row reverted to its state before the change sent earlier, without images
+    void OutputBufferAvro::processUndo(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) {
+        if (newTran)
+            processBegin();
+
+        if (object != nullptr)
+            outputBufferBegin(object->obj);
+        else
+            outputBufferBegin(0);
+
+        appendSchema(object, dataObj);
+        appendHeader(false, true);
+        appendLong(3);
+        appendRowid(dataObj, bdba, slot);
+        appendLong(0);
+        appendLong(0);
+
+        outputBufferCommit(false);
+        ++num;
+    }
+
+    void OutputBufferAvro::processDDL(OracleObject* object, typeDATAOBJ dataObj, uint16_t type, uint16_t seq, const char* operation, const char* sql, uint64_t sqlLength) {
+        if (newTran)
+            processBegin();
+
+        if (object != nullptr)
+            outputBufferBegin(object->obj);
+        else
+            outputBufferBegin(0);
+
+        appendControl(3, dataObj, sql, sqlLength, 0, 0, false);
+        outputBufferCommit(true);
+        ++num;
+    }
+
+    void OutputBufferAvro::processCheckpoint(typeSCN scn, typeTIME time_, typeSEQ sequence, uint64_t offset, bool redo) {
+        lastTime = time_;
+        lastScn = scn;
+        lastSequence = sequence;
+        outputBufferBegin(0);
+        appendControl(4, 0, nullptr, 0, sequence, offset, redo);
+        outputBufferCommit(true);
+    }
+}
@@ -0,0 +1,104 @@
+/* Header for OutputBufferAvro class
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include "OracleColumn.h"
+#include "OracleObject.h"
+#include "OutputBuffer.h"
+
+#ifndef OUTPUTBUFFERAVRO_H_
+#define OUTPUTBUFFERAVRO_H_
+
+namespace OpenLogReplicator {
+    class OutputBufferAvro : public OutputBuffer {
+    protected:
+        std::string controlSchema;
+        uint64_t controlFingerprint;
+        std::string unknownSchema;
+        uint64_t unknownFingerprint;
+        bool mapMode;
+        bool valueWritten;
+
+        virtual void columnNull(OracleObject* object, typeCOL col);
+        virtual void columnFloat(std::string& columnName, float value);
+        virtual void columnDouble(std::string& columnName, double value);
+        virtual void columnString(std::string& columnName);
+        virtual void columnNumber(std::string& columnName, uint64_t precision, uint64_t scale);
+        virtual void columnRaw(std::string& columnName, const uint8_t* data, uint64_t length);
+        virtual void columnTimestamp(std::string& columnName, struct tm& epochtime, uint64_t fraction, const char* tz);
+        virtual void appendRowid(typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot);
+        virtual void appendHeader(bool first, bool showXid);
+        virtual void appendSchema(OracleObject* object, typeDATAOBJ dataObj);
+
+        //zig-zag varint, used for int, long, enum, union branch and length prefixes
+        void appendLong(int64_t value) {
+            uint64_t zigZag = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+            char buffer[10];
+            uint64_t length = 0;
+            while (zigZag >= 0x80) {
+                buffer[length++] = (char)(zigZag | 0x80);
+                zigZag >>= 7;
+            }
+            buffer[length++] = (char)zigZag;
+            outputBufferAppend(buffer, length);
+        }
+        void appendBytes(const char* data, uint64_t length) {
+            appendLong(length);
+            outputBufferAppend(data, length);
+        }
+        void appendFingerprint(uint64_t fingerprint) {
+            //single object encoding: marker and little endian schema fingerprint
+            char buffer[10];
+            buffer[0] = (char)0xC3;
+            buffer[1] = (char)0x01;
+            for (uint64_t i = 0; i < 8; ++i)
+                buffer[2 + i] = (char)(fingerprint >> (i * 8));
+            outputBufferAppend(buffer, 10);
+        }
+        void appendRow(OracleObject* object, uint64_t type);
+        void appendControl(uint64_t op, typeDATAOBJ dataObj, const char* sql, uint64_t sqlLength, typeSEQ sequence, uint64_t offset, bool redo);
+        void buildSchema(OracleObject* object);
+        void buildRecord(std::string& str, OracleObject* object, bool canonical);
+        void registerSchema(std::string& schema, uint64_t fingerprint);
+        static uint64_t fingerprint(std::string& schema);
+        static std::string avroName(std::string& name);
+        virtual void processInsert(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
+        virtual void processUpdate(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
+        virtual void processDelete(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
+        virtual void processUndo(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
+        virtual void processDDL(OracleObject* object, typeDATAOBJ dataObj, uint16_t type, uint16_t seq, const char* operation,
+                const char* sql, uint64_t sqlLength);
+        virtual void processBegin(void);
+        virtual void processRollback(void);
+    public:
+        std::string registryPath;
+
+        OutputBufferAvro(uint64_t messageFormat, uint64_t ridFormat, uint64_t xidFormat, uint64_t timestampFormat, uint64_t charFormat, uint64_t scnFormat,
+                uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType, uint64_t numberFormat, uint64_t flushBuffer,
+                const char* registryPath);
+        virtual ~OutputBufferAvro();
+
+        virtual void initialize(OracleAnalyzer* oracleAnalyzer);
+        virtual void processCommit(void);
+        virtual void processCheckpoint(typeSCN scn, typeTIME time_, typeSEQ sequence, uint64_t offset, bool redo);
+
+        static std::string fingerprintName(uint64_t fingerprint);
+    };
+}
+
+#endif
@@ -17,6 +17,13 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include "FloatFormatter.h"
 #include "OracleAnalyzer.h"
 #include "OracleColumn.h"
 #include "OracleObject.h"
@@ -24,11 +31,176 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "RowId.h"
 
 namespace OpenLogReplicator {
+    static const char hexPairs[513] =
+            "000102030405060708090a0b0c0d0e0f"
+            "101112131415161718191a1b1c1d1e1f"
+            "202122232425262728292a2b2c2d2e2f"
+            "303132333435363738393a3b3c3d3e3f"
+            "404142434445464748494a4b4c4d4e4f"
+            "505152535455565758595a5b5c5d5e5f"
+            "606162636465666768696a6b6c6d6e6f"
+            "707172737475767778797a7b7c7d7e7f"
+            "808182838485868788898a8b8c8d8e8f"
+            "909192939495969798999a9b9c9d9e9f"
+            "a0a1a2a3a4a5a6a7a8a9aaabacadaeaf"
+            "b0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+            "c0c1c2c3c4c5c6c7c8c9cacbcccdcecf"
+            "d0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+            "e0e1e2e3e4e5e6e7e8e9eaebecedeeef"
+            "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+
+    //characters which may need escaping: control characters, '"', '\\' and '/'
+    static uint64_t escapeScanScalar(const char* str, uint64_t length) {
+        uint64_t pos = 0;
+        while (pos < length) {
+            uint8_t character = str[pos];
+            if (character < 0x20 || character == '"' || character == '\\' || character == '/')
+                break;
+            ++pos;
+        }
+        return pos;
+    }
+
+    static void hexEncodeScalar(uint8_t* dst, const uint8_t* src, uint64_t length) {
+        for (uint64_t i = 0; i < length; ++i) {
+            memcpy(dst, hexPairs + src[i] * 2, 2);
+            dst += 2;
+        }
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    static uint64_t escapeScanSse2(const char* str, uint64_t length) {
+        const __m128i maskControl = _mm_set1_epi8((char)0xE0);
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i slash = _mm_set1_epi8('/');
+        const __m128i zero = _mm_setzero_si128();
+        uint64_t pos = 0;
+
+        while (pos + 16 <= length) {
+            __m128i data = _mm_loadu_si128((const __m128i*)(str + pos));
+            __m128i found = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(_mm_and_si128(data, maskControl), zero), _mm_cmpeq_epi8(data, quote)),
+                    _mm_or_si128(_mm_cmpeq_epi8(data, backslash), _mm_cmpeq_epi8(data, slash)));
+            uint32_t mask = _mm_movemask_epi8(found);
+            if (mask != 0)
+                return pos + __builtin_ctz(mask);
+            pos += 16;
+        }
+        return pos + escapeScanScalar(str + pos, length - pos);
+    }
+
+    __attribute__((target("avx2")))
+    static uint64_t escapeScanAvx2(const char* str, uint64_t length) {
+        if (length < 32)
+            return escapeScanSse2(str, length);
+
+        const __m256i maskControl = _mm256_set1_epi8((char)0xE0);
+        const __m256i quote = _mm256_set1_epi8('"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i slash = _mm256_set1_epi8('/');
+        const __m256i zero = _mm256_setzero_si256();
+        uint64_t pos = 0;
+
+        while (pos + 32 <= length) {
+            __m256i data = _mm256_loadu_si256((const __m256i*)(str + pos));
+            __m256i found = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_and_si256(data, maskControl), zero), _mm256_cmpeq_epi8(data, quote)),
+                    _mm256_or_si256(_mm256_cmpeq_epi8(data, backslash), _mm256_cmpeq_epi8(data, slash)));
+            uint32_t mask = _mm256_movemask_epi8(found);
+            if (mask != 0)
+                return pos + __builtin_ctz(mask);
+            pos += 32;
+        }
+        //leave the upper state clean before the SSE2 tail, the transition is very slow otherwise
+        _mm256_zeroupper();
+        return pos + escapeScanSse2(str + pos, length - pos);
+    }
+
+    __attribute__((target("ssse3")))
+    static void hexEncodeSsse3(uint8_t* dst, const uint8_t* src, uint64_t length) {
+        const __m128i digits = _mm_loadu_si128((const __m128i*)"0123456789abcdef");
+        const __m128i maskLow = _mm_set1_epi8(0x0F);
+        uint64_t pos = 0;
+
+        while (pos + 16 <= length) {
+            __m128i data = _mm_loadu_si128((const __m128i*)(src + pos));
+            __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(data, 4), maskLow));
+            __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(data, maskLow));
+            _mm_storeu_si128((__m128i*)(dst + pos * 2), _mm_unpacklo_epi8(high, low));
+            _mm_storeu_si128((__m128i*)(dst + pos * 2 + 16), _mm_unpackhi_epi8(high, low));
+            pos += 16;
+        }
+        hexEncodeScalar(dst + pos * 2, src + pos, length - pos);
+    }
+#elif defined(__aarch64__)
+    static uint64_t escapeScanNeon(const char* str, uint64_t length) {
+        const uint8x16_t control = vdupq_n_u8(0x20);
+        const uint8x16_t quote = vdupq_n_u8('"');
+        const uint8x16_t backslash = vdupq_n_u8('\\');
+        const uint8x16_t slash = vdupq_n_u8('/');
+        uint64_t pos = 0;
+
+        while (pos + 16 <= length) {
+            uint8x16_t data = vld1q_u8((const uint8_t*)(str + pos));
+            uint8x16_t found = vorrq_u8(vorrq_u8(vcltq_u8(data, control), vceqq_u8(data, quote)),
+                    vorrq_u8(vceqq_u8(data, backslash), vceqq_u8(data, slash)));
+            if (vmaxvq_u8(found) != 0)
+                return pos + escapeScanScalar(str + pos, 16);
+            pos += 16;
+        }
+        return pos + escapeScanScalar(str + pos, length - pos);
+    }
+
+    static void hexEncodeNeon(uint8_t* dst, const uint8_t* src, uint64_t length) {
+        const uint8x16_t digits = vld1q_u8((const uint8_t*)"0123456789abcdef");
+        uint64_t pos = 0;
+
+        while (pos + 16 <= length) {
+            uint8x16_t data = vld1q_u8(src + pos);
+            uint8x16x2_t hex;
+            hex.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(data, 4));
+            hex.val[1] = vqtbl1q_u8(digits, vandq_u8(data, vdupq_n_u8(0x0F)));
+            vst2q_u8(dst + pos * 2, hex);
+            pos += 16;
+        }
+        hexEncodeScalar(dst + pos * 2, src + pos, length - pos);
+    }
+#endif
+
+    //choose the best kernels for the CPU at startup
+    static uint64_t (*escapeScanSelect(void))(const char*, uint64_t) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return escapeScanAvx2;
+        if (__builtin_cpu_supports("sse2"))
+            return escapeScanSse2;
+#elif defined(__aarch64__)
+        return escapeScanNeon;
+#endif
+        return escapeScanScalar;
+    }
+
+    static void (*hexEncodeSelect(void))(uint8_t*, const uint8_t*, uint64_t) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("ssse3"))
+            return hexEncodeSsse3;
+#elif defined(__aarch64__)
+        return hexEncodeNeon;
+#endif
+        return hexEncodeScalar;
+    }
+
+    uint64_t (*OutputBufferJson::escapeScan)(const char* str, uint64_t length) = escapeScanSelect();
+    void (*OutputBufferJson::hexEncode)(uint8_t* dst, const uint8_t* src, uint64_t length) = hexEncodeSelect();
+
     OutputBufferJson::OutputBufferJson(uint64_t messageFormat, uint64_t ridFormat, uint64_t xidFormat, uint64_t timestampFormat,
             uint64_t charFormat, uint64_t scnFormat, uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType,
-            uint64_t flushBuffer) :
+            uint64_t numberFormat, uint64_t flushBuffer) :
         OutputBuffer(messageFormat, ridFormat, xidFormat, timestampFormat, charFormat, scnFormat, unknownFormat, schemaFormat, columnFormat,
-                unknownType, flushBuffer),
+                unknownType, numberFormat, flushBuffer),
         hasPreviousValue(false),
         hasPreviousRedo(false),
         hasPreviousColumn(false) {
@@ -69,129 +241,92 @@ namespace OpenLogReplicator {
         else
             hasPreviousColumn = true;
 
-        outputBufferAppend('"');
-        if (object != nullptr)
-            outputBufferAppend(object->columns[col]->name);
-        else {
-            std::string columnName("COL_" + std::to_string(col));
-            outputBufferAppend(columnName);
+        if (object != nullptr) {
+            OracleColumn* column = object->columns[col];
+            if (column->jsonKey.length() == 0)
+                column->jsonKey = "\"" + column->name + "\":";
+            outputBufferAppend(column->jsonKey);
+        } else {
+            outputBufferAppend('"');
+            outputBufferAppend(unknownColumnName(col));
+            outputBufferAppend("\":");
         }
-        outputBufferAppend("\":null");
+        outputBufferAppend("null");
     }
 
     void OutputBufferJson::columnFloat(std::string& columnName, float value) {
-        if (hasPreviousColumn)
-            outputBufferAppend(',');
-        else
-            hasPreviousColumn = true;
+        appendColumnKey(columnName);
 
-        outputBufferAppend('"');
-        outputBufferAppend(columnName);
-        outputBufferAppend("\":");
-
-        std::string valString(std::to_string(value));
-        outputBufferAppend(valString);
+        char buffer[FLOAT_FORMATTER_BUFFER_SIZE];
+        uint64_t length = FloatFormatter::format(value, buffer);
+        outputBufferAppend(buffer, length);
     }
 
     void OutputBufferJson::columnDouble(std::string& columnName, double value) {
-        if (hasPreviousColumn)
-            outputBufferAppend(',');
-        else
-            hasPreviousColumn = true;
-
-        outputBufferAppend('"');
-        outputBufferAppend(columnName);
-        outputBufferAppend("\":");
+        appendColumnKey(columnName);
 
-        std::string valString(std::to_string(value));
-        outputBufferAppend(valString);
+        char buffer[FLOAT_FORMATTER_BUFFER_SIZE];
+        uint64_t length = FloatFormatter::format(value, buffer);
+        outputBufferAppend(buffer, length);
     }
 
     void OutputBufferJson::columnString(std::string& columnName) {
-        if (hasPreviousColumn)
-            outputBufferAppend(',');
-        else
-            hasPreviousColumn = true;
-
+        appendColumnKey(columnName);
         outputBufferAppend('"');
-        outputBufferAppend(columnName);
-        outputBufferAppend("\":\"");
         appendEscape(valueBuffer, valueLength);
         outputBufferAppend('"');
     }
 
     void OutputBufferJson::columnNumber(std::string& columnName, uint64_t precision, uint64_t scale) {
-        if (hasPreviousColumn)
-            outputBufferAppend(',');
-        else
-            hasPreviousColumn = true;
-
-        outputBufferAppend('"');
-        outputBufferAppend(columnName);
-        outputBufferAppend("\":");
+        appendColumnKey(columnName);
         outputBufferAppend(valueBuffer, valueLength);
     }
 
     void OutputBufferJson::columnRaw(std::string& columnName, const uint8_t* data, uint64_t length) {
-        if (hasPreviousColumn)
-            outputBufferAppend(',');
-        else
-            hasPreviousColumn = true;
-
+        appendColumnKey(columnName);
         outputBufferAppend('"');
-        outputBufferAppend(columnName);
-        outputBufferAppend("\":\"");
-        for (uint64_t j = 0; j < length; ++j)
-            appendHex(*(data + j), 2);
+        uint8_t* hex = outputBufferReserve(length * 2);
+        if (hex != nullptr) {
+            hexEncode(hex, data, length);
+            outputBufferReserveCommit(length * 2);
+        } else {
+            uint8_t buffer[512];
+            while (length > 0) {
+                uint64_t size = (length > 256) ? 256 : length;
+                hexEncode(buffer, data, size);
+                outputBufferAppend((const char*)buffer, size * 2);
+                data += size;
+                length -= size;
+            }
+        }
         outputBufferAppend('"');
     }
 
     void OutputBufferJson::columnTimestamp(std::string& columnName, struct tm &epochTime, uint64_t fraction, const char* tz) {
-        if (hasPreviousColumn)
-            outputBufferAppend(',');
-        else
-            hasPreviousColumn = true;
-
-        outputBufferAppend('"');
-        outputBufferAppend(columnName);
-        outputBufferAppend("\":");
+        appendColumnKey(columnName);
 
         if ((timestampFormat & TIMESTAMP_FORMAT_ISO8601) != 0) {
             //2012-04-23T18:25:43.511Z - ISO 8601 format
-            outputBufferAppend('"');
-            if (epochTime.tm_year > 0) {
-                appendDec((uint64_t)epochTime.tm_year);
-            } else {
-                appendDec((uint64_t)(-epochTime.tm_year));
-                outputBufferAppend("BC");
-            }
-            outputBufferAppend('-');
-            appendDec(epochTime.tm_mon, 2);
-            outputBufferAppend('-');
-            appendDec(epochTime.tm_mday, 2);
-            outputBufferAppend('T');
-            appendDec(epochTime.tm_hour, 2);
-            outputBufferAppend(':');
-            appendDec(epochTime.tm_min, 2);
-            outputBufferAppend(':');
-            appendDec(epochTime.tm_sec, 2);
-
-            if (fraction > 0) {
-                outputBufferAppend('.');
-                appendDec(fraction, 9);
-            }
+            char buffer[48];
+            uint64_t pos = 0;
+            buffer[pos++] = '"';
+            pos += timestampToIso8601(buffer + pos, epochTime, fraction);
 
             if (tz != nullptr) {
-                outputBufferAppend(' ');
+                buffer[pos++] = ' ';
+                outputBufferAppend(buffer, pos);
                 outputBufferAppend(tz);
+                outputBufferAppend('"');
+            } else {
+                buffer[pos++] = '"';
+                outputBufferAppend(buffer, pos);
             }
-            outputBufferAppend('"');
         } else {
             //unix epoch format
             if (epochTime.tm_year >= 1900) {
-                --epochTime.tm_mon;
-                epochTime.tm_year -= 1900;
-                appendDec(tmToEpoch(&epochTime) * 1000 + ((fraction + 500000) / 1000000));
+                int64_t seconds = daysFromCivil(epochTime.tm_year, epochTime.tm_mon, epochTime.tm_mday) * 86400 +
+                        epochTime.tm_hour * 3600 + epochTime.tm_min * 60 + epochTime.tm_sec;
+                appendDec(seconds * 1000 + ((fraction + 500000) / 1000000));
             } else
                 appendDec(0);
         }
@@ -267,178 +402,176 @@ namespace OpenLogReplicator {
                 outputBufferAppend("\"xidn\":");
                 appendDec(lastXid);
             }
+
+            if (provisional)
+                outputBufferAppend(",\"provisional\":true");
         }
     }
 
+    //batch is an array of regular messages
+    void OutputBufferJson::appendBatchBegin(void) {
+        outputBufferAppend('[');
+    }
+
+    void OutputBufferJson::appendBatchSeparator(void) {
+        outputBufferAppend(',');
+    }
+
+    void OutputBufferJson::appendBatchEnd(void) {
+        outputBufferAppend(']');
+    }
+
     void OutputBufferJson::appendSchema(OracleObject* object, typeDATAOBJ dataObj) {
         if (object == nullptr) {
             outputBufferAppend("\"schema\":{\"table\":\"");
             std::string objectName("OBJ_" + std::to_string(dataObj));
             outputBufferAppend(objectName);
-            outputBufferAppend('"}');
+            outputBufferAppend("\"}");
             return;
         }
 
-        outputBufferAppend("\"schema\":{\"owner\":\"");
-        outputBufferAppend(object->owner);
-        outputBufferAppend("\",\"table\":\"");
-        outputBufferAppend(object->name);
-        outputBufferAppend('"');
-
-        if ((schemaFormat & SCHEMA_FORMAT_OBJ) != 0) {
-            outputBufferAppend(",\"obj\":");
-            appendDec(object->obj);
+        //schema fragments are cached per object, new object version gets empty cache
+        if (object->jsonSchema.length() == 0) {
+            object->jsonSchema = "\"schema\":{\"owner\":\"" + object->owner + "\",\"table\":\"" + object->name + "\"";
+            if ((schemaFormat & SCHEMA_FORMAT_OBJ) != 0)
+                object->jsonSchema += ",\"obj\":" + std::to_string(object->obj);
         }
+        outputBufferAppend(object->jsonSchema);
 
         if ((schemaFormat & SCHEMA_FORMAT_FULL) != 0) {
             if ((schemaFormat & SCHEMA_FORMAT_REPEATED) == 0) {
-                if (objects.count(object) > 0)
+                if (objects.count(object) > 0) {
+                    outputBufferAppend('}');
                     return;
-                else
+                } else
                     objects.insert(object);
             }
 
-            outputBufferAppend(",\"columns\":[");
-
-            bool hasPrev = false;
-            for (typeCOL column = 0; column < object->columns.size(); ++column) {
-                if (object->columns[column] == nullptr)
-                    continue;
-
-                if (hasPrev)
-                    outputBufferAppend(',');
-                else
-                    hasPrev = true;
-
-                outputBufferAppend("{\"name\":\"");
-                outputBufferAppend(object->columns[column]->name);
-
-                outputBufferAppend("\",\"type\":");
-                switch(object->columns[column]->typeNo) {
-                case 1: //varchar2(n), nvarchar(n)
-                    outputBufferAppend("\"varchar2\",\"length\":");
-                    appendDec(object->columns[column]->length);
-                    break;
-
-                case 2: //number(p, s), float(p)
-                    outputBufferAppend("\"number\",\"precision\":");
-                    appendSDec(object->columns[column]->precision);
-                    outputBufferAppend(",\"scale\":");
-                    appendSDec(object->columns[column]->scale);
-                    break;
-
-                case 8: //long, not supported
-                    outputBufferAppend("\"long\"");
-                    break;
-
-                case 12: //date
-                    outputBufferAppend("\"date\"");
-                    break;
-
-                case 23: //raw(n)
-                    outputBufferAppend("\"raw\",\"length\":");
-                    appendDec(object->columns[column]->length);
-                    break;
-
-                case 24: //long raw, not supported
-                    outputBufferAppend("\"long raw\"");
-                    break;
-
-                case 69: //rowid, not supported
-                    outputBufferAppend("\"rowid\"");
-                    break;
-
-                case 96: //char(n), nchar(n)
-                    outputBufferAppend("\"char\",\"length\":");
-                    appendDec(object->columns[column]->length);
-                    break;
-
-                case 100: //binary_float
-                    outputBufferAppend("\"binary_float\"");
-                    break;
-
-                case 101: //binary_double
-                    outputBufferAppend("\"binary_double\"");
-                    break;
-
-                case 112: //clob, nclob, not supported
-                    outputBufferAppend("\"clob\"");
-                    break;
-
-                case 113: //blob, not supported
-                    outputBufferAppend("\"blob\"");
-                    break;
-
-                case 180: //timestamp(n)
-                    outputBufferAppend("\"timestamp\",\"length\":");
-                    appendDec(object->columns[column]->length);
-                    break;
-
-                case 181: //timestamp with time zone(n)
-                    outputBufferAppend("\"timestamp with time zone\",\"length\":");
-                    appendDec(object->columns[column]->length);
-                    break;
-
-                case 182: //interval year to month(n)
-                    outputBufferAppend("\"interval year to month\",\"length\":");
-                    appendDec(object->columns[column]->length);
-                    break;
-
-                case 183: //interval day to second(n)
-                    outputBufferAppend("\"interval day to second\",\"length\":");
-                    appendDec(object->columns[column]->length);
-                    break;
-
-                case 208: //urawid(n)
-                    outputBufferAppend("\"urawid\",\"length\":");
-                    appendDec(object->columns[column]->length);
-                    break;
-
-                case 231: //timestamp with local time zone(n), not supported
-                    outputBufferAppend("\"timestamp with local time zone\",\"length\":");
-                    appendDec(object->columns[column]->length);
-                    break;
-
-                default:
-                    outputBufferAppend("\"unknown\"");
-                    break;
-                }
-
-                outputBufferAppend(",\"nullable\":");
-                if (object->columns[column]->nullable)
-                    outputBufferAppend('1');
-                else
-                    outputBufferAppend('0');
-
-                outputBufferAppend("}");
-            }
-            outputBufferAppend(']');
+            if (object->jsonColumns.length() == 0)
+                buildSchemaColumns(object);
+            outputBufferAppend(object->jsonColumns);
         }
 
         outputBufferAppend('}');
     }
 
-    time_t OutputBufferJson::tmToEpoch(struct tm* epoch) const {
-        static const int cumdays[12] = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
-        uint64_t year;
-        time_t result;
-
-        year = 1900 + epoch->tm_year + epoch->tm_mon / 12;
-        result = (year - 1970) * 365 + cumdays[epoch->tm_mon % 12];
-        result += (year - 1968) / 4;
-        result -= (year - 1900) / 100;
-        result += (year - 1600) / 400;
-        if ((year % 4) == 0 && ((year % 100) != 0 || (year % 400) == 0) &&
-            (epoch->tm_mon % 12) < 2)
-            result--;
-        result += epoch->tm_mday - 1;
-        result *= 24;
-        result += epoch->tm_hour;
-        result *= 60;
-        result += epoch->tm_min;
-        result *= 60;
-        result += epoch->tm_sec;
-        return result;
+    void OutputBufferJson::buildSchemaColumns(OracleObject* object) {
+        std::string& str = object->jsonColumns;
+        str.append(",\"columns\":[");
+
+        bool hasPrev = false;
+        for (typeCOL column = 0; column < object->columns.size(); ++column) {
+            if (object->columns[column] == nullptr || object->columnSkipped(column))
+                continue;
+
+            if (hasPrev)
+                str.push_back(',');
+            else
+                hasPrev = true;
+
+            str.append("{\"name\":\"");
+            str.append(object->columns[column]->name);
+
+            str.append("\",\"type\":");
+            switch(object->columns[column]->typeNo) {
+            case 1: //varchar2(n), nvarchar(n)
+                str.append("\"varchar2\",\"length\":");
+                str.append(std::to_string(object->columns[column]->length));
+                break;
+
+            case 2: //number(p, s), float(p)
+                str.append("\"number\",\"precision\":");
+                str.append(std::to_string(object->columns[column]->precision));
+                str.append(",\"scale\":");
+                str.append(std::to_string(object->columns[column]->scale));
+                break;
+
+            case 8: //long, not supported
+                str.append("\"long\"");
+                break;
+
+            case 12: //date
+                str.append("\"date\"");
+                break;
+
+            case 23: //raw(n)
+                str.append("\"raw\",\"length\":");
+                str.append(std::to_string(object->columns[column]->length));
+                break;
+
+            case 24: //long raw, not supported
+                str.append("\"long raw\"");
+                break;
+
+            case 69: //rowid, not supported
+                str.append("\"rowid\"");
+                break;
+
+            case 96: //char(n), nchar(n)
+                str.append("\"char\",\"length\":");
+                str.append(std::to_string(object->columns[column]->length));
+                break;
+
+            case 100: //binary_float
+                str.append("\"binary_float\"");
+                break;
+
+            case 101: //binary_double
+                str.append("\"binary_double\"");
+                break;
+
+            case 112: //clob, nclob, not supported
+                str.append("\"clob\"");
+                break;
+
+            case 113: //blob, not supported
+                str.append("\"blob\"");
+                break;
+
+            case 180: //timestamp(n)
+                str.append("\"timestamp\",\"length\":");
+                str.append(std::to_string(object->columns[column]->length));
+                break;
+
+            case 181: //timestamp with time zone(n)
+                str.append("\"timestamp with time zone\",\"length\":");
+                str.append(std::to_string(object->columns[column]->length));
+                break;
+
+            case 182: //interval year to month(n)
+                str.append("\"interval year to month\",\"length\":");
+                str.append(std::to_string(object->columns[column]->length));
+                break;
+
+            case 183: //interval day to second(n)
+                str.append("\"interval day to second\",\"length\":");
+                str.append(std::to_string(object->columns[column]->length));
+                break;
+
+            case 208: //urawid(n)
+                str.append("\"urawid\",\"length\":");
+                str.append(std::to_string(object->columns[column]->length));
+                break;
+
+            case 231: //timestamp with local time zone(n), not supported
+                str.append("\"timestamp with local time zone\",\"length\":");
+                str.append(std::to_string(object->columns[column]->length));
+                break;
+
+            default:
+                str.append("\"unknown\"");
+                break;
+            }
+
+            str.append(",\"nullable\":");
+            if (object->columns[column]->nullable)
+                str.push_back('1');
+            else
+                str.push_back('0');
+
+            str.push_back('}');
+        }
+        str.push_back(']');
     }
 
     void OutputBufferJson::processBegin(void) {
@@ -448,6 +581,10 @@ namespace OpenLogReplicator {
         if ((messageFormat & MESSAGE_FORMAT_SKIP_BEGIN) != 0)
             return;
 
+        //begin of streamed transaction was already sent with first batch
+        if (streamed && (messageFormat & MESSAGE_FORMAT_FULL) == 0)
+            return;
+
         outputBufferBegin(0);
         outputBufferAppend('{');
         hasPreviousValue = false;
@@ -467,17 +604,21 @@ namespace OpenLogReplicator {
     }
 
     void OutputBufferJson::processCommit(void) {
-        //skip empty transaction
         if (newTran) {
-            newTran = false;
-            return;
+            //skip empty transaction, final commit of streamed transaction is always sent
+            if (!streamed || provisional) {
+                newTran = false;
+                provisional = false;
+                return;
+            }
+            processBegin();
         }
 
         if ((messageFormat & MESSAGE_FORMAT_FULL) != 0) {
             outputBufferAppend("]}");
             outputBufferCommit(true);
         } else
-        if ((messageFormat & MESSAGE_FORMAT_SKIP_COMMIT) == 0) {
+        if ((messageFormat & MESSAGE_FORMAT_SKIP_COMMIT) == 0 && !provisional) {
             outputBufferBegin(0);
             outputBufferAppend('{');
 
@@ -492,6 +633,24 @@ namespace OpenLogReplicator {
             outputBufferAppend("\"payload\":[{\"op\":\"commit\"}]}");
             outputBufferCommit(true);
         }
+        provisional = false;
+        num = 0;
+    }
+
+    void OutputBufferJson::processRollback(void) {
+        outputBufferBegin(0);
+        outputBufferAppend('{');
+
+        hasPreviousValue = false;
+        appendHeader(true, true);
+
+        if (hasPreviousValue)
+            outputBufferAppend(',');
+        else
+            hasPreviousValue = true;
+
+        outputBufferAppend("\"payload\":[{\"op\":\"rollback\"}]}");
+        outputBufferCommit(true);
         num = 0;
     }
 
@@ -616,6 +775,46 @@ namespace OpenLogReplicator {
         ++num;
     }
 
+    void OutputBufferJson::processUndo(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) {
+        if (newTran)
+            processBegin();
+
+        if ((messageFormat & MESSAGE_FORMAT_FULL) != 0) {
+            if (hasPreviousRedo)
+                outputBufferAppend(',');
+            else
+                hasPreviousRedo = true;
+        } else {
+            if (object != nullptr)
+                outputBufferBegin(object->obj);
+            else
+                outputBufferBegin(0);
+
+            outputBufferAppend('{');
+            hasPreviousValue = false;
+            appendHeader(false, true);
+
+            if (hasPreviousValue)
+                outputBufferAppend(',');
+            else
+                hasPreviousValue = true;
+
+            outputBufferAppend("\"payload\":[");
+        }
+
+        //the row is reverted to its state before the change sent earlier
+        outputBufferAppend("{\"op\":\"undo\",");
+        appendSchema(object, dataObj);
+        appendRowid(dataObj, bdba, slot);
+        outputBufferAppend('}');
+
+        if ((messageFormat & MESSAGE_FORMAT_FULL) == 0) {
+            outputBufferAppend("]}");
+            outputBufferCommit(false);
+        }
+        ++num;
+    }
+
     void OutputBufferJson::processDDL(OracleObject* object, typeDATAOBJ dataObj, uint16_t type, uint16_t seq, const char* operation, const char* sql, uint64_t sqlLength) {
         if (newTran)
             processBegin();
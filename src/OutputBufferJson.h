@@ -17,6 +17,7 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include "OracleColumn.h"
 #include "OracleObject.h"
 #include "OutputBuffer.h"
 
@@ -29,6 +30,8 @@ namespace OpenLogReplicator {
         bool hasPreviousValue;
         bool hasPreviousRedo;
         bool hasPreviousColumn;
+        static uint64_t (*escapeScan)(const char* str, uint64_t length);
+        static void (*hexEncode)(uint8_t* dst, const uint8_t* src, uint64_t length);
         virtual void columnNull(OracleObject* object, typeCOL col);
         virtual void columnFloat(std::string& columnName, float value);
         virtual void columnDouble(std::string& columnName, double value);
@@ -39,90 +42,105 @@ namespace OpenLogReplicator {
         virtual void appendRowid(typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot);
         virtual void appendHeader(bool first, bool showXid);
         virtual void appendSchema(OracleObject* object, typeDATAOBJ dataObj);
-
+        virtual void appendBatchBegin(void);
+        virtual void appendBatchSeparator(void);
+        virtual void appendBatchEnd(void);
+        void buildSchemaColumns(OracleObject* object);
+
+        void appendColumnKey(std::string& columnName) {
+            if (hasPreviousColumn)
+                outputBufferAppend(',');
+            else
+                hasPreviousColumn = true;
+
+            if (valueColumn != nullptr) {
+                if (valueColumn->jsonKey.length() == 0)
+                    valueColumn->jsonKey = "\"" + valueColumn->name + "\":";
+                outputBufferAppend(valueColumn->jsonKey);
+            } else {
+                outputBufferAppend('"');
+                outputBufferAppend(columnName);
+                outputBufferAppend("\":");
+            }
+        }
         void appendHex(uint64_t value, uint64_t length) {
+            char buffer[16];
             uint64_t j = (length - 1) * 4;
             for (uint64_t i = 0; i < length; ++i) {
-                outputBufferAppend(map16[(value >> j) & 0xF]);
+                buffer[i] = map16[(value >> j) & 0xF];
                 j -= 4;
             };
+            outputBufferAppend(buffer, length);
         }
         void appendDec(uint64_t value, uint64_t length) {
             char buffer[21];
 
             for (uint64_t i = 0; i < length; ++i) {
-                buffer[i] = '0' + (value % 10);
+                buffer[length - i - 1] = '0' + (value % 10);
                 value /= 10;
             }
-
-            for (uint64_t i = 0; i < length; ++i)
-                outputBufferAppend(buffer[length - i - 1]);
+            outputBufferAppend(buffer, length);
         }
         void appendDec(uint64_t value) {
             char buffer[21];
-            uint64_t length = 0;
-
-            if (value == 0) {
-                buffer[0] = '0';
-                length = 1;
-            } else {
-                while (value > 0) {
-                    buffer[length++] = '0' + (value % 10);
-                    value /= 10;
-                }
-            }
+            uint64_t pos = 21;
 
-            for (uint64_t i = 0; i < length; ++i)
-                outputBufferAppend(buffer[length - i - 1]);
+            do {
+                buffer[--pos] = '0' + (value % 10);
+                value /= 10;
+            } while (value > 0);
+            outputBufferAppend(buffer + pos, 21 - pos);
         }
         void appendSDec(int64_t value) {
             char buffer[22];
-            uint64_t length = 0;
-
-            if (value == 0) {
-                buffer[0] = '0';
-                length = 1;
-            } else {
-                if (value < 0) {
-                    value = -value;
-                    while (value > 0) {
-                        buffer[length++] = '0' + (value % 10);
-                        value /= 10;
-                    }
-                    buffer[length++] = '-';
-                } else {
-                    while (value > 0) {
-                        buffer[length++] = '0' + (value % 10);
-                        value /= 10;
-                    }
-                }
-            }
-
-            for (uint64_t i = 0; i < length; ++i)
-                outputBufferAppend(buffer[length - i - 1]);
+            uint64_t pos = 22;
+            uint64_t absValue = (value < 0) ? -(uint64_t)value : value;
+
+            do {
+                buffer[--pos] = '0' + (absValue % 10);
+                absValue /= 10;
+            } while (absValue > 0);
+            if (value < 0)
+                buffer[--pos] = '-';
+            outputBufferAppend(buffer + pos, 22 - pos);
         }
         void appendEscape(const char* str, uint64_t length) {
             while (length > 0) {
-                if (*str == '\t') {
-                    outputBufferAppend('\\');
-                    outputBufferAppend('t');
-                } else if (*str == '\r') {
-                    outputBufferAppend('\\');
-                    outputBufferAppend('r');
-                } else if (*str == '\n') {
-                    outputBufferAppend('\\');
-                    outputBufferAppend('n');
-                } else if (*str == '\f') {
-                    outputBufferAppend('\\');
-                    outputBufferAppend('f');
-                } else if (*str == '\b') {
+                //run of characters which don't need escaping
+                uint64_t run = escapeScan(str, length);
+                if (run > 0) {
+                    outputBufferAppend(str, run);
+                    str += run;
+                    length -= run;
+                    continue;
+                }
+
+                switch (*str) {
+                case '\t':
+                    outputBufferAppend("\\t", 2);
+                    break;
+                case '\r':
+                    outputBufferAppend("\\r", 2);
+                    break;
+                case '\n':
+                    outputBufferAppend("\\n", 2);
+                    break;
+                case '\f':
+                    outputBufferAppend("\\f", 2);
+                    break;
+                case '\b':
+                    outputBufferAppend("\\b", 2);
+                    break;
+                case 0:
+                    outputBufferAppend("\\u0000", 6);
+                    break;
+                case '"':
+                case '\\':
+                case '/':
                     outputBufferAppend('\\');
-                    outputBufferAppend('b');
-                } else if (*str == 0) {
-                    outputBufferAppend("\\u0000");
-                } else {
-                    if (*str == '"' || *str == '\\' || *str == '/')
-                        outputBufferAppend('\\');
+                    outputBufferAppend(*str);
+                    break;
+                default:
                     outputBufferAppend(*str);
                 }
                 ++str;
@@ -197,16 +215,17 @@ namespace OpenLogReplicator {
             }
             outputBufferAppend('}');
         }
-        time_t tmToEpoch(struct tm* epoch) const;
         virtual void processInsert(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
         virtual void processUpdate(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
         virtual void processDelete(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
+        virtual void processUndo(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
         virtual void processDDL(OracleObject* object, typeDATAOBJ dataObj, uint16_t type, uint16_t seq, const char* operation,
                 const char* sql, uint64_t sqlLength);
         virtual void processBegin(void);
+        virtual void processRollback(void);
     public:
         OutputBufferJson(uint64_t messageFormat, uint64_t ridFormat, uint64_t xidFormat, uint64_t timestampFormat, uint64_t charFormat, uint64_t scnFormat,
-                uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType, uint64_t flushBuffer);
+                uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType, uint64_t numberFormat, uint64_t flushBuffer);
         virtual ~OutputBufferJson();
 
         virtual void processCommit(void);
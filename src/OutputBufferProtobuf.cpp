@@ -27,9 +27,11 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     OutputBufferProtobuf::OutputBufferProtobuf(uint64_t messageFormat, uint64_t ridFormat, uint64_t xidFormat, uint64_t timestampFormat,
             uint64_t charFormat, uint64_t scnFormat, uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType,
-            uint64_t flushBuffer) :
+            uint64_t numberFormat, uint64_t flushBuffer) :
         OutputBuffer(messageFormat, ridFormat, xidFormat, timestampFormat, charFormat, scnFormat, unknownFormat, schemaFormat, columnFormat,
-                unknownType, flushBuffer),
+                unknownType, numberFormat, flushBuffer),
+        arena(nullptr),
+        arenaBlock(nullptr),
         redoResponsePB(nullptr),
         valuePB(nullptr),
         payloadPB(nullptr),
@@ -37,9 +39,15 @@ namespace OpenLogReplicator {
     }
 
     OutputBufferProtobuf::~OutputBufferProtobuf() {
-        if (redoResponsePB != nullptr) {
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
+        //messages are owned by the arena
+        redoResponsePB = nullptr;
+        if (arena != nullptr) {
+            delete arena;
+            arena = nullptr;
+        }
+        if (arenaBlock != nullptr) {
+            oracleAnalyzer->freeMemoryChunk(MEMORY_MODULE_PROTOBUF, arenaBlock, true);
+            arenaBlock = nullptr;
         }
         google::protobuf::ShutdownProtobufLibrary();
     }
@@ -48,6 +56,54 @@ namespace OpenLogReplicator {
         OutputBuffer::initialize(oracleAnalyzer);
 
         GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+        //one memory chunk is kept by the arena across resets, typical messages need no heap allocation
+        arenaBlock = oracleAnalyzer->getMemoryChunk(MEMORY_MODULE_PROTOBUF, true);
+        google::protobuf::ArenaOptions arenaOptions;
+        arenaOptions.initial_block = (char*)arenaBlock;
+        arenaOptions.initial_block_size = MEMORY_CHUNK_SIZE;
+        arena = new google::protobuf::Arena(arenaOptions);
+        if (arena == nullptr) {
+            RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(class google::protobuf::Arena) << " bytes memory (for: PB arena)");
+        }
+    }
+
+    OutputBufferProtobuf::ChunkOutputStream::ChunkOutputStream(OutputBufferProtobuf* outputBuffer) :
+        outputBuffer(outputBuffer),
+        pending(0),
+        byteCount(0) {
+    }
+
+    OutputBufferProtobuf::ChunkOutputStream::~ChunkOutputStream() {
+    }
+
+    bool OutputBufferProtobuf::ChunkOutputStream::Next(void** data, int* size) {
+        //previous block is full, rotation happens only at the chunk boundary
+        finish();
+
+        uint64_t length = OUTPUT_BUFFER_DATA_SIZE - outputBuffer->lastBuffer->length;
+        *data = outputBuffer->lastBuffer->data + outputBuffer->lastBuffer->length;
+        *size = length;
+        pending = length;
+        byteCount += length;
+        return true;
+    }
+
+    void OutputBufferProtobuf::ChunkOutputStream::BackUp(int count) {
+        pending -= count;
+        byteCount -= count;
+    }
+
+    int64_t OutputBufferProtobuf::ChunkOutputStream::ByteCount(void) const {
+        return byteCount;
+    }
+
+    void OutputBufferProtobuf::ChunkOutputStream::finish(void) {
+        if (pending == 0)
+            return;
+        outputBuffer->messageLength += pending;
+        outputBuffer->outputBufferShift(pending, true);
+        pending = 0;
     }
 
     void OutputBufferProtobuf::columnNull(OracleObject* object, typeCOL col) {
@@ -79,10 +135,8 @@ namespace OpenLogReplicator {
 
         if (object != nullptr)
             valuePB->set_name(object->columns[col]->name);
-        else {
-            std::string columnName("COL_" + std::to_string(col));
-            valuePB->set_name(columnName);
-        }
+        else
+            valuePB->set_name(unknownColumnName(col));
     }
 
     void OutputBufferProtobuf::columnFloat(std::string& columnName, float value) {
@@ -102,6 +156,20 @@ namespace OpenLogReplicator {
 
     void OutputBufferProtobuf::columnNumber(std::string& columnName, uint64_t precision, uint64_t scale) {
         valuePB->set_name(columnName);
+
+        if (numberFormat == NUMBER_FORMAT_NATIVE) {
+            if (!numberNative) {
+                valuePB->set_value_string(valueBuffer, valueLength);
+            } else if (numberScale == 0) {
+                valuePB->set_value_int(numberMantissa);
+            } else {
+                pb::Decimal* decimalPB = valuePB->mutable_value_decimal();
+                decimalPB->set_unscaled(numberMantissa);
+                decimalPB->set_scale(numberScale);
+            }
+            return;
+        }
+
         valueBuffer[valueLength] = 0;
         char* retPtr;
 
@@ -178,6 +246,9 @@ namespace OpenLogReplicator {
             } else {
                 redoResponsePB->set_xidn(lastXid);
             }
+
+            if (provisional)
+                redoResponsePB->set_provisional(true);
         }
     }
 
@@ -305,6 +376,46 @@ namespace OpenLogReplicator {
         }
     }
 
+    bool OutputBufferProtobuf::appendResponse(void) {
+        bool ret = true;
+        uint64_t size = redoResponsePB->ByteSizeLong();
+
+        //messages in a batch are length delimited
+        if (batchOpen) {
+            char buffer[10];
+            uint64_t length = 0;
+            uint64_t value = size;
+            while (value >= 0x80) {
+                buffer[length++] = (char)(value | 0x80);
+                value >>= 7;
+            }
+            buffer[length++] = (char)value;
+            outputBufferAppend(buffer, length);
+        }
+
+        uint8_t* data = outputBufferReserve(size);
+
+        //serialize directly to the chunk when the message fits, otherwise stream across chunks
+        if (data != nullptr) {
+            redoResponsePB->SerializeWithCachedSizesToArray(data);
+            outputBufferReserveCommit(size);
+        } else {
+            ChunkOutputStream chunkStream(this);
+            {
+                google::protobuf::io::CodedOutputStream codedStream(&chunkStream);
+                redoResponsePB->SerializeWithCachedSizes(&codedStream);
+                if (codedStream.HadError())
+                    ret = false;
+            }
+            chunkStream.finish();
+        }
+
+        //the message is the only object in the arena
+        redoResponsePB = nullptr;
+        arena->Reset();
+        return ret;
+    }
+
     void OutputBufferProtobuf::numToString(uint64_t value, char* buf, uint64_t length) {
         uint64_t j = (length - 1) * 4;
         for (uint64_t i = 0; i < length; ++i) {
@@ -316,6 +427,11 @@ namespace OpenLogReplicator {
 
     void OutputBufferProtobuf::processBegin(void) {
         newTran = false;
+
+        //begin of streamed transaction was already sent with first batch
+        if (streamed && (messageFormat & MESSAGE_FORMAT_FULL) == 0)
+            return;
+
         outputBufferBegin(0);
 
         createResponse();
@@ -326,30 +442,33 @@ namespace OpenLogReplicator {
             payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
             payloadPB->set_op(pb::BEGIN);
 
-            std::string output;
-            bool ret = redoResponsePB->SerializeToString(&output);
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-
-            if (!ret) {
+            if (!appendResponse()) {
                 RUNTIME_FAIL("PB begin processing failed, error serializing to string");
             }
-            outputBufferAppend(output);
             outputBufferCommit(false);
         }
     }
 
     void OutputBufferProtobuf::processCommit(void) {
-        //skip empty transaction
         if (newTran) {
-            newTran = false;
-            return;
+            //skip empty transaction, final commit of streamed transaction is always sent
+            if (!streamed || provisional) {
+                newTran = false;
+                provisional = false;
+                return;
+            }
+            processBegin();
         }
 
         if ((messageFormat & MESSAGE_FORMAT_FULL) != 0) {
             if (redoResponsePB == nullptr) {
                 RUNTIME_FAIL("PB commit processing failed, message missing, internal error");
             }
+        } else if (provisional) {
+            //batch of streamed transaction, rows are already sent
+            provisional = false;
+            num = 0;
+            return;
         } else {
             outputBufferBegin(0);
 
@@ -361,17 +480,27 @@ namespace OpenLogReplicator {
             payloadPB->set_op(pb::COMMIT);
         }
 
-        std::string output;
-        bool ret = redoResponsePB->SerializeToString(&output);
-        delete redoResponsePB;
-        redoResponsePB = nullptr;
-
-        if (!ret) {
+        if (!appendResponse()) {
             RUNTIME_FAIL("PB commit processing failed, error serializing to string");
         }
-        outputBufferAppend(output);
         outputBufferCommit(true);
 
+        provisional = false;
+        num = 0;
+    }
+
+    void OutputBufferProtobuf::processRollback(void) {
+        outputBufferBegin(0);
+        createResponse();
+        appendHeader(true, true);
+        redoResponsePB->add_payload();
+        payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
+        payloadPB->set_op(pb::ROLLBACK);
+
+        if (!appendResponse()) {
+            RUNTIME_FAIL("PB rollback processing failed, error serializing to string");
+        }
+        outputBufferCommit(true);
         num = 0;
     }
 
@@ -403,15 +532,9 @@ namespace OpenLogReplicator {
         appendAfter(object);
 
         if ((messageFormat & MESSAGE_FORMAT_FULL) == 0) {
-            std::string output;
-            bool ret = redoResponsePB->SerializeToString(&output);
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-
-            if (!ret) {
+            if (!appendResponse()) {
                 RUNTIME_FAIL("PB insert processing failed, error serializing to string");
             }
-            outputBufferAppend(output);
             outputBufferCommit(false);
         }
         ++num;
@@ -446,15 +569,9 @@ namespace OpenLogReplicator {
         appendAfter(object);
 
         if ((messageFormat & MESSAGE_FORMAT_FULL) == 0) {
-            std::string output;
-            bool ret = redoResponsePB->SerializeToString(&output);
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-
-            if (!ret) {
+            if (!appendResponse()) {
                 RUNTIME_FAIL("PB update processing failed, error serializing to string");
             }
-            outputBufferAppend(output);
             outputBufferCommit(false);
         }
         ++num;
@@ -489,15 +606,44 @@ namespace OpenLogReplicator {
         appendBefore(object);
 
         if ((messageFormat & MESSAGE_FORMAT_FULL) == 0) {
-            std::string output;
-            bool ret = redoResponsePB->SerializeToString(&output);
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-
-            if (!ret) {
+            if (!appendResponse()) {
                 RUNTIME_FAIL("PB delete processing failed, error serializing to string");
             }
-            outputBufferAppend(output);
+            outputBufferCommit(false);
+        }
+        ++num;
+    }
+
+    void OutputBufferProtobuf::processUndo(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid) {
+        if (newTran)
+            processBegin();
+
+        if ((messageFormat & MESSAGE_FORMAT_FULL) != 0) {
+            if (redoResponsePB == nullptr) {
+                RUNTIME_FAIL("PB undo processing failed, message missing, internal error");
+            }
+        } else {
+            if (object != nullptr)
+                outputBufferBegin(object->obj);
+            else
+                outputBufferBegin(0);
+
+            createResponse();
+            appendHeader(true, true);
+        }
+
+        redoResponsePB->add_payload();
+        payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
+        payloadPB->set_op(pb::UNDO);
+
+        schemaPB = payloadPB->mutable_schema();
+        appendSchema(object, dataObj);
+        appendRowid(dataObj, bdba, slot);
+
+        if ((messageFormat & MESSAGE_FORMAT_FULL) == 0) {
+            if (!appendResponse()) {
+                RUNTIME_FAIL("PB undo processing failed, error serializing to string");
+            }
             outputBufferCommit(false);
         }
         ++num;
@@ -522,15 +668,9 @@ namespace OpenLogReplicator {
         }
 
         if ((messageFormat & MESSAGE_FORMAT_FULL) == 0) {
-            std::string output;
-            bool ret = redoResponsePB->SerializeToString(&output);
-            delete redoResponsePB;
-            redoResponsePB = nullptr;
-
-            if (!ret) {
+            if (!appendResponse()) {
                 RUNTIME_FAIL("PB commit processing failed, error serializing to string");
             }
-            outputBufferAppend(output);
             outputBufferCommit(true);
         }
         ++num;
@@ -548,15 +688,9 @@ namespace OpenLogReplicator {
         payloadPB->set_offset(offset);
         payloadPB->set_redo(redo);
 
-        std::string output;
-        bool ret = redoResponsePB->SerializeToString(&output);
-        delete redoResponsePB;
-        redoResponsePB = nullptr;
-
-        if (!ret) {
+        if (!appendResponse()) {
             RUNTIME_FAIL("PB commit processing failed, error serializing to string");
         }
-        outputBufferAppend(output);
         outputBufferCommit(true);
     }
 }
@@ -17,6 +17,10 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <google/protobuf/arena.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream.h>
+
 #include "OracleObject.h"
 #include "OraProtoBuf.pb.h"
 #include "OutputBuffer.h"
@@ -27,6 +31,24 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     class OutputBufferProtobuf : public OutputBuffer {
     protected:
+        //serialization target spanning output buffer chunks, used when a message doesn't fit in the current chunk
+        class ChunkOutputStream : public google::protobuf::io::ZeroCopyOutputStream {
+        protected:
+            OutputBufferProtobuf* outputBuffer;
+            uint64_t pending;
+            int64_t byteCount;
+
+        public:
+            ChunkOutputStream(OutputBufferProtobuf* outputBuffer);
+            virtual ~ChunkOutputStream();
+            virtual bool Next(void** data, int* size);
+            virtual void BackUp(int count);
+            virtual int64_t ByteCount(void) const;
+            void finish(void);
+        };
+
+        google::protobuf::Arena* arena;
+        uint8_t* arenaBlock;
         pb::RedoResponse* redoResponsePB;
         pb::Value* valuePB;
         pb::Payload* payloadPB;
@@ -126,21 +148,24 @@ namespace OpenLogReplicator {
             if (redoResponsePB != nullptr) {
                 RUNTIME_FAIL("PB commit processing failed, message already exists, internal error");
             }
-            redoResponsePB = new pb::RedoResponse;
+            redoResponsePB = google::protobuf::Arena::CreateMessage<pb::RedoResponse>(arena);
             if (redoResponsePB == nullptr) {
                 RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(class pb::RedoResponse) << " bytes memory (for: PB response7)");
             }
         }
         void numToString(uint64_t value, char* buf, uint64_t length);
+        bool appendResponse(void);
         virtual void processInsert(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
         virtual void processUpdate(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
         virtual void processDelete(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
+        virtual void processUndo(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, typeXID xid);
         virtual void processDDL(OracleObject* object, typeDATAOBJ dataObj, uint16_t type, uint16_t seq, const char* operation,
                 const char* sql, uint64_t sqlLength);
         virtual void processBegin(void);
+        virtual void processRollback(void);
     public:
         OutputBufferProtobuf(uint64_t messageFormat, uint64_t ridFormat, uint64_t xidFormat, uint64_t timestampFormat, uint64_t charFormat,
-                uint64_t scnFormat, uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType, uint64_t flushBuffer);
+                uint64_t scnFormat, uint64_t unknownFormat, uint64_t schemaFormat, uint64_t columnFormat, uint64_t unknownType, uint64_t numberFormat, uint64_t flushBuffer);
         virtual ~OutputBufferProtobuf();
 
         virtual void initialize(OracleAnalyzer* oracleAnalyzer);
@@ -0,0 +1,516 @@
+/* Column buffers of one table written as a Parquet file
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef LINK_LIBRARY_SNAPPY
+#include <snappy-c.h>
+#endif /* LINK_LIBRARY_SNAPPY */
+#ifdef LINK_LIBRARY_ZSTD
+#include <zstd.h>
+#endif /* LINK_LIBRARY_ZSTD */
+
+#include "global.h"
+#include "ParquetTable.h"
+#include "RuntimeException.h"
+
+namespace OpenLogReplicator {
+    static void appendVarint(std::string& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back((char)(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back((char)value);
+    }
+
+    //Thrift compact protocol, only the subset used by Parquet metadata
+    class ThriftCompact {
+    protected:
+        std::string& out;
+        std::vector<int16_t> lastField;
+
+        void fieldHeader(uint8_t type, int16_t id) {
+            int16_t delta = id - lastField.back();
+            if (delta > 0 && delta <= 15)
+                out.push_back((char)((delta << 4) | type));
+            else {
+                out.push_back((char)type);
+                appendVarint(out, (uint16_t)((id << 1) ^ (id >> 15)));
+            }
+            lastField.back() = id;
+        }
+
+    public:
+        ThriftCompact(std::string& out) :
+            out(out) {
+            lastField.push_back(0);
+        }
+
+        void structBegin(void) {
+            lastField.push_back(0);
+        }
+        void structEnd(void) {
+            out.push_back(0);
+            lastField.pop_back();
+        }
+        void listBegin(int16_t id, uint8_t elementType, uint64_t size) {
+            fieldHeader(9, id);
+            if (size < 15)
+                out.push_back((char)((size << 4) | elementType));
+            else {
+                out.push_back((char)(0xF0 | elementType));
+                appendVarint(out, size);
+            }
+        }
+        void fieldStruct(int16_t id) {
+            fieldHeader(12, id);
+            structBegin();
+        }
+        void fieldI32(int16_t id, int32_t value) {
+            fieldHeader(5, id);
+            valueI32(value);
+        }
+        void fieldI64(int16_t id, int64_t value) {
+            fieldHeader(6, id);
+            appendVarint(out, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+        }
+        void fieldBinary(int16_t id, const std::string& value) {
+            fieldHeader(8, id);
+            valueBinary(value);
+        }
+        void valueI32(int32_t value) {
+            appendVarint(out, (uint32_t)(((uint32_t)value << 1) ^ (uint32_t)(value >> 31)));
+        }
+        void valueBinary(const std::string& value) {
+            appendVarint(out, value.length());
+            out.append(value);
+        }
+    };
+
+    template<class T> static uint64_t runLength(const T* values, uint64_t pos, uint64_t count, uint64_t limit) {
+        uint64_t end = pos + limit;
+        if (end > count)
+            end = count;
+        uint64_t i = pos + 1;
+        while (i < end && values[i] == values[pos])
+            ++i;
+        return i - pos;
+    }
+
+    //RLE/bit-packing hybrid: runs of 8 or more equal values are RLE, the rest is bit-packed in groups of 8
+    template<class T> static void appendHybrid(std::string& out, const T* values, uint64_t count, uint64_t bitWidth) {
+        uint64_t byteWidth = (bitWidth + 7) / 8;
+        uint64_t i = 0;
+
+        while (i < count) {
+            uint64_t run = runLength(values, i, count, count);
+            if (run >= 8) {
+                appendVarint(out, run << 1);
+                for (uint64_t j = 0; j < byteWidth; ++j)
+                    out.push_back((char)((uint64_t)values[i] >> (j * 8)));
+                i += run;
+                continue;
+            }
+
+            //literal groups stop where a long run starts, padding is allowed only at the end
+            uint64_t start = i;
+            do {
+                i += 8;
+            } while (i < count && runLength(values, i, count, 8) < 8);
+            if (i > count)
+                i = count;
+
+            uint64_t groups = (i - start + 7) / 8;
+            appendVarint(out, (groups << 1) | 1);
+            uint64_t buffer = 0;
+            uint64_t bits = 0;
+            for (uint64_t j = start; j < start + groups * 8; ++j) {
+                if (j < i)
+                    buffer |= (uint64_t)values[j] << bits;
+                bits += bitWidth;
+                while (bits >= 8) {
+                    out.push_back((char)buffer);
+                    buffer >>= 8;
+                    bits -= 8;
+                }
+            }
+        }
+    }
+
+    static uint64_t bitWidth(uint64_t maxValue) {
+        uint64_t width = 1;
+        while ((maxValue >> width) != 0)
+            ++width;
+        return width;
+    }
+
+    ParquetTable::ParquetTable(const char* name, uint64_t codec) :
+        outputDes(-1),
+        fileOffset(0),
+        codec(codec),
+        name(name),
+        rows(0) {
+    }
+
+    ParquetTable::~ParquetTable() {
+        for (ParquetColumn* column : columns)
+            delete column;
+        columns.clear();
+
+        if (outputDes != -1) {
+            close(outputDes);
+            outputDes = -1;
+        }
+    }
+
+    void ParquetTable::addColumn(const std::vector<std::string>& groups, const char* name, uint64_t type, uint64_t convertedType,
+            uint64_t maxDefinition) {
+        ParquetColumn* column = new ParquetColumn();
+        if (column == nullptr) {
+            RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(ParquetColumn) << " bytes memory (for: parquet column)");
+        }
+        column->groups = groups;
+        column->name = name;
+        column->type = type;
+        column->convertedType = convertedType;
+        column->maxDefinition = maxDefinition;
+        column->values = 0;
+        column->dictionaryEnabled = (type != PARQUET_TYPE_BOOLEAN);
+        columns.push_back(column);
+    }
+
+    //columns of a group are consecutive, number of leading groups the same as of the previous column
+    uint64_t ParquetTable::sharedGroups(uint64_t col) const {
+        if (col == 0)
+            return 0;
+        const std::vector<std::string>& groups = columns[col]->groups;
+        const std::vector<std::string>& previous = columns[col - 1]->groups;
+        uint64_t shared = 0;
+        while (shared < groups.size() && shared < previous.size() && groups[shared] == previous[shared])
+            ++shared;
+        return shared;
+    }
+
+    //children of the group at depth opened by column col: a child starts where exactly depth groups are shared
+    uint64_t ParquetTable::groupChildren(uint64_t col, uint64_t depth) const {
+        uint64_t children = 1;
+        for (uint64_t i = col + 1; i < columns.size(); ++i) {
+            uint64_t shared = sharedGroups(i);
+            if (shared < depth)
+                break;
+            if (shared == depth)
+                ++children;
+        }
+        return children;
+    }
+
+    void ParquetTable::appendPlain(ParquetColumn* column, const char* data, uint64_t length) {
+        if (column->maxDefinition > 0)
+            column->definitions.push_back(column->maxDefinition);
+        column->plain.append(data, length);
+        ++column->values;
+
+        if (!column->dictionaryEnabled)
+            return;
+
+        std::string key(data, length);
+        std::unordered_map<std::string, uint32_t>::iterator it = column->dictionary.find(key);
+        if (it != column->dictionary.end()) {
+            column->indexes.push_back(it->second);
+            return;
+        }
+
+        //high cardinality column, fall back to PLAIN for this row group
+        if (column->dictionaryPlain.length() + length > PARQUET_DICTIONARY_MAX_SIZE) {
+            column->dictionaryEnabled = false;
+            column->dictionary.clear();
+            column->dictionaryPlain.clear();
+            column->indexes.clear();
+            return;
+        }
+
+        uint32_t index = column->dictionary.size();
+        column->dictionary[key] = index;
+        column->dictionaryPlain.append(data, length);
+        column->indexes.push_back(index);
+    }
+
+    void ParquetTable::appendNull(uint64_t col, uint64_t definition) {
+        columns[col]->definitions.push_back(definition);
+    }
+
+    void ParquetTable::appendBoolean(uint64_t col, bool value) {
+        char buffer = value ? 1 : 0;
+        appendPlain(columns[col], &buffer, 1);
+    }
+
+    void ParquetTable::appendInt64(uint64_t col, int64_t value) {
+        char buffer[8];
+        for (uint64_t i = 0; i < 8; ++i)
+            buffer[i] = (char)((uint64_t)value >> (i * 8));
+        appendPlain(columns[col], buffer, 8);
+    }
+
+    void ParquetTable::appendFloat(uint64_t col, const char* data) {
+        appendPlain(columns[col], data, 4);
+    }
+
+    void ParquetTable::appendDouble(uint64_t col, const char* data) {
+        appendPlain(columns[col], data, 8);
+    }
+
+    void ParquetTable::appendBytes(uint64_t col, const char* data, uint64_t length) {
+        std::string value;
+        value.reserve(length + 4);
+        for (uint64_t i = 0; i < 4; ++i)
+            value.push_back((char)(length >> (i * 8)));
+        value.append(data, length);
+        appendPlain(columns[col], value.c_str(), value.length());
+    }
+
+    void ParquetTable::writeData(const std::string& data) {
+        int64_t bytesWritten = ::write(outputDes, data.c_str(), data.length());
+        if (bytesWritten != (int64_t)data.length()) {
+            RUNTIME_FAIL("writing file: " << fileName << " - " << strerror(errno));
+        }
+        fileOffset += bytesWritten;
+    }
+
+    //page body in the codec of the column chunk, the buffer is reused by all pages
+    const std::string& ParquetTable::compressPage(const std::string& page) {
+        switch (codec) {
+#ifdef LINK_LIBRARY_SNAPPY
+        case PARQUET_CODEC_SNAPPY: {
+            size_t length = snappy_max_compressed_length(page.length());
+            compressed.resize(length);
+            if (snappy_compress(page.c_str(), page.length(), &compressed[0], &length) != SNAPPY_OK) {
+                RUNTIME_FAIL("compressing page of file: " << fileName << " - snappy error");
+            }
+            compressed.resize(length);
+            return compressed;
+        }
+#endif /* LINK_LIBRARY_SNAPPY */
+#ifdef LINK_LIBRARY_ZSTD
+        case PARQUET_CODEC_ZSTD: {
+            compressed.resize(ZSTD_compressBound(page.length()));
+            size_t length = ZSTD_compress(&compressed[0], compressed.length(), page.c_str(), page.length(), PARQUET_ZSTD_LEVEL);
+            if (ZSTD_isError(length)) {
+                RUNTIME_FAIL("compressing page of file: " << fileName << " - " << ZSTD_getErrorName(length));
+            }
+            compressed.resize(length);
+            return compressed;
+        }
+#endif /* LINK_LIBRARY_ZSTD */
+        default:
+            return page;
+        }
+    }
+
+    void ParquetTable::writeColumn(ParquetColumn* column, std::string& metaData) {
+        uint64_t chunkOffset = fileOffset;
+        uint64_t dictionaryOffset = 0;
+        uint64_t uncompressedSize = 0;
+        bool useDictionary = column->dictionaryEnabled && column->dictionary.size() > 0;
+
+        if (useDictionary) {
+            const std::string& body = compressPage(column->dictionaryPlain);
+            std::string header;
+            ThriftCompact pageHeader(header);
+            pageHeader.fieldI32(1, 2);
+            pageHeader.fieldI32(2, column->dictionaryPlain.length());
+            pageHeader.fieldI32(3, body.length());
+            pageHeader.fieldStruct(7);
+            pageHeader.fieldI32(1, column->dictionary.size());
+            pageHeader.fieldI32(2, 0);
+            pageHeader.structEnd();
+            pageHeader.structEnd();
+
+            dictionaryOffset = fileOffset;
+            uncompressedSize += header.length() + column->dictionaryPlain.length();
+            writeData(header);
+            writeData(body);
+        }
+
+        //definition levels are prefixed with their length, repetition levels are not used
+        std::string page;
+        if (column->maxDefinition > 0) {
+            page.append(4, 0);
+            appendHybrid(page, column->definitions.data(), column->definitions.size(), bitWidth(column->maxDefinition));
+            uint64_t length = page.length() - 4;
+            for (uint64_t i = 0; i < 4; ++i)
+                page[i] = (char)(length >> (i * 8));
+        }
+
+        if (useDictionary) {
+            uint64_t width = bitWidth(column->dictionary.size() - 1);
+            page.push_back((char)width);
+            appendHybrid(page, column->indexes.data(), column->indexes.size(), width);
+        } else if (column->type == PARQUET_TYPE_BOOLEAN) {
+            uint8_t buffer = 0;
+            for (uint64_t i = 0; i < column->plain.length(); ++i) {
+                if (column->plain[i] != 0)
+                    buffer |= 1 << (i & 7);
+                if ((i & 7) == 7) {
+                    page.push_back((char)buffer);
+                    buffer = 0;
+                }
+            }
+            if ((column->plain.length() & 7) != 0)
+                page.push_back((char)buffer);
+        } else
+            page.append(column->plain);
+
+        const std::string& body = compressPage(page);
+        std::string header;
+        ThriftCompact pageHeader(header);
+        pageHeader.fieldI32(1, 0);
+        pageHeader.fieldI32(2, page.length());
+        pageHeader.fieldI32(3, body.length());
+        pageHeader.fieldStruct(5);
+        pageHeader.fieldI32(1, rows);
+        pageHeader.fieldI32(2, useDictionary ? 8 : 0);
+        pageHeader.fieldI32(3, 3);
+        pageHeader.fieldI32(4, 3);
+        pageHeader.structEnd();
+        pageHeader.structEnd();
+
+        uint64_t dataOffset = fileOffset;
+        uncompressedSize += header.length() + page.length();
+        writeData(header);
+        writeData(body);
+
+        //column chunk as element of row group column list
+        ThriftCompact chunk(metaData);
+        chunk.fieldI64(2, chunkOffset);
+        chunk.fieldStruct(3);
+        chunk.fieldI32(1, column->type);
+        if (useDictionary) {
+            chunk.listBegin(2, 5, 3);
+            chunk.valueI32(0);
+            chunk.valueI32(3);
+            chunk.valueI32(8);
+        } else {
+            chunk.listBegin(2, 5, 2);
+            chunk.valueI32(0);
+            chunk.valueI32(3);
+        }
+        chunk.listBegin(3, 8, column->groups.size() + 1);
+        for (const std::string& group : column->groups)
+            chunk.valueBinary(group);
+        chunk.valueBinary(column->name);
+        chunk.fieldI32(4, codec);
+        chunk.fieldI64(5, rows);
+        chunk.fieldI64(6, uncompressedSize);
+        chunk.fieldI64(7, fileOffset - chunkOffset);
+        chunk.fieldI64(9, dataOffset);
+        if (useDictionary)
+            chunk.fieldI64(11, dictionaryOffset);
+        chunk.structEnd();
+        chunk.structEnd();
+    }
+
+    //whole buffer is written as one row group with one data page per column
+    void ParquetTable::write(const std::string& fileName) {
+        this->fileName = fileName + ".tmp";
+        outputDes = open(this->fileName.c_str(), O_CREAT | O_WRONLY | O_TRUNC | O_LARGEFILE, S_IRUSR | S_IWUSR);
+        if (outputDes == -1) {
+            RUNTIME_FAIL("opening in write mode file: " << this->fileName << " - " << strerror(errno));
+        }
+        fileOffset = 0;
+        writeData("PAR1");
+
+        std::string chunks;
+        for (ParquetColumn* column : columns)
+            writeColumn(column, chunks);
+        uint64_t dataSize = fileOffset - 4;
+
+        std::string footer;
+        ThriftCompact metaData(footer);
+        metaData.fieldI32(1, 1);
+
+        uint64_t elements = 1;
+        for (uint64_t i = 0; i < columns.size(); ++i)
+            elements += columns[i]->groups.size() - sharedGroups(i) + 1;
+
+        metaData.listBegin(2, 12, elements);
+        metaData.structBegin();
+        metaData.fieldBinary(4, "schema");
+        metaData.fieldI32(5, groupChildren(0, 0));
+        metaData.structEnd();
+        for (uint64_t i = 0; i < columns.size(); ++i) {
+            ParquetColumn* column = columns[i];
+            //groups are opened by their first column
+            for (uint64_t depth = sharedGroups(i); depth < column->groups.size(); ++depth) {
+                metaData.structBegin();
+                metaData.fieldI32(3, 1);
+                metaData.fieldBinary(4, column->groups[depth]);
+                metaData.fieldI32(5, groupChildren(i, depth + 1));
+                metaData.structEnd();
+            }
+
+            metaData.structBegin();
+            metaData.fieldI32(1, column->type);
+            metaData.fieldI32(3, column->maxDefinition > column->groups.size() ? 1 : 0);
+            metaData.fieldBinary(4, column->name);
+            if (column->convertedType != PARQUET_CONVERTED_NONE)
+                metaData.fieldI32(6, column->convertedType);
+            metaData.structEnd();
+        }
+
+        metaData.fieldI64(3, rows);
+        metaData.listBegin(4, 12, 1);
+        metaData.structBegin();
+        metaData.listBegin(1, 12, columns.size());
+        footer.append(chunks);
+        metaData.fieldI64(2, dataSize);
+        metaData.fieldI64(3, rows);
+        metaData.structEnd();
+        metaData.fieldBinary(6, "OpenLogReplicator");
+        metaData.structEnd();
+
+        uint64_t footerLength = footer.length();
+        for (uint64_t i = 0; i < 4; ++i)
+            footer.push_back((char)(footerLength >> (i * 8)));
+        footer.append("PAR1");
+        writeData(footer);
+
+        close(outputDes);
+        outputDes = -1;
+        if (rename(this->fileName.c_str(), fileName.c_str()) != 0) {
+            RUNTIME_FAIL("can't rename file: " << this->fileName << " to " << fileName << " - " << strerror(errno));
+        }
+        this->fileName = fileName;
+    }
+
+    void ParquetTable::clear(void) {
+        for (ParquetColumn* column : columns) {
+            column->values = 0;
+            column->definitions.clear();
+            column->plain.clear();
+            column->dictionaryEnabled = (column->type != PARQUET_TYPE_BOOLEAN);
+            column->dictionary.clear();
+            column->dictionaryPlain.clear();
+            column->indexes.clear();
+        }
+        rows = 0;
+    }
+}
@@ -0,0 +1,100 @@
+/* Header for ParquetTable class
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <unordered_map>
+#include <vector>
+
+#include "types.h"
+
+#ifndef PARQUETTABLE_H_
+#define PARQUETTABLE_H_
+
+#define PARQUET_TYPE_BOOLEAN                0
+#define PARQUET_TYPE_INT64                  2
+#define PARQUET_TYPE_FLOAT                  4
+#define PARQUET_TYPE_DOUBLE                 5
+#define PARQUET_TYPE_BYTE_ARRAY             6
+
+#define PARQUET_CONVERTED_NONE              0xFFFF
+#define PARQUET_CONVERTED_UTF8              0
+#define PARQUET_CONVERTED_TIMESTAMP_MILLIS  9
+#define PARQUET_CONVERTED_TIMESTAMP_MICROS  10
+
+#define PARQUET_CODEC_UNCOMPRESSED          0
+#define PARQUET_CODEC_SNAPPY                1
+#define PARQUET_CODEC_ZSTD                  6
+#define PARQUET_ZSTD_LEVEL                  3
+
+#define PARQUET_DICTIONARY_MAX_SIZE         1048576
+
+namespace OpenLogReplicator {
+    struct ParquetColumn {
+        //enclosing groups from the root, each group is optional and adds a definition level
+        std::vector<std::string> groups;
+        std::string name;
+        uint64_t type;
+        uint64_t convertedType;
+        uint64_t maxDefinition;
+        uint64_t values;
+        std::vector<uint8_t> definitions;
+        //non-null values in PLAIN encoding, booleans as one byte per value
+        std::string plain;
+        //dictionary is dropped for the whole chunk once it grows over PARQUET_DICTIONARY_MAX_SIZE
+        bool dictionaryEnabled;
+        std::unordered_map<std::string, uint32_t> dictionary;
+        std::string dictionaryPlain;
+        std::vector<uint32_t> indexes;
+    };
+
+    class ParquetTable {
+    protected:
+        std::string fileName;
+        int64_t outputDes;
+        uint64_t fileOffset;
+        uint64_t codec;
+        std::string compressed;
+
+        const std::string& compressPage(const std::string& page);
+        void appendPlain(ParquetColumn* column, const char* data, uint64_t length);
+        void writeData(const std::string& data);
+        void writeColumn(ParquetColumn* column, std::string& metaData);
+        uint64_t sharedGroups(uint64_t col) const;
+        uint64_t groupChildren(uint64_t col, uint64_t depth) const;
+
+    public:
+        std::string name;
+        std::vector<ParquetColumn*> columns;
+        uint64_t rows;
+
+        ParquetTable(const char* name, uint64_t codec);
+        virtual ~ParquetTable();
+
+        void addColumn(const std::vector<std::string>& groups, const char* name, uint64_t type, uint64_t convertedType, uint64_t maxDefinition);
+        void appendNull(uint64_t col, uint64_t definition);
+        void appendBoolean(uint64_t col, bool value);
+        void appendInt64(uint64_t col, int64_t value);
+        void appendFloat(uint64_t col, const char* data);
+        void appendDouble(uint64_t col, const char* data);
+        void appendBytes(uint64_t col, const char* data, uint64_t length);
+        void write(const std::string& fileName);
+        void clear(void);
+    };
+}
+
+#endif
@@ -716,7 +716,7 @@ namespace OpenLogReplicator {
 
     void Reader::bufferAllocate(uint64_t num) {
         if (redoBufferList[num] == nullptr) {
-            redoBufferList[num] = oracleAnalyzer->getMemoryChunk("disk read buffer", false);
+            redoBufferList[num] = oracleAnalyzer->getMemoryChunk(MEMORY_MODULE_READ_BUFFER, false);
             if (redoBufferList[num] == nullptr || buffersFree == 0) {
                 RUNTIME_FAIL("couldn't allocate " << std::dec << MEMORY_CHUNK_SIZE << " bytes memory (for: read buffer)");
             }
@@ -732,7 +732,7 @@ namespace OpenLogReplicator {
 
     void Reader::bufferFree(uint64_t num) {
         if (redoBufferList[num] != nullptr) {
-            oracleAnalyzer->freeMemoryChunk("disk read buffer", redoBufferList[num], false);
+            oracleAnalyzer->freeMemoryChunk(MEMORY_MODULE_READ_BUFFER, redoBufferList[num], false);
             redoBufferList[num] = nullptr;
             {
                 std::unique_lock<std::mutex> lck(oracleAnalyzer->mtx);
@@ -68,7 +68,7 @@ namespace OpenLogReplicator {
 
         memset(&zero, 0, sizeof(struct RedoLogRecord));
 
-        lwnChunks[0] = oracleAnalyzer->getMemoryChunk("LWN transaction chunk", false);
+        lwnChunks[0] = oracleAnalyzer->getMemoryChunk(MEMORY_MODULE_LWN, false);
         uint64_t* length = (uint64_t*) lwnChunks[0];
         *length = sizeof(uint64_t);
         lwnAllocated = 1;
@@ -77,7 +77,7 @@ namespace OpenLogReplicator {
 
     RedoLog::~RedoLog() {
         while (lwnAllocated > 0)
-            oracleAnalyzer->freeMemoryChunk("LWN transaction chunk", lwnChunks[--lwnAllocated], false);
+            oracleAnalyzer->freeMemoryChunk(MEMORY_MODULE_LWN, lwnChunks[--lwnAllocated], false);
 
         for (uint64_t i = 0; i < vectors; ++i) {
             if (opCodes[i] != nullptr) {
@@ -258,7 +258,7 @@ namespace OpenLogReplicator {
 
     void RedoLog::freeLwn(void) {
         while (lwnAllocated > 1)
-            oracleAnalyzer->freeMemoryChunk("LWN transaction chunk", lwnChunks[--lwnAllocated], false);
+            oracleAnalyzer->freeMemoryChunk(MEMORY_MODULE_LWN, lwnChunks[--lwnAllocated], false);
 
         uint64_t* length = (uint64_t*) lwnChunks[0];
         *length = sizeof(uint64_t);
@@ -703,6 +703,8 @@ namespace OpenLogReplicator {
         //transaction size limit
         if (oracleAnalyzer->transactionMax > 0 &&
                 transaction->size + redoLogRecord->length + ROW_HEADER_TOTAL >= oracleAnalyzer->transactionMax) {
+            if (transaction->streamed)
+                oracleAnalyzer->outputBuffer->processRollback(lwnTimestamp, transaction->xid);
             oracleAnalyzer->skipXidList.insert(transaction->xid);
             oracleAnalyzer->xidTransactionMap.erase(xidMap);
             delete transaction;
@@ -765,6 +767,8 @@ namespace OpenLogReplicator {
         //transaction size limit
         if (oracleAnalyzer->transactionMax > 0 &&
                 transaction->size + redoLogRecord->length + ROW_HEADER_TOTAL >= oracleAnalyzer->transactionMax) {
+            if (transaction->streamed)
+                oracleAnalyzer->outputBuffer->processRollback(lwnTimestamp, transaction->xid);
             oracleAnalyzer->skipXidList.insert(transaction->xid);
             oracleAnalyzer->xidTransactionMap.erase(xidMap);
             delete transaction;
@@ -797,6 +801,7 @@ namespace OpenLogReplicator {
         oracleAnalyzer->xidTransactionMap[xidMap] = transaction;
 
         transaction->begin = true;
+        transaction->firstScn = redoLogRecord->scnRecord;
         transaction->firstSequence = sequence;
         transaction->firstOffset = lwnCheckpointBlock * reader->blockSize;
     }
@@ -971,6 +976,8 @@ namespace OpenLogReplicator {
                 //transaction size limit
                 if (oracleAnalyzer->transactionMax > 0 &&
                         transaction->size + redoLogRecord1->length + redoLogRecord2->length + ROW_HEADER_TOTAL >= oracleAnalyzer->transactionMax) {
+                    if (transaction->streamed)
+                        oracleAnalyzer->outputBuffer->processRollback(lwnTimestamp, transaction->xid);
                     oracleAnalyzer->skipXidList.insert(transaction->xid);
                     oracleAnalyzer->xidTransactionMap.erase(xidMap);
                     delete transaction;
@@ -979,6 +986,11 @@ namespace OpenLogReplicator {
 
                 transaction->add(redoLogRecord1, redoLogRecord2);
                 transaction->shutdown = shutdownFound;
+
+                //send very big transactions before commit, only when started after the checkpoint
+                if (oracleAnalyzer->transactionStreamMax > 0 && transaction->size >= oracleAnalyzer->transactionStreamMax &&
+                        transaction->begin && !transaction->system && transaction->firstScn > oracleAnalyzer->firstScn)
+                    transaction->stream(lwnTimestamp);
             }
             break;
 
@@ -1013,7 +1025,7 @@ namespace OpenLogReplicator {
                 auto transactionIter = oracleAnalyzer->xidTransactionMap.find(xidMap);
                 if (transactionIter != oracleAnalyzer->xidTransactionMap.end()) {
                     transaction = transactionIter->second;
-                    transaction->rollbackLastOp(redoLogRecord1->scn);
+                    transaction->rollbackLastOp(redoLogRecord1, lwnTimestamp);
                 } else {
                     auto iter = oracleAnalyzer->brokenXidMapList.find(xidMap);
                     if (iter == oracleAnalyzer->brokenXidMapList.end()) {
@@ -1185,7 +1197,7 @@ namespace OpenLogReplicator {
                                     RUNTIME_FAIL("all " << std::dec << MAX_LWN_CHUNKS << " LWN buffers allocated");
                                 }
 
-                                lwnChunks[lwnAllocated++] = oracleAnalyzer->getMemoryChunk("LWN transaction chunk", false);
+                                lwnChunks[lwnAllocated++] = oracleAnalyzer->getMemoryChunk(MEMORY_MODULE_LWN, false);
                                 if (lwnAllocated > lwnAllocatedMax)
                                     lwnAllocatedMax = lwnAllocated;
                                 length = (uint64_t*) (lwnChunks[lwnAllocated - 1]);
@@ -1280,6 +1292,7 @@ namespace OpenLogReplicator {
                     TRACE(TRACE2_LWN, "LWN: scn: " << std::dec << lwnScnMax);
                     lwnNumCnt = 0;
                     freeLwn();
+                    oracleAnalyzer->reportMemoryUsage(false);
                     lwnConfirmedBlock = currentBlock;
                 } else
                 if (lwnNumCnt > lwnNumMax) {
@@ -1319,6 +1332,10 @@ namespace OpenLogReplicator {
                 stopMain();
                 oracleAnalyzer->shutdown = true;
             } else if (!oracleAnalyzer->shutdown) {
+                //no more redo data to process, don't hold back the open batch
+                if (tmpBufferStart == reader->bufferEnd)
+                    oracleAnalyzer->outputBuffer->outputBufferFlush();
+
                 std::unique_lock<std::mutex> lck(oracleAnalyzer->mtx);
                 if (reader->bufferStart < tmpBufferStart)
                     reader->bufferStart = tmpBufferStart;
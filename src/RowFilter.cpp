@@ -0,0 +1,538 @@
+/* Row filter evaluated on raw column values
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <string.h>
+
+#include "ConfigurationException.h"
+#include "OracleColumn.h"
+#include "OracleObject.h"
+#include "RowFilter.h"
+
+namespace OpenLogReplicator {
+    RowFilter::RowFilter(OracleObject* object, const std::string& condition) :
+        object(object),
+        condition(condition),
+        tokenPos(0),
+        depth(0),
+        maxDepth(0) {
+
+        columns.assign((object->columns.size() + 63) >> 6, 0);
+        tokenize();
+        if (tokens.size() == 0) {
+            CONFIG_FAIL("table " << object->owner << "." << object->name << ": empty condition");
+        }
+
+        parseOr();
+        if (tokenPos < tokens.size()) {
+            CONFIG_FAIL("table " << object->owner << "." << object->name << ": unexpected \"" << tokens[tokenPos].text << "\" in condition: " <<
+                    condition);
+        }
+        if (maxDepth > ROW_FILTER_MAX_DEPTH) {
+            CONFIG_FAIL("table " << object->owner << "." << object->name << ": condition too complex: " << condition);
+        }
+
+        TRACE(TRACE2_SCHEMA_LIST, "SCHEMA LIST: condition for " << object->owner << "." << object->name << " compiled to " << std::dec <<
+                code.size() << " instructions");
+    }
+
+    RowFilter::~RowFilter() {
+        tokens.clear();
+        code.clear();
+        literals.clear();
+        columns.clear();
+    }
+
+    void RowFilter::tokenize(void) {
+        uint64_t pos = 0;
+        uint64_t length = condition.length();
+
+        while (pos < length) {
+            char c = condition[pos];
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+                ++pos;
+                continue;
+            }
+
+            RowFilterToken token;
+            if (c == '\'' || c == '"') {
+                token.type = (c == '\'') ? ROW_FILTER_TOKEN_STRING : ROW_FILTER_TOKEN_QUOTED_NAME;
+                ++pos;
+                while (true) {
+                    if (pos >= length) {
+                        CONFIG_FAIL("table " << object->owner << "." << object->name << ": unterminated quote in condition: " << condition);
+                    }
+                    if (condition[pos] == c) {
+                        //doubled quote stands for the quote character
+                        if (pos + 1 < length && condition[pos + 1] == c) {
+                            token.text.push_back(c);
+                            pos += 2;
+                            continue;
+                        }
+                        ++pos;
+                        break;
+                    }
+                    token.text.push_back(condition[pos++]);
+                }
+
+            } else if ((c >= '0' && c <= '9') || (c == '.' && pos + 1 < length && condition[pos + 1] >= '0' && condition[pos + 1] <= '9')) {
+                token.type = ROW_FILTER_TOKEN_NUMBER;
+                while (pos < length && ((condition[pos] >= '0' && condition[pos] <= '9') || condition[pos] == '.'))
+                    token.text.push_back(condition[pos++]);
+
+            } else if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_') {
+                token.type = ROW_FILTER_TOKEN_NAME;
+                while (pos < length) {
+                    c = condition[pos];
+                    if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$' || c == '#')
+                        token.text.push_back(c);
+                    else if (c >= 'a' && c <= 'z')
+                        token.text.push_back(c - 'a' + 'A');
+                    else
+                        break;
+                    ++pos;
+                }
+
+            } else {
+                token.type = ROW_FILTER_TOKEN_SYMBOL;
+                if (pos + 1 < length && ((c == '<' && (condition[pos + 1] == '=' || condition[pos + 1] == '>')) ||
+                        ((c == '>' || c == '!') && condition[pos + 1] == '='))) {
+                    token.text = condition.substr(pos, 2);
+                    pos += 2;
+                } else if (strchr("=<>(),-+", c) != nullptr) {
+                    token.text.push_back(c);
+                    ++pos;
+                } else {
+                    CONFIG_FAIL("table " << object->owner << "." << object->name << ": invalid character '" << c << "' in condition: " << condition);
+                }
+            }
+
+            tokens.push_back(token);
+        }
+    }
+
+    bool RowFilter::isKeyword(const char* keyword) const {
+        return tokenPos < tokens.size() && tokens[tokenPos].type == ROW_FILTER_TOKEN_NAME && tokens[tokenPos].text.compare(keyword) == 0;
+    }
+
+    bool RowFilter::isSymbol(const char* symbol) const {
+        return tokenPos < tokens.size() && tokens[tokenPos].type == ROW_FILTER_TOKEN_SYMBOL && tokens[tokenPos].text.compare(symbol) == 0;
+    }
+
+    void RowFilter::expect(const char* symbol) {
+        if (!isSymbol(symbol)) {
+            CONFIG_FAIL("table " << object->owner << "." << object->name << ": expected \"" << symbol << "\" in condition: " << condition);
+        }
+        ++tokenPos;
+    }
+
+    void RowFilter::parseOr(void) {
+        parseAnd();
+        while (isKeyword("OR")) {
+            ++tokenPos;
+            parseAnd();
+            emit(ROW_FILTER_OP_OR, 0, 0, 0, 0);
+        }
+    }
+
+    void RowFilter::parseAnd(void) {
+        parseNot();
+        while (isKeyword("AND")) {
+            ++tokenPos;
+            parseNot();
+            emit(ROW_FILTER_OP_AND, 0, 0, 0, 0);
+        }
+    }
+
+    void RowFilter::parseNot(void) {
+        if (isKeyword("NOT")) {
+            ++tokenPos;
+            parseNot();
+            emit(ROW_FILTER_OP_NOT, 0, 0, 0, 0);
+        } else if (isSymbol("(")) {
+            ++tokenPos;
+            parseOr();
+            expect(")");
+        } else
+            parsePredicate();
+    }
+
+    void RowFilter::parsePredicate(void) {
+        typeCOL column = parseColumn();
+
+        if (isKeyword("IS")) {
+            ++tokenPos;
+            uint8_t cmp = ROW_FILTER_CMP_EQ;
+            if (isKeyword("NOT")) {
+                ++tokenPos;
+                cmp = ROW_FILTER_CMP_NE;
+            }
+            if (!isKeyword("NULL")) {
+                CONFIG_FAIL("table " << object->owner << "." << object->name << ": expected NULL in condition: " << condition);
+            }
+            ++tokenPos;
+            emit(ROW_FILTER_OP_NULL, cmp, column, 0, 0);
+            return;
+        }
+
+        uint8_t cmp = ROW_FILTER_CMP_EQ;
+        if (isKeyword("NOT")) {
+            ++tokenPos;
+            cmp = ROW_FILTER_CMP_NE;
+            if (!isKeyword("IN")) {
+                CONFIG_FAIL("table " << object->owner << "." << object->name << ": expected IN in condition: " << condition);
+            }
+        }
+
+        if (isKeyword("IN")) {
+            ++tokenPos;
+            expect("(");
+            uint32_t first = parseLiteral(column);
+            uint32_t count = 1;
+            while (isSymbol(",")) {
+                ++tokenPos;
+                parseLiteral(column);
+                ++count;
+            }
+            expect(")");
+            emit(ROW_FILTER_OP_IN, cmp, column, first, count);
+            return;
+        }
+
+        if (isSymbol("="))
+            cmp = ROW_FILTER_CMP_EQ;
+        else if (isSymbol("!=") || isSymbol("<>"))
+            cmp = ROW_FILTER_CMP_NE;
+        else if (isSymbol("<"))
+            cmp = ROW_FILTER_CMP_LT;
+        else if (isSymbol("<="))
+            cmp = ROW_FILTER_CMP_LE;
+        else if (isSymbol(">"))
+            cmp = ROW_FILTER_CMP_GT;
+        else if (isSymbol(">="))
+            cmp = ROW_FILTER_CMP_GE;
+        else {
+            CONFIG_FAIL("table " << object->owner << "." << object->name << ": expected comparison in condition: " << condition);
+        }
+        ++tokenPos;
+
+        emit(ROW_FILTER_OP_CMP, cmp, column, parseLiteral(column), 1);
+    }
+
+    typeCOL RowFilter::parseColumn(void) {
+        if (tokenPos >= tokens.size() || (tokens[tokenPos].type != ROW_FILTER_TOKEN_NAME && tokens[tokenPos].type != ROW_FILTER_TOKEN_QUOTED_NAME)) {
+            CONFIG_FAIL("table " << object->owner << "." << object->name << ": expected column name in condition: " << condition);
+        }
+
+        const std::string& name = tokens[tokenPos].text;
+        for (typeCOL i = 0; i < object->columns.size(); ++i) {
+            if (object->columns[i] != nullptr && object->columns[i]->name.compare(name) == 0) {
+                ++tokenPos;
+                columns[i >> 6] |= ((uint64_t)1) << (i & 0x3F);
+                return i;
+            }
+        }
+
+        CONFIG_FAIL("table " << object->owner << "." << object->name << ": unknown column " << name << " in condition: " << condition);
+    }
+
+    uint32_t RowFilter::parseLiteral(typeCOL column) {
+        OracleColumn* oracleColumn = object->columns[column];
+        std::string literal;
+
+        if (oracleColumn->storedAsLob) {
+            CONFIG_FAIL("table " << object->owner << "." << object->name << ": column " << oracleColumn->name << " stored as LOB can't be used in condition");
+        }
+
+        switch (oracleColumn->typeNo) {
+        case 2: //number/float
+        {
+            std::string text;
+            if (isSymbol("-") || isSymbol("+"))
+                text = tokens[tokenPos++].text;
+            if (tokenPos >= tokens.size() || tokens[tokenPos].type != ROW_FILTER_TOKEN_NUMBER) {
+                CONFIG_FAIL("table " << object->owner << "." << object->name << ": expected number for column " << oracleColumn->name <<
+                        " in condition: " << condition);
+            }
+            text.append(tokens[tokenPos++].text);
+            encodeNumber(text, literal);
+            break;
+        }
+
+        case 1: //varchar2/nvarchar2
+        case 96: //char/nchar
+        {
+            if (tokenPos >= tokens.size() || tokens[tokenPos].type != ROW_FILTER_TOKEN_STRING) {
+                CONFIG_FAIL("table " << object->owner << "." << object->name << ": expected string for column " << oracleColumn->name <<
+                        " in condition: " << condition);
+            }
+            const std::string& text = tokens[tokenPos++].text;
+            uint64_t length = text.length();
+            if (oracleColumn->typeNo == 96)
+                while (length > 0 && text[length - 1] == ' ')
+                    --length;
+
+            for (uint64_t i = 0; i < length; ++i) {
+                uint8_t c = text[i];
+                if (c >= 0x80 && (oracleColumn->charsetId == 2000 || (oracleColumn->charsetId != 871 && oracleColumn->charsetId != 873))) {
+                    CONFIG_FAIL("table " << object->owner << "." << object->name << ": only ASCII strings can be compared with column " <<
+                            oracleColumn->name << " in condition: " << condition);
+                }
+                if (oracleColumn->charsetId == 2000)
+                    literal.push_back(0);
+                literal.push_back(c);
+            }
+            break;
+        }
+
+        case 12: //date
+        case 180: //timestamp
+            if (isKeyword("DATE") || isKeyword("TIMESTAMP"))
+                ++tokenPos;
+            if (tokenPos >= tokens.size() || tokens[tokenPos].type != ROW_FILTER_TOKEN_STRING) {
+                CONFIG_FAIL("table " << object->owner << "." << object->name << ": expected date for column " << oracleColumn->name <<
+                        " in condition: " << condition);
+            }
+            encodeDate(tokens[tokenPos++].text, literal);
+            break;
+
+        default:
+            CONFIG_FAIL("table " << object->owner << "." << object->name << ": type of column " << oracleColumn->name <<
+                    " can't be used in condition");
+        }
+
+        literals.push_back(literal);
+        return literals.size() - 1;
+    }
+
+    void RowFilter::emit(uint8_t op, uint8_t cmp, typeCOL column, uint32_t literal, uint32_t count) {
+        RowFilterInstr instr;
+        instr.op = op;
+        instr.cmp = cmp;
+        instr.trim = ROW_FILTER_TRIM_NONE;
+        instr.column = column;
+        instr.literal = literal;
+        instr.count = count;
+
+        if (op == ROW_FILTER_OP_CMP || op == ROW_FILTER_OP_IN || op == ROW_FILTER_OP_NULL) {
+            instr.trim = trimMode(column);
+            ++depth;
+        } else if (op == ROW_FILTER_OP_AND || op == ROW_FILTER_OP_OR)
+            --depth;
+
+        if (depth > maxDepth)
+            maxDepth = depth;
+        code.push_back(instr);
+    }
+
+    uint8_t RowFilter::trimMode(typeCOL column) const {
+        if (object->columns[column]->typeNo != 96)
+            return ROW_FILTER_TRIM_NONE;
+        if (object->columns[column]->charsetId == 2000)
+            return ROW_FILTER_TRIM_UTF16;
+        return ROW_FILTER_TRIM_BYTE;
+    }
+
+    //Oracle NUMBER: exponent byte and base 100 digits, byte-comparable
+    void RowFilter::encodeNumber(const std::string& text, std::string& out) {
+        bool negative = false;
+        uint64_t pos = 0;
+        if (text[0] == '-' || text[0] == '+') {
+            negative = (text[0] == '-');
+            ++pos;
+        }
+
+        std::string intDigits;
+        std::string fracDigits;
+        bool dot = false;
+        for (; pos < text.length(); ++pos) {
+            if (text[pos] == '.') {
+                if (dot) {
+                    CONFIG_FAIL("table " << object->owner << "." << object->name << ": invalid number " << text << " in condition: " << condition);
+                }
+                dot = true;
+            } else if (dot)
+                fracDigits.push_back(text[pos]);
+            else
+                intDigits.push_back(text[pos]);
+        }
+
+        intDigits.erase(0, intDigits.find_first_not_of('0') == std::string::npos ? intDigits.length() : intDigits.find_first_not_of('0'));
+        while (fracDigits.length() > 0 && fracDigits[fracDigits.length() - 1] == '0')
+            fracDigits.pop_back();
+
+        if (intDigits.length() == 0 && fracDigits.length() == 0) {
+            out.push_back((char)0x80);
+            return;
+        }
+
+        if ((intDigits.length() & 1) != 0)
+            intDigits.insert(0, "0");
+        if ((fracDigits.length() & 1) != 0)
+            fracDigits.push_back('0');
+
+        std::vector<uint8_t> digits;
+        for (uint64_t i = 0; i < intDigits.length(); i += 2)
+            digits.push_back((intDigits[i] - '0') * 10 + (intDigits[i + 1] - '0'));
+        for (uint64_t i = 0; i < fracDigits.length(); i += 2)
+            digits.push_back((fracDigits[i] - '0') * 10 + (fracDigits[i + 1] - '0'));
+
+        int64_t exponent = (int64_t)(intDigits.length() / 2) - 1;
+        uint64_t first = 0;
+        while (digits[first] == 0) {
+            ++first;
+            --exponent;
+        }
+        uint64_t last = digits.size();
+        while (digits[last - 1] == 0)
+            --last;
+
+        //exponent -65 would give byte 0x80, the encoding of zero
+        if (last - first > 20 || exponent > 62 || exponent < -64) {
+            CONFIG_FAIL("table " << object->owner << "." << object->name << ": number " << text << " out of range in condition: " << condition);
+        }
+
+        if (negative) {
+            out.push_back((char)(0x3E - exponent));
+            for (uint64_t i = first; i < last; ++i)
+                out.push_back((char)(101 - digits[i]));
+            if (last - first < 20)
+                out.push_back((char)102);
+        } else {
+            out.push_back((char)(0xC1 + exponent));
+            for (uint64_t i = first; i < last; ++i)
+                out.push_back((char)(digits[i] + 1));
+        }
+    }
+
+    //Oracle DATE: century, year, month, day, hour, minute, second, byte-comparable for AD dates
+    void RowFilter::encodeDate(const std::string& text, std::string& out) {
+        int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+        int fields = sscanf(text.c_str(), "%d-%d-%d %d:%d:%d", &year, &month, &day, &hour, &minute, &second);
+
+        if ((fields != 3 && fields != 6) || year < 1 || year > 9999 || month < 1 || month > 12 || day < 1 || day > 31 ||
+                hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 59) {
+            CONFIG_FAIL("table " << object->owner << "." << object->name << ": invalid date '" << text <<
+                    "', expected YYYY-MM-DD or YYYY-MM-DD HH24:MI:SS in condition: " << condition);
+        }
+
+        out.push_back((char)(year / 100 + 100));
+        out.push_back((char)(year % 100 + 100));
+        out.push_back((char)month);
+        out.push_back((char)day);
+        out.push_back((char)(hour + 1));
+        out.push_back((char)(minute + 1));
+        out.push_back((char)(second + 1));
+    }
+
+    int64_t RowFilter::compare(const uint8_t* data, uint64_t length, const std::string& literal, uint8_t trim) {
+        if (trim == ROW_FILTER_TRIM_BYTE) {
+            while (length > 0 && data[length - 1] == ' ')
+                --length;
+        } else if (trim == ROW_FILTER_TRIM_UTF16) {
+            while (length >= 2 && data[length - 2] == 0 && data[length - 1] == ' ')
+                length -= 2;
+        }
+
+        uint64_t common = (length < literal.length()) ? length : literal.length();
+        int ret = memcmp(data, literal.c_str(), common);
+        if (ret != 0)
+            return ret;
+        return (int64_t)length - (int64_t)literal.length();
+    }
+
+    //false when the row is rejected, rows with columns absent from the redo of an update always pass
+    bool RowFilter::evaluate(uint8_t* values[][4], uint64_t lengths[][4], uint64_t type) const {
+        uint8_t stack[ROW_FILTER_MAX_DEPTH];
+        uint64_t top = 0;
+
+        for (const RowFilterInstr& instr : code) {
+            switch (instr.op) {
+            case ROW_FILTER_OP_AND:
+                --top;
+                if (stack[top - 1] == ROW_FILTER_FALSE || stack[top] == ROW_FILTER_FALSE)
+                    stack[top - 1] = ROW_FILTER_FALSE;
+                else if (stack[top - 1] == ROW_FILTER_UNKNOWN || stack[top] == ROW_FILTER_UNKNOWN)
+                    stack[top - 1] = ROW_FILTER_UNKNOWN;
+                continue;
+
+            case ROW_FILTER_OP_OR:
+                --top;
+                if (stack[top - 1] == ROW_FILTER_TRUE || stack[top] == ROW_FILTER_TRUE)
+                    stack[top - 1] = ROW_FILTER_TRUE;
+                else if (stack[top - 1] == ROW_FILTER_UNKNOWN || stack[top] == ROW_FILTER_UNKNOWN)
+                    stack[top - 1] = ROW_FILTER_UNKNOWN;
+                continue;
+
+            case ROW_FILTER_OP_NOT:
+                if (stack[top - 1] != ROW_FILTER_UNKNOWN)
+                    stack[top - 1] ^= 1;
+                continue;
+            }
+
+            const uint8_t* data;
+            uint64_t length;
+            if (type == TRANSACTION_DELETE) {
+                data = values[instr.column][VALUE_BEFORE];
+                length = lengths[instr.column][VALUE_BEFORE];
+            } else {
+                data = values[instr.column][VALUE_AFTER];
+                length = lengths[instr.column][VALUE_AFTER];
+                if (data == nullptr && type == TRANSACTION_UPDATE) {
+                    data = values[instr.column][VALUE_BEFORE];
+                    length = lengths[instr.column][VALUE_BEFORE];
+                    if (data == nullptr)
+                        return true;
+                }
+            }
+            bool isNull = (data == nullptr || length == 0);
+
+            uint8_t result;
+            if (instr.op == ROW_FILTER_OP_NULL) {
+                result = (isNull == (instr.cmp == ROW_FILTER_CMP_EQ)) ? ROW_FILTER_TRUE : ROW_FILTER_FALSE;
+            } else if (isNull) {
+                result = ROW_FILTER_UNKNOWN;
+            } else if (instr.op == ROW_FILTER_OP_IN) {
+                result = ROW_FILTER_FALSE;
+                for (uint32_t i = 0; i < instr.count; ++i) {
+                    if (compare(data, length, literals[instr.literal + i], instr.trim) == 0) {
+                        result = ROW_FILTER_TRUE;
+                        break;
+                    }
+                }
+                if (instr.cmp == ROW_FILTER_CMP_NE)
+                    result ^= 1;
+            } else {
+                int64_t ret = compare(data, length, literals[instr.literal], instr.trim);
+                bool match;
+                switch (instr.cmp) {
+                case ROW_FILTER_CMP_EQ: match = (ret == 0); break;
+                case ROW_FILTER_CMP_NE: match = (ret != 0); break;
+                case ROW_FILTER_CMP_LT: match = (ret < 0); break;
+                case ROW_FILTER_CMP_LE: match = (ret <= 0); break;
+                case ROW_FILTER_CMP_GT: match = (ret > 0); break;
+                default: match = (ret >= 0);
+                }
+                result = match ? ROW_FILTER_TRUE : ROW_FILTER_FALSE;
+            }
+            stack[top++] = result;
+        }
+
+        return stack[0] == ROW_FILTER_TRUE;
+    }
+}
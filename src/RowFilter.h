@@ -0,0 +1,118 @@
+/* Header for RowFilter class
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <vector>
+
+#include "types.h"
+
+#ifndef ROWFILTER_H_
+#define ROWFILTER_H_
+
+#define ROW_FILTER_OP_CMP                   0
+#define ROW_FILTER_OP_IN                    1
+#define ROW_FILTER_OP_NULL                  2
+#define ROW_FILTER_OP_AND                   3
+#define ROW_FILTER_OP_OR                    4
+#define ROW_FILTER_OP_NOT                   5
+
+#define ROW_FILTER_CMP_EQ                   0
+#define ROW_FILTER_CMP_NE                   1
+#define ROW_FILTER_CMP_LT                   2
+#define ROW_FILTER_CMP_LE                   3
+#define ROW_FILTER_CMP_GT                   4
+#define ROW_FILTER_CMP_GE                   5
+
+#define ROW_FILTER_FALSE                    0
+#define ROW_FILTER_TRUE                     1
+#define ROW_FILTER_UNKNOWN                  2
+
+#define ROW_FILTER_TRIM_NONE                0
+#define ROW_FILTER_TRIM_BYTE                1
+#define ROW_FILTER_TRIM_UTF16               2
+
+#define ROW_FILTER_TOKEN_NAME               0
+#define ROW_FILTER_TOKEN_QUOTED_NAME        1
+#define ROW_FILTER_TOKEN_NUMBER             2
+#define ROW_FILTER_TOKEN_STRING             3
+#define ROW_FILTER_TOKEN_SYMBOL             4
+
+#define ROW_FILTER_MAX_DEPTH                64
+
+namespace OpenLogReplicator {
+    class OracleObject;
+
+    struct RowFilterInstr {
+        uint8_t op;
+        uint8_t cmp;
+        //char column: trailing blanks are not compared
+        uint8_t trim;
+        typeCOL column;
+        uint32_t literal;
+        uint32_t count;
+    };
+
+    struct RowFilterToken {
+        uint64_t type;
+        std::string text;
+    };
+
+    class RowFilter {
+    protected:
+        OracleObject* object;
+        std::string condition;
+        std::vector<RowFilterToken> tokens;
+        uint64_t tokenPos;
+        uint64_t depth;
+        uint64_t maxDepth;
+        std::vector<RowFilterInstr> code;
+        std::vector<std::string> literals;
+
+        void tokenize(void);
+        bool isKeyword(const char* keyword) const;
+        bool isSymbol(const char* symbol) const;
+        void expect(const char* symbol);
+        void parseOr(void);
+        void parseAnd(void);
+        void parseNot(void);
+        void parsePredicate(void);
+        typeCOL parseColumn(void);
+        uint32_t parseLiteral(typeCOL column);
+        void emit(uint8_t op, uint8_t cmp, typeCOL column, uint32_t literal, uint32_t count);
+        uint8_t trimMode(typeCOL column) const;
+        void encodeNumber(const std::string& text, std::string& out);
+        void encodeDate(const std::string& text, std::string& out);
+
+        static int64_t compare(const uint8_t* data, uint64_t length, const std::string& literal, uint8_t trim);
+
+    public:
+        //columns used by the condition, 64 columns per entry
+        std::vector<uint64_t> columns;
+
+        RowFilter(OracleObject* object, const std::string& condition);
+        virtual ~RowFilter();
+
+        bool hasColumn(typeCOL col) const {
+            return (col >> 6) < columns.size() && (columns[col >> 6] & (((uint64_t)1) << (col & 0x3F))) != 0;
+        }
+
+        bool evaluate(uint8_t* values[][4], uint64_t lengths[][4], uint64_t type) const;
+    };
+}
+
+#endif
@@ -29,6 +29,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "OracleObject.h"
 #include "OutputBuffer.h"
 #include "Reader.h"
+#include "RowFilter.h"
 #include "RowId.h"
 #include "RuntimeException.h"
 #include "Schema.h"
@@ -569,7 +570,8 @@ namespace OpenLogReplicator {
                 RUNTIME_FAIL("owner \"" << element->owner << "\" is missing in schema file: " <<
                         jsonName << " - recreate schema file (delete old file and force creation of new)");
             }
-            buildMaps(element->owner, element->table, element->keys, element->keysStr, element->options, true);
+            buildMaps(element->owner, element->table, element->keys, element->keysStr, element->columns, element->columnsExclude, element->condition,
+                    element->options, true);
         }
         oracleAnalyzer->schemaScn = fileScn;
 
@@ -1339,6 +1341,7 @@ namespace OpenLogReplicator {
                     INFO("dropped schema: " << object->owner << "." << object->name << " (dataobj: " << std::dec << object->dataObj
                             << ", obj: " << object->obj << ")");
                     objectMap.erase(it++);
+                    oracleAnalyzer->outputBuffer->releaseObject(object);
                     delete object;
                 } else {
                     ++it;
@@ -1363,16 +1366,19 @@ namespace OpenLogReplicator {
                 removeFromDict(object);
                 INFO("dropped schema: " << object->owner << "." << object->name << " (dataobj: " << std::dec << object->dataObj
                         << ", obj: " << object->obj << ")");
+                oracleAnalyzer->outputBuffer->releaseObject(object);
                 delete object;
             }
         }
         objectsTouched.clear();
 
         for (SchemaElement* element : elements)
-            buildMaps(element->owner, element->table, element->keys, element->keysStr, element->options, false);
+            buildMaps(element->owner, element->table, element->keys, element->keysStr, element->columns, element->columnsExclude, element->condition,
+                    element->options, false);
     }
 
-    void Schema::buildMaps(std::string& owner, std::string& table, std::vector<std::string>& keys, std::string& keysStr, typeOPTIONS options, bool output) {
+    void Schema::buildMaps(std::string& owner, std::string& table, std::vector<std::string>& keys, std::string& keysStr, std::vector<std::string>& columns,
+            bool columnsExclude, std::string& condition, typeOPTIONS options, bool output) {
         uint64_t tabCnt = 0;
         std::regex regexOwner(owner);
         std::regex regexTable(table);
@@ -1633,6 +1639,26 @@ namespace OpenLogReplicator {
             schemaObject->maxSegCol = maxSegCol;
             schemaObject->totalPk = totalPk;
             schemaObject->updatePK();
+            if (columns.size() > 0)
+                schemaObject->setColumnsSkip(columns, columnsExclude);
+            if (condition.length() > 0) {
+                RowFilter* filter = nullptr;
+                try {
+                    filter = new RowFilter(schemaObject, condition);
+                    if (filter == nullptr) {
+                        RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(RowFilter) << " bytes memory (for: row filter)");
+                    }
+                } catch (ConfigurationException& ex) {
+                    if (output) {
+                        delete schemaObject;
+                        schemaObject = nullptr;
+                        throw;
+                    }
+                    //after DDL the condition may no longer match the table, replication goes on without the filter
+                    WARNING("table " << sysUser->name << "." << sysObj->name << ": condition disabled after schema change: " << condition);
+                }
+                schemaObject->filter = filter;
+            }
             addToDict(schemaObject);
             schemaObject = nullptr;
         }
@@ -136,7 +136,8 @@ namespace OpenLogReplicator {
         void removeFromDict(OracleObject* object);
         bool refreshIndexes(void);
         void rebuildMaps(void);
-        void buildMaps(std::string& owner, std::string& table, std::vector<std::string>& keys, std::string& keysStr, typeOPTIONS options, bool output);
+        void buildMaps(std::string& owner, std::string& table, std::vector<std::string>& keys, std::string& keysStr, std::vector<std::string>& columns,
+                bool columnsExclude, std::string& condition, typeOPTIONS options, bool output);
         SchemaElement* addElement(const char* owner, const char* table, typeOPTIONS options);
         bool dictSysCColAdd(const char* rowIdStr, typeCON con, typeCOL intCol, typeOBJ obj, uint64_t spare11, uint64_t spare12);
         bool dictSysCDefAdd(const char* rowIdStr, typeCON con, typeOBJ obj, typeTYPE type);
@@ -24,10 +24,12 @@ namespace OpenLogReplicator {
     SchemaElement::SchemaElement(const char* owner, const char* table, typeOPTIONS options) :
         owner(owner),
         table(table),
+        columnsExclude(false),
         options(options) {
     }
 
     SchemaElement::SchemaElement() :
+        columnsExclude(false),
         options(0) {
     }
 
@@ -32,6 +32,11 @@ namespace OpenLogReplicator {
         std::string table;
         std::vector<std::string> keys;
         std::string keysStr;
+        //column projection: listed columns are the only ones sent, or are skipped when columnsExclude is set
+        std::vector<std::string> columns;
+        bool columnsExclude;
+        //row filter evaluated on raw column values
+        std::string condition;
         typeOPTIONS options;
 
         SchemaElement(const char* owner, const char* table, typeOPTIONS options);
@@ -17,6 +17,8 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <new>
+
 #include "OpCode0501.h"
 #include "OracleAnalyzer.h"
 #include "OutputBuffer.h"
@@ -30,9 +32,12 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     Transaction::Transaction(OracleAnalyzer* oracleAnalyzer, typeXID xid) :
         oracleAnalyzer(oracleAnalyzer),
+        arenaChunk(0),
+        arenaPos(0),
         deallocTc(nullptr),
         opCode0501(nullptr),
         xid(xid),
+        firstScn(ZERO_SCN),
         firstSequence(0),
         firstOffset(0),
         commitSequence(0),
@@ -45,6 +50,7 @@ namespace OpenLogReplicator {
         rollback(false),
         system(false),
         shutdown(false),
+        streamed(false),
         size(0) {
 
         std::stringstream ss;
@@ -54,7 +60,7 @@ namespace OpenLogReplicator {
 
     Transaction::~Transaction() {
         if (opCode0501 != nullptr) {
-            delete opCode0501;
+            opCode0501->~OpCode0501();
             opCode0501 = nullptr;
         }
 
@@ -101,6 +107,40 @@ namespace OpenLogReplicator {
         uint16_t myFieldLength = oracleAnalyzer->read16(redoLogRecord1->data + redoLogRecord1->fieldLengthsDelta + 1 * 2);
     }
 
+    uint8_t* Transaction::arenaAllocate(uint64_t size) {
+        size = (size + 7) & 0xFFFFFFFFFFFFFFF8;
+
+        //blocks bigger than a chunk are allocated separately and freed with the arena
+        if (size > MEMORY_CHUNK_SIZE) {
+            uint8_t* data = new uint8_t[size];
+            if (data == nullptr) {
+                RUNTIME_FAIL("couldn't allocate " << std::dec << size << " bytes memory (for: transaction arena)");
+            }
+            arenaOversize.push_back(data);
+            return data;
+        }
+
+        //chunks are kept until the transaction is purged and reused for next rows
+        if (arenaChunk == 0 || arenaPos + size > MEMORY_CHUNK_SIZE) {
+            if (arenaChunk == arenaChunks.size())
+                arenaChunks.push_back(oracleAnalyzer->getMemoryChunk(MEMORY_MODULE_TRANSACTIONS, false));
+            ++arenaChunk;
+            arenaPos = 0;
+        }
+
+        uint8_t* data = arenaChunks[arenaChunk - 1] + arenaPos;
+        arenaPos += size;
+        return data;
+    }
+
+    void Transaction::arenaReset(void) {
+        for (uint8_t* data : arenaOversize)
+            delete[] data;
+        arenaOversize.clear();
+        arenaChunk = 0;
+        arenaPos = 0;
+    }
+
     void Transaction::add(RedoLogRecord* redoLogRecord) {
         oracleAnalyzer->transactionBuffer->addTransactionChunk(this, redoLogRecord);
         ++opCodes;
@@ -111,33 +151,54 @@ namespace OpenLogReplicator {
         ++opCodes;
     }
 
-    void Transaction::rollbackLastOp(typeSCN scn) {
+    void Transaction::rollbackLastOp(RedoLogRecord* redoLogRecord, typeTIME time_) {
+        //operation was already sent, rows are reverted by undo messages of a provisional batch
+        if (lastTc == nullptr && streamed) {
+            TRACE(TRACE2_TRANSACTION, "TRANSACTION: undo of streamed operation at scn " << std::dec << redoLogRecord->scn << " " << *this);
+            oracleAnalyzer->outputBuffer->processBegin(0, time_, 0, xid, true, true);
+            oracleAnalyzer->outputBuffer->processUndo(redoLogRecord);
+            oracleAnalyzer->outputBuffer->processCommit();
+        }
         oracleAnalyzer->transactionBuffer->rollbackTransactionChunk(this);
         if (opCodes > 0)
             --opCodes;
     }
 
-    void Transaction::flush(void) {
-        bool opFlush = false;
-        deallocTc = nullptr;
-
-        if (opCodes > 0 && !rollback) {
-            TRACE(TRACE2_TRANSACTION, "TRANSACTION: " << *this);
+    bool Transaction::chunkComplete(TransactionChunk* tc) {
+        if (tc->elements == 0)
+            return false;
+
+        //last element of the chunk must close the row
+        uint64_t length = *((uint64_t*) (tc->buffer + tc->size - ROW_HEADER_TOTAL + ROW_HEADER_SIZE));
+        uint64_t pos = tc->size - length;
+        typeOP2 op = *((typeOP2*) (tc->buffer + pos + ROW_HEADER_OP));
+        RedoLogRecord* redoLogRecord1 = ((RedoLogRecord*) (tc->buffer + pos + ROW_HEADER_REDO1));
+
+        if ((redoLogRecord1->flg & (FLG_MULTIBLOCKUNDOHEAD | FLG_MULTIBLOCKUNDOMID | FLG_MULTIBLOCKUNDOTAIL)) != 0)
+            return false;
+
+        switch (op) {
+        case 0x05010B02:
+        case 0x05010B03:
+        case 0x05010B05:
+        case 0x05010B06:
+        case 0x05010B08:
+        case 0x05010B10:
+        case 0x05010B16:
+            return (redoLogRecord1->suppLogFb & FB_L) != 0;
+
+        case 0x05010B0B:
+        case 0x05010B0C:
+        case 0x18010000:
+            return true;
+        }
+        return false;
+    }
 
-            if (system) {
-                if (oracleAnalyzer->systemTransaction != nullptr) {
-                    RUNTIME_FAIL("system transaction already active:1");
-                }
-                oracleAnalyzer->systemTransaction = new SystemTransaction(oracleAnalyzer, oracleAnalyzer->outputBuffer, oracleAnalyzer->schema);
-                if (oracleAnalyzer->systemTransaction == nullptr) {
-                    RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(SystemTransaction) << " bytes memory (for: system transaction)");
-                }
+    void Transaction::flushChunks(TransactionChunk* stopTc, bool provisional, typeTIME time_) {
+        bool opFlush = false;
 
-                if ((oracleAnalyzer->flags & REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS) != 0)
-                    oracleAnalyzer->outputBuffer->processBegin(commitScn, commitTimestamp, commitSequence, xid);
-            } else {
-                oracleAnalyzer->outputBuffer->processBegin(commitScn, commitTimestamp, commitSequence, xid);
-            }
+        if (firstTc != stopTc) {
             uint64_t pos;
             uint64_t type = 0;
             RedoLogRecord* first1 = nullptr;
@@ -147,7 +208,7 @@ namespace OpenLogReplicator {
             RedoLogRecord* last501 = nullptr;
 
             TransactionChunk* tc = firstTc;
-            while (tc != nullptr) {
+            while (tc != stopTc) {
                 pos = 0;
                 for (uint64_t i = 0; i < tc->elements; ++i) {
                     typeOP2 op = *((typeOP2*) (tc->buffer + pos));
@@ -198,12 +259,7 @@ namespace OpenLogReplicator {
                             RUNTIME_FAIL("split undo MID error");
                         }
 
-                        uint64_t size = last501->length + redoLogRecord1->length;
-                        uint8_t* merge = new uint8_t[size];
-                        if (merge == nullptr) {
-                            RUNTIME_FAIL("couldn't allocate " << std::dec << size << " bytes memory (for: merge split undo #1)");
-                        }
-                        merges.push_back(merge);
+                        uint8_t* merge = arenaAllocate(last501->length + redoLogRecord1->length);
                         mergeBlocks(merge, redoLogRecord1, last501);
                         last501 = redoLogRecord1;
                         continue;
@@ -216,7 +272,7 @@ namespace OpenLogReplicator {
                             //FIXME+
                             WARNING("split undo HEAD error");
                             if (opCode0501 != nullptr) {
-                                delete opCode0501;
+                                opCode0501->~OpCode0501();
                                 opCode0501 = nullptr;
                             }
                             last501 = nullptr;
@@ -224,12 +280,7 @@ namespace OpenLogReplicator {
                             //FIXME-
                         }
 
-                        uint64_t size = last501->length + redoLogRecord1->length;
-                        uint8_t* merge = new uint8_t[size];
-                        if (merge == nullptr) {
-                            RUNTIME_FAIL("couldn't allocate " << std::dec << size << " bytes memory (for: merge split undo #1)");
-                        }
-                        merges.push_back(merge);
+                        uint8_t* merge = arenaAllocate(last501->length + redoLogRecord1->length);
                         mergeBlocks(merge, redoLogRecord1, last501);
 
                         uint16_t fieldPos = redoLogRecord1->fieldPos;
@@ -240,14 +291,11 @@ namespace OpenLogReplicator {
                         flg &= ~(FLG_MULTIBLOCKUNDOHEAD | FLG_MULTIBLOCKUNDOMID | FLG_MULTIBLOCKUNDOTAIL | FLG_LASTBUFFERSPLIT);
                         oracleAnalyzer->write16(redoLogRecord1->data + fieldPos + 20, flg);
 
-                        opCode0501 = new OpCode0501(oracleAnalyzer, redoLogRecord1);
-                        if (opCode0501 == nullptr) {
-                            RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(OpCode0501) << " bytes memory (for: merge split blocks #3)");
-                        }
+                        opCode0501 = new (arenaAllocate(sizeof(OpCode0501))) OpCode0501(oracleAnalyzer, redoLogRecord1);
 
                         opCode0501->process();
                         if (opCode0501 != nullptr) {
-                            delete opCode0501;
+                            opCode0501->~OpCode0501();
                             opCode0501 = nullptr;
                         }
                         last501 = nullptr;
@@ -256,7 +304,7 @@ namespace OpenLogReplicator {
                         //FIXME+
                         WARNING("split undo is broken");
                         if (opCode0501 != nullptr) {
-                            delete opCode0501;
+                            opCode0501->~OpCode0501();
                             opCode0501 = nullptr;
                         }
                         last501 = nullptr;
@@ -398,11 +446,11 @@ namespace OpenLogReplicator {
 
                             if ((oracleAnalyzer->flags & REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS) != 0) {
                                 oracleAnalyzer->outputBuffer->processCommit();
-                                oracleAnalyzer->outputBuffer->processBegin(commitScn, commitTimestamp, commitSequence, xid);
+                                oracleAnalyzer->outputBuffer->processBegin(commitScn, time_, commitSequence, xid, provisional, streamed);
                             }
                         } else {
                             oracleAnalyzer->outputBuffer->processCommit();
-                            oracleAnalyzer->outputBuffer->processBegin(commitScn, commitTimestamp, commitSequence, xid);
+                            oracleAnalyzer->outputBuffer->processBegin(commitScn, time_, commitSequence, xid, provisional, streamed);
                         }
                     }
 
@@ -419,13 +467,13 @@ namespace OpenLogReplicator {
                             deallocTc = nextTc;
                         }
 
-                        for (uint8_t* buf : merges)
-                            delete[] buf;
-                        merges.clear();
+                        arenaReset();
                     }
                 }
 
                 TransactionChunk* nextTc = tc->next;
+                size -= tc->size;
+                opCodes -= tc->elements;
                 tc->next = deallocTc;
                 deallocTc = tc;
                 tc = nextTc;
@@ -437,22 +485,87 @@ namespace OpenLogReplicator {
                 oracleAnalyzer->transactionBuffer->deleteTransactionChunk(deallocTc);
                 deallocTc = nextTc;
             }
+        }
+    }
 
-            firstTc = nullptr;
-            lastTc = nullptr;
-            opCodes = 0;
+    void Transaction::flush(void) {
+        deallocTc = nullptr;
 
-            if (system) {
-                oracleAnalyzer->systemTransaction->commit(commitScn);
-                delete oracleAnalyzer->systemTransaction;
-                oracleAnalyzer->systemTransaction = nullptr;
+        if (rollback) {
+            //rows of streamed transaction were already sent
+            if (streamed)
+                oracleAnalyzer->outputBuffer->processRollback(commitTimestamp, xid);
+            return;
+        }
 
-                if ((oracleAnalyzer->flags & REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS) != 0)
-                    oracleAnalyzer->outputBuffer->processCommit();
-            } else {
-                oracleAnalyzer->outputBuffer->processCommit();
+        if (opCodes == 0 && !streamed)
+            return;
+
+        TRACE(TRACE2_TRANSACTION, "TRANSACTION: " << *this);
+
+        if (system) {
+            if (streamed) {
+                WARNING("streamed " << name << " modifies system tables, dictionary changes of already sent part are not applied");
             }
+
+            if (oracleAnalyzer->systemTransaction != nullptr) {
+                RUNTIME_FAIL("system transaction already active:1");
+            }
+            oracleAnalyzer->systemTransaction = new SystemTransaction(oracleAnalyzer, oracleAnalyzer->outputBuffer, oracleAnalyzer->schema);
+            if (oracleAnalyzer->systemTransaction == nullptr) {
+                RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(SystemTransaction) << " bytes memory (for: system transaction)");
+            }
+
+            if ((oracleAnalyzer->flags & REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS) != 0)
+                oracleAnalyzer->outputBuffer->processBegin(commitScn, commitTimestamp, commitSequence, xid, streamed, streamed);
+        } else {
+            oracleAnalyzer->outputBuffer->processBegin(commitScn, commitTimestamp, commitSequence, xid, streamed, streamed);
+        }
+
+        //remaining rows of streamed transaction are sent as the last provisional batch
+        flushChunks(nullptr, streamed, commitTimestamp);
+
+        firstTc = nullptr;
+        lastTc = nullptr;
+        opCodes = 0;
+
+        if (system) {
+            oracleAnalyzer->systemTransaction->commit(commitScn);
+            delete oracleAnalyzer->systemTransaction;
+            oracleAnalyzer->systemTransaction = nullptr;
+
+            if ((oracleAnalyzer->flags & REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS) != 0)
+                oracleAnalyzer->outputBuffer->processCommit();
+        } else {
+            oracleAnalyzer->outputBuffer->processCommit();
+        }
+
+        if (streamed) {
+            oracleAnalyzer->outputBuffer->processBegin(commitScn, commitTimestamp, commitSequence, xid, false, true);
+            oracleAnalyzer->outputBuffer->processCommit();
+        }
+    }
+
+    void Transaction::stream(typeTIME time_) {
+        //the last chunk is kept, it still can be partially rolled back
+        TransactionChunk* stopTc = nullptr;
+        for (TransactionChunk* tc = firstTc; tc != nullptr && tc != lastTc; tc = tc->next) {
+            if (chunkComplete(tc))
+                stopTc = tc->next;
         }
+        if (stopTc == nullptr)
+            return;
+
+        TRACE(TRACE2_TRANSACTION, "TRANSACTION: stream " << *this);
+
+        deallocTc = nullptr;
+        oracleAnalyzer->outputBuffer->processBegin(0, time_, 0, xid, true, streamed);
+        streamed = true;
+
+        flushChunks(stopTc, true, time_);
+        firstTc->prev = nullptr;
+
+        oracleAnalyzer->outputBuffer->processCommit();
     }
 
     void Transaction::purge(void) {
@@ -469,9 +582,10 @@ namespace OpenLogReplicator {
         }
         deallocTc = nullptr;
 
-        for (uint8_t* buf : merges)
-            delete[] buf;
-        merges.clear();
+        for (uint8_t* chunk : arenaChunks)
+            oracleAnalyzer->freeMemoryChunk(MEMORY_MODULE_TRANSACTIONS, chunk, false);
+        arenaChunks.clear();
+        arenaReset();
 
         size = 0;
         opCodes = 0;
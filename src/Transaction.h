@@ -36,13 +36,21 @@ namespace OpenLogReplicator {
     class Transaction {
     protected:
         OracleAnalyzer* oracleAnalyzer;
-        std::vector<uint8_t*> merges;
+        std::vector<uint8_t*> arenaChunks;
+        std::vector<uint8_t*> arenaOversize;
+        uint64_t arenaChunk;
+        uint64_t arenaPos;
         TransactionChunk* deallocTc;
         OpCode0501* opCode0501;
+        uint8_t* arenaAllocate(uint64_t size);
+        void arenaReset(void);
         void mergeBlocks(uint8_t* buffer, RedoLogRecord* redoLogRecord1, RedoLogRecord* redoLogRecord2);
+        bool chunkComplete(TransactionChunk* tc);
+        void flushChunks(TransactionChunk* stopTc, bool provisional, typeTIME time_);
 
     public:
         typeXID xid;
+        typeSCN firstScn;
         typeSEQ firstSequence;
         uint64_t firstOffset;
         typeSEQ commitSequence;
@@ -55,6 +63,7 @@ namespace OpenLogReplicator {
         bool rollback;
         bool system;
         bool shutdown;
+        bool streamed;
         std::string name;
         uint64_t size;
 
@@ -63,8 +72,9 @@ namespace OpenLogReplicator {
 
         void add(RedoLogRecord* redoLogRecord);
         void add(RedoLogRecord* redoLogRecord1, RedoLogRecord* redoLogRecord2);
-        void rollbackLastOp(typeSCN scn);
+        void rollbackLastOp(RedoLogRecord* redoLogRecord, typeTIME time_);
         void flush(void);
+        void stream(typeTIME time_);
         void purge(void);
         friend std::ostream& operator<<(std::ostream& os, const Transaction& tran);
     };
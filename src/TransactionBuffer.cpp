@@ -29,51 +29,81 @@ namespace OpenLogReplicator {
     }
 
     TransactionBuffer::~TransactionBuffer() {
-        if (partiallyFullChunks.size() > 0) {
-            WARNING("non free blocks in transaction buffer: " << std::dec << partiallyFullChunks.size());
+        for (uint64_t chunkClass = 0; chunkClass < CHUNK_CLASSES; ++chunkClass) {
+            if (partiallyFullChunks[chunkClass].size() > 0) {
+                WARNING("non free blocks in transaction buffer: " << std::dec << partiallyFullChunks[chunkClass].size() <<
+                        " (class: " << CHUNK_CLASS_SIZE(chunkClass) << ")");
+            }
         }
     }
 
-    TransactionChunk* TransactionBuffer::newTransactionChunk(Transaction* transaction) {
+    uint64_t TransactionBuffer::chunkClassFor(uint64_t length, uint64_t minClass) {
+        uint64_t chunkClass = minClass;
+        while (chunkClass < CHUNK_CLASSES - 1 && length > CHUNK_CLASS_DATA(chunkClass))
+            ++chunkClass;
+        return chunkClass;
+    }
+
+    TransactionChunk* TransactionBuffer::newTransactionChunk(Transaction* transaction, uint64_t chunkClass) {
+        std::unordered_map<uint8_t*,TransactionChunkFree>& chunks = partiallyFullChunks[chunkClass];
         uint8_t* chunk;
         TransactionChunk* tc;
-        uint64_t pos;
-        uint64_t freeMap;
-        if (partiallyFullChunks.size() > 0) {
-            chunk = partiallyFullChunks.begin()->first;
-            freeMap = partiallyFullChunks.begin()->second;
-            pos = ffs(freeMap) - 1;
-            freeMap &= ~(1 << pos);
-            if (freeMap == 0)
-                partiallyFullChunks.erase(chunk);
-            else
-                partiallyFullChunks[chunk] = freeMap;
+        uint64_t pos = 0;
+
+        if (chunks.size() > 0) {
+            chunk = chunks.begin()->first;
+            TransactionChunkFree& chunkFree = chunks.begin()->second;
+            uint64_t word = 0;
+            while (chunkFree.freeMap[word] == 0)
+                ++word;
+            pos = word * 64 + ffsll(chunkFree.freeMap[word]) - 1;
+            chunkFree.freeMap[word] &= ~(((uint64_t)1) << (pos & 63));
+            --chunkFree.freeSlots;
+            if (chunkFree.freeSlots == 0)
+                chunks.erase(chunk);
         } else {
-            chunk = oracleAnalyzer->getMemoryChunk(transaction->name.c_str(), false);
-            pos = 0;
-            freeMap = BUFFERS_FREE_MASK & (~1);
-            partiallyFullChunks[chunk] = freeMap;
+            chunk = oracleAnalyzer->getMemoryChunk(MEMORY_MODULE_TRANSACTIONS, false);
+            TransactionChunkFree chunkFree;
+            memset(&chunkFree, 0, sizeof(chunkFree));
+            for (uint64_t slot = 1; slot < CHUNK_CLASS_SLOTS(chunkClass); ++slot)
+                chunkFree.freeMap[slot / 64] |= ((uint64_t)1) << (slot & 63);
+            chunkFree.freeSlots = CHUNK_CLASS_SLOTS(chunkClass) - 1;
+            chunks[chunk] = chunkFree;
         }
 
-        tc = (TransactionChunk*) (chunk + FULL_BUFFER_SIZE * pos);
+        tc = (TransactionChunk*) (chunk + CHUNK_CLASS_SIZE(chunkClass) * pos);
         memset(tc, 0, HEADER_BUFFER_SIZE);
         tc->header = chunk;
         tc->pos = pos;
+        tc->chunkClass = chunkClass;
         return tc;
     }
 
     void TransactionBuffer::deleteTransactionChunk(TransactionChunk* tc) {
         uint8_t* chunk = tc->header;
         uint64_t pos = tc->pos;
-        uint64_t freeMap = partiallyFullChunks[chunk];
+        uint64_t chunkClass = tc->chunkClass;
+        std::unordered_map<uint8_t*,TransactionChunkFree>& chunks = partiallyFullChunks[chunkClass];
+
+        auto it = chunks.find(chunk);
+        if (it == chunks.end()) {
+            if (CHUNK_CLASS_SLOTS(chunkClass) == 1) {
+                oracleAnalyzer->freeMemoryChunk(MEMORY_MODULE_TRANSACTIONS, chunk, false);
+                return;
+            }
+            TransactionChunkFree chunkFree;
+            memset(&chunkFree, 0, sizeof(chunkFree));
+            it = chunks.insert(std::make_pair(chunk, chunkFree)).first;
+        }
 
-        freeMap |= (1 << pos);
+        TransactionChunkFree& chunkFree = it->second;
+        chunkFree.freeMap[pos / 64] |= ((uint64_t)1) << (pos & 63);
+        ++chunkFree.freeSlots;
 
-        if (freeMap == BUFFERS_FREE_MASK) {
-            oracleAnalyzer->freeMemoryChunk("transaction chunk", chunk, false);
-            partiallyFullChunks.erase(chunk);
-        } else
-            partiallyFullChunks[chunk] = freeMap;
+        if (chunkFree.freeSlots == CHUNK_CLASS_SLOTS(chunkClass)) {
+            oracleAnalyzer->freeMemoryChunk(MEMORY_MODULE_TRANSACTIONS, chunk, false);
+            chunks.erase(it);
+        }
     }
 
     void TransactionBuffer::deleteTransactionChunks(TransactionChunk* tc) {
@@ -85,27 +115,35 @@ namespace OpenLogReplicator {
         }
     }
 
-    void TransactionBuffer::addTransactionChunk(Transaction* transaction, RedoLogRecord* redoLogRecord) {
-        uint64_t length = redoLogRecord->length + ROW_HEADER_TOTAL;
-
-        if (length > DATA_BUFFER_SIZE) {
-            RUNTIME_FAIL(*oracleAnalyzer <<  "block size (" << std::dec << length
-                    << ") exceeding max block size (" << FULL_BUFFER_SIZE << "), try increasing the FULL_BUFFER_SIZE parameter");
-        }
-
-        //empty list
+    void TransactionBuffer::appendTransactionChunk(Transaction* transaction, uint64_t length) {
+        //empty list - start with the smallest class which fits
         if (transaction->lastTc == nullptr) {
-            transaction->lastTc = newTransactionChunk(transaction);
+            transaction->lastTc = newTransactionChunk(transaction, chunkClassFor(length, 0));
             transaction->firstTc = transaction->lastTc;
+            return;
         }
 
-        //new block needed
-        if (transaction->lastTc->size + length > DATA_BUFFER_SIZE) {
-            TransactionChunk* tcNew = newTransactionChunk(transaction);
+        //new block needed - grow to the next class
+        if (transaction->lastTc->size + length > CHUNK_CLASS_DATA(transaction->lastTc->chunkClass)) {
+            uint64_t chunkClass = transaction->lastTc->chunkClass;
+            if (chunkClass < CHUNK_CLASSES - 1)
+                ++chunkClass;
+            TransactionChunk* tcNew = newTransactionChunk(transaction, chunkClassFor(length, chunkClass));
             tcNew->prev = transaction->lastTc;
             transaction->lastTc->next = tcNew;
             transaction->lastTc = tcNew;
         }
+    }
+
+    void TransactionBuffer::addTransactionChunk(Transaction* transaction, RedoLogRecord* redoLogRecord) {
+        uint64_t length = redoLogRecord->length + ROW_HEADER_TOTAL;
+
+        if (length > DATA_BUFFER_SIZE) {
+            RUNTIME_FAIL(*oracleAnalyzer <<  "block size (" << std::dec << length
+                    << ") exceeding max block size (" << FULL_BUFFER_SIZE << "), try increasing the FULL_BUFFER_SIZE parameter");
+        }
+
+        appendTransactionChunk(transaction, length);
 
         //append to the chunk at the end
         TransactionChunk* tc = transaction->lastTc;
@@ -129,19 +167,7 @@ namespace OpenLogReplicator {
                     << ") exceeding max block size (" << FULL_BUFFER_SIZE << "), try increasing the FULL_BUFFER_SIZE parameter");
         }
 
-        //empty list
-        if (transaction->lastTc == nullptr) {
-            transaction->lastTc = newTransactionChunk(transaction);
-            transaction->firstTc = transaction->lastTc;
-        }
-
-        //new block needed
-        if (transaction->lastTc->size + length > DATA_BUFFER_SIZE) {
-            TransactionChunk* tcNew = newTransactionChunk(transaction);
-            tcNew->prev = transaction->lastTc;
-            transaction->lastTc->next = tcNew;
-            transaction->lastTc = tcNew;
-        }
+        appendTransactionChunk(transaction, length);
 
         //append to the chunk at the end
         TransactionChunk* tc = transaction->lastTc;
@@ -32,9 +32,17 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define ROW_HEADER_TOTAL    (sizeof(typeOP2)+sizeof(struct RedoLogRecord)+sizeof(struct RedoLogRecord)+sizeof(uint64_t))
 
 #define FULL_BUFFER_SIZE    65536
-#define HEADER_BUFFER_SIZE  (sizeof(uint64_t)+sizeof(uint64_t)+sizeof(uint64_t)+sizeof(uint8_t*)+sizeof(TransactionChunk*)+sizeof(TransactionChunk*))
+#define HEADER_BUFFER_SIZE  (sizeof(uint64_t)+sizeof(uint64_t)+sizeof(uint64_t)+sizeof(uint64_t)+sizeof(uint8_t*)+sizeof(TransactionChunk*)+sizeof(TransactionChunk*))
 #define DATA_BUFFER_SIZE    (FULL_BUFFER_SIZE-HEADER_BUFFER_SIZE)
-#define BUFFERS_FREE_MASK   0xFFFF
+
+//size classes carved from one memory chunk: 4KB, 16KB, 64KB
+#define CHUNK_CLASSES       3
+#define CHUNK_CLASS_MIN     4096
+#define CHUNK_CLASS_SIZE(__class)       (((uint64_t)CHUNK_CLASS_MIN)<<((__class)*2))
+#define CHUNK_CLASS_DATA(__class)       (CHUNK_CLASS_SIZE(__class)-HEADER_BUFFER_SIZE)
+#define CHUNK_CLASS_SLOTS(__class)      (MEMORY_CHUNK_SIZE/CHUNK_CLASS_SIZE(__class))
+#define CHUNK_SLOTS_MAX     (MEMORY_CHUNK_SIZE/CHUNK_CLASS_MIN)
+#define CHUNK_FREE_WORDS    ((CHUNK_SLOTS_MAX+63)/64)
 
 namespace OpenLogReplicator {
     class OracleAnalyzer;
@@ -46,24 +54,33 @@ namespace OpenLogReplicator {
         uint64_t elements;
         uint64_t size;
         uint64_t pos;
+        uint64_t chunkClass;
         uint8_t* header;
         TransactionChunk* prev;
         TransactionChunk* next;
+        //only first CHUNK_CLASS_DATA(chunkClass) bytes are usable
         uint8_t buffer[DATA_BUFFER_SIZE];
     };
 
+    struct TransactionChunkFree {
+        uint64_t freeMap[CHUNK_FREE_WORDS];
+        uint64_t freeSlots;
+    };
+
     class TransactionBuffer {
     protected:
         OracleAnalyzer* oracleAnalyzer;
-        uint8_t buffer[DATA_BUFFER_SIZE];
+
+        static uint64_t chunkClassFor(uint64_t length, uint64_t minClass);
 
     public:
-        std::unordered_map<uint8_t*,uint64_t> partiallyFullChunks;
+        std::unordered_map<uint8_t*,TransactionChunkFree> partiallyFullChunks[CHUNK_CLASSES];
 
         TransactionBuffer(OracleAnalyzer* oracleAnalyzer);
         virtual ~TransactionBuffer();
 
-        TransactionChunk* newTransactionChunk(Transaction* transaction);
+        TransactionChunk* newTransactionChunk(Transaction* transaction, uint64_t chunkClass);
+        void appendTransactionChunk(Transaction* transaction, uint64_t length);
         void addTransactionChunk(Transaction* transaction, RedoLogRecord* redoLogRecord1);
         void addTransactionChunk(Transaction* transaction, RedoLogRecord* redoLogRecord1, RedoLogRecord* redoLogRecord2);
         void rollbackTransactionChunk(Transaction* transaction);
@@ -180,7 +180,7 @@ namespace OpenLogReplicator {
         if (tmpFirstBuffer != nullptr) {
             while (tmpFirstBuffer->id < maxId) {
                 OutputBufferQueue* nextBuffer = tmpFirstBuffer->next;
-                oracleAnalyzer->freeMemoryChunk("KAFKA", (uint8_t*)tmpFirstBuffer, true);
+                oracleAnalyzer->freeMemoryChunk(MEMORY_MODULE_OUTPUT_BUFFER, (uint8_t*)tmpFirstBuffer, true);
                 tmpFirstBuffer = nextBuffer;
             }
             {
@@ -30,7 +30,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     WriterFile::WriterFile(const char* alias, OracleAnalyzer* oracleAnalyzer, uint64_t pollIntervalUs, uint64_t checkpointIntervalS,
             uint64_t queueSize, typeSCN startScn, typeSEQ startSequence, const char* startTime, uint64_t startTimeRel,
-            const char* output, const char* format, uint64_t maxSize, uint64_t newLine, uint64_t append) :
+            const char* output, const char* format, uint64_t maxSize, uint64_t newLine, uint64_t append,
+            uint64_t batchMessages, uint64_t batchBytes, uint64_t batchUs) :
         Writer(alias, oracleAnalyzer, 0, pollIntervalUs, checkpointIntervalS, queueSize, startScn, startSequence, startTime, startTimeRel),
         prefixPos(0),
         suffixPos(0),
@@ -46,7 +47,12 @@ namespace OpenLogReplicator {
         append(append),
         lastSequence(ZERO_SEQ),
         newLineMsg(nullptr),
-        warningDisplayed(false) {
+        warningDisplayed(false),
+        batchMessages(batchMessages),
+        batchBytes(batchBytes),
+        batchUs(batchUs),
+        batchSize(0),
+        batchStart(0) {
     }
 
     WriterFile::~WriterFile() {
@@ -303,26 +309,91 @@ namespace OpenLogReplicator {
     }
 
     void WriterFile::sendMessage(OutputBufferMsg* msg) {
+        uint64_t length = msg->length;
+        if (newLine > 0)
+            length += newLine;
+
+        //the batch must be written before the file is rotated
+        if (batch.size() > 0 && ((maxSize > 0 && outputSize + batchSize + length > maxSize) ||
+                (mode == WRITERFILE_MODE_SEQUENCE && msg->sequence != lastSequence)))
+            flush();
+
         if (newLine > 0)
             checkFile(msg->scn, msg->sequence, msg->length + 1);
         else
             checkFile(msg->scn, msg->sequence, msg->length);
 
-        int64_t bytesWritten = write(outputDes, (const char*)msg->data, msg->length);
-        if (bytesWritten != msg->length) {
-            RUNTIME_FAIL("writing file: " << outputFile << " - " << strerror(errno));
-        }
-        outputSize += bytesWritten;
+        if (batch.size() == 0)
+            batchStart = getTime();
 
+        struct iovec iov;
+        iov.iov_base = msg->data;
+        iov.iov_len = msg->length;
+        batchIov.push_back(iov);
         if (newLine > 0) {
-            bytesWritten = write(outputDes, newLineMsg, newLine);
-            if (bytesWritten != newLine) {
+            iov.iov_base = newLineMsg;
+            iov.iov_len = newLine;
+            batchIov.push_back(iov);
+        }
+        batch.push_back(msg);
+        batchSize += length;
+
+        if (batch.size() >= batchMessages || batchSize >= batchBytes)
+            flush();
+    }
+
+    //write all batched messages with as few calls as possible, confirm them when written
+    void WriterFile::flush(void) {
+        if (batch.size() == 0)
+            return;
+
+        uint64_t pos = 0;
+        while (true) {
+            //empty buffers need no write
+            while (pos < batchIov.size() && batchIov[pos].iov_len == 0)
+                ++pos;
+            if (pos == batchIov.size())
+                break;
+
+            uint64_t count = batchIov.size() - pos;
+            if (count > WRITERFILE_IOV_MAX)
+                count = WRITERFILE_IOV_MAX;
+
+            int64_t bytesWritten = writeBuffers(batchIov.data() + pos, count);
+            if (bytesWritten == -1) {
+                if (errno == EINTR)
+                    continue;
                 RUNTIME_FAIL("writing file: " << outputFile << " - " << strerror(errno));
             }
+            //nothing written and no error, retrying could loop forever
+            if (bytesWritten == 0) {
+                RUNTIME_FAIL("writing file: " << outputFile << " - no bytes written");
+            }
             outputSize += bytesWritten;
+
+            //partial write: skip complete buffers and continue with the rest
+            while (pos < batchIov.size() && (uint64_t)bytesWritten >= batchIov[pos].iov_len) {
+                bytesWritten -= batchIov[pos].iov_len;
+                ++pos;
+            }
+            if (bytesWritten > 0) {
+                batchIov[pos].iov_base = (uint8_t*)batchIov[pos].iov_base + bytesWritten;
+                batchIov[pos].iov_len -= bytesWritten;
+            }
         }
 
-        confirmMessage(msg);
+        TRACE(TRACE2_WRITER, "WRITER: written " << std::dec << batch.size() << " messages, " << batchSize << " bytes");
+
+        for (OutputBufferMsg* msg : batch)
+            confirmMessage(msg);
+
+        batch.clear();
+        batchIov.clear();
+        batchSize = 0;
+    }
+
+    int64_t WriterFile::writeBuffers(const struct iovec* iov, uint64_t count) {
+        return writev(outputDes, iov, count);
     }
 
     std::string WriterFile::getName() const {
@@ -333,5 +404,10 @@ namespace OpenLogReplicator {
     }
 
     void WriterFile::pollQueue(void) {
+        if (batch.size() == 0)
+            return;
+
+        if (tmpQueueSize >= queueSize || stop || (uint64_t)(getTime() - batchStart) >= batchUs)
+            flush();
     }
 }
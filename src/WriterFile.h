@@ -17,6 +17,9 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <sys/uio.h>
+#include <vector>
+
 #include "Writer.h"
 
 #ifndef WRITERFILE_H_
@@ -28,6 +31,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define WRITERFILE_MODE_TIMETAMP            3
 #define WRITERFILE_MODE_SEQUENCE            4
 
+#define WRITERFILE_IOV_MAX                  1024
+
 namespace OpenLogReplicator {
     class RedoLogRecord;
     class OracleAnalyzer;
@@ -52,7 +57,18 @@ namespace OpenLogReplicator {
         typeSEQ lastSequence;
         char* newLineMsg;
         bool warningDisplayed;
+        uint64_t batchMessages;
+        uint64_t batchBytes;
+        uint64_t batchUs;
+        //messages written but not confirmed yet
+        std::vector<OutputBufferMsg*> batch;
+        std::vector<struct iovec> batchIov;
+        uint64_t batchSize;
+        time_t batchStart;
         void closeFile(void);
+        void flush(void);
+        //one vectored write, opened for tests
+        virtual int64_t writeBuffers(const struct iovec* iov, uint64_t count);
         void checkFile(typeSCN scn, typeSEQ sequence, uint64_t length);
         virtual void sendMessage(OutputBufferMsg* msg);
         virtual std::string getName() const;
@@ -61,7 +77,8 @@ namespace OpenLogReplicator {
     public:
         WriterFile(const char* alias, OracleAnalyzer* oracleAnalyzer, uint64_t pollIntervalUs, uint64_t checkpointIntervalS,
                 uint64_t queueSize, typeSCN startScn, typeSEQ startSequence, const char* startTime, uint64_t startTimeRel,
-                const char* output, const char* format, uint64_t maxSize, uint64_t newLine, uint64_t append);
+                const char* output, const char* format, uint64_t maxSize, uint64_t newLine, uint64_t append,
+                uint64_t batchMessages, uint64_t batchBytes, uint64_t batchUs);
         virtual ~WriterFile();
 
         virtual void initialize(void);
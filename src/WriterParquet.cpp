@@ -0,0 +1,402 @@
+/* Thread writing rows as Parquet files
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <string.h>
+#include <sys/stat.h>
+
+#include "OracleAnalyzer.h"
+#include "OracleColumn.h"
+#include "OracleObject.h"
+#include "ParquetTable.h"
+#include "RowId.h"
+#include "RuntimeException.h"
+#include "WriterParquet.h"
+
+#define WRITERPARQUET_HEADER_COLUMNS        8
+
+namespace OpenLogReplicator {
+    WriterParquet::WriterParquet(const char* alias, OracleAnalyzer* oracleAnalyzer, uint64_t pollIntervalUs, uint64_t checkpointIntervalS,
+            uint64_t queueSize, typeSCN startScn, typeSEQ startSequence, const char* startTime, uint64_t startTimeRel,
+            const char* output, uint64_t maxSize, uint64_t codec) :
+        Writer(alias, oracleAnalyzer, 0, pollIntervalUs, checkpointIntervalS, queueSize, startScn, startSequence, startTime, startTimeRel),
+        output(output),
+        maxSize(maxSize),
+        codec(codec),
+        bufferedSize(0),
+        previousFlush(time(nullptr)),
+        lastScn(ZERO_SCN),
+        unknownSkipped(false),
+        rowObject(nullptr),
+        rowImageOffset(0),
+        rowSize(0) {
+    }
+
+    WriterParquet::~WriterParquet() {
+        for (auto it : tables) {
+            delete it.second->table;
+            delete it.second;
+        }
+        tables.clear();
+
+        for (ParquetObject* parquetObject : releasedTables) {
+            delete parquetObject->table;
+            delete parquetObject;
+        }
+        releasedTables.clear();
+    }
+
+    void WriterParquet::initialize(void) {
+        Writer::initialize();
+
+        struct stat fileStat;
+        if (stat(output.c_str(), &fileStat) != 0 || !S_ISDIR(fileStat.st_mode)) {
+            RUNTIME_FAIL("can't access output directory: " << output << " (for: parquet writer)");
+        }
+
+        outputBuffer->setRowCallback(this);
+    }
+
+    //header columns, then the object columns nested in before/after groups
+    ParquetObject* WriterParquet::getTable(OracleObject* object) {
+        std::unordered_map<OracleObject*, ParquetObject*>::iterator it = tables.find(object);
+        if (it != tables.end())
+            return it->second;
+
+        ParquetObject* parquetObject = new ParquetObject();
+        if (parquetObject == nullptr) {
+            RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(ParquetObject) << " bytes memory (for: parquet table)");
+        }
+        std::string name(object->owner + "." + object->name);
+        parquetObject->table = new ParquetTable(name.c_str(), codec);
+        if (parquetObject->table == nullptr) {
+            delete parquetObject;
+            RUNTIME_FAIL("couldn't allocate " << std::dec << sizeof(ParquetTable) << " bytes memory (for: parquet table)");
+        }
+
+        ParquetTable* table = parquetObject->table;
+        table->addColumn({}, "scn", PARQUET_TYPE_INT64, PARQUET_CONVERTED_NONE, 0);
+        table->addColumn({}, "tm", PARQUET_TYPE_INT64, PARQUET_CONVERTED_TIMESTAMP_MILLIS, 0);
+        table->addColumn({}, "xid", PARQUET_TYPE_INT64, PARQUET_CONVERTED_NONE, 0);
+        table->addColumn({}, "provisional", PARQUET_TYPE_BOOLEAN, PARQUET_CONVERTED_NONE, 0);
+        table->addColumn({}, "op", PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_UTF8, 0);
+        table->addColumn({}, "num", PARQUET_TYPE_INT64, PARQUET_CONVERTED_NONE, 0);
+        table->addColumn({}, "dataobj", PARQUET_TYPE_INT64, PARQUET_CONVERTED_NONE, 0);
+        table->addColumn({}, "rid", PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_UTF8, 1);
+
+        parquetObject->imageColumns = 0;
+        parquetObject->positions.assign(object->columns.size(), -1);
+        for (typeCOL column = 0; (uint64_t)column < object->columns.size(); ++column)
+            if (outputBuffer->columnIncluded(object->columns[column]) && !object->columnSkipped(column))
+                parquetObject->positions[column] = parquetObject->imageColumns++;
+
+        //the image and the column are optional groups, the value is optional inside
+        for (const char* group : {"before", "after"}) {
+            for (typeCOL column = 0; (uint64_t)column < object->columns.size(); ++column) {
+                if (parquetObject->positions[column] < 0)
+                    continue;
+
+                OracleColumn* oracleColumn = object->columns[column];
+                std::vector<std::string> groups = {group, oracleColumn->name};
+                uint64_t typeNo = oracleColumn->typeNo;
+                if (oracleColumn->storedAsLob)
+                    typeNo = 0;
+
+                switch (typeNo) {
+                case 12: //date
+                case 180: //timestamp
+                    table->addColumn(groups, "value", PARQUET_TYPE_INT64, PARQUET_CONVERTED_TIMESTAMP_MICROS, 3);
+                    break;
+
+                case 23: //raw
+                    table->addColumn(groups, "value", PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_NONE, 3);
+                    break;
+
+                case 100: //binary_float
+                    table->addColumn(groups, "value", PARQUET_TYPE_FLOAT, PARQUET_CONVERTED_NONE, 3);
+                    break;
+
+                case 101: //binary_double
+                    table->addColumn(groups, "value", PARQUET_TYPE_DOUBLE, PARQUET_CONVERTED_NONE, 3);
+                    break;
+
+                default:
+                    //character data, numbers as text, timestamp with time zone and unknown values
+                    table->addColumn(groups, "value", PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_UTF8, 3);
+                }
+            }
+        }
+
+        //tables are changed only by the analyzer thread, flush reads them under the lock
+        {
+            std::unique_lock<std::mutex> lck(mtx);
+            tables[object] = parquetObject;
+        }
+        TRACE(TRACE2_WRITER, "WRITER: parquet table " << table->name << " with " << std::dec << parquetObject->imageColumns << " columns");
+        return parquetObject;
+    }
+
+    //waits for the writer when the buffered rows reach the file size
+    void WriterParquet::rowBegin(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, uint64_t type, typeSCN scn,
+            typeTIME time_, typeXID xid, bool provisional, uint64_t num) {
+        rowObject = nullptr;
+        if (object == nullptr) {
+            if (!unknownSkipped) {
+                WARNING("parquet writer: skipping DML of tables without schema information");
+                unknownSkipped = true;
+            }
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lck(mtx);
+            while (bufferedSize >= maxSize && !shutdown) {
+                {
+                    std::unique_lock<std::mutex> lckBuffer(outputBuffer->mtx);
+                    outputBuffer->writersCond.notify_all();
+                }
+                flushedCond.wait_for(lck, std::chrono::microseconds(pollIntervalUs));
+            }
+        }
+
+        rowObject = getTable(object);
+        uint64_t columns = rowObject->table->columns.size();
+        if (rowValues.size() < columns) {
+            rowValues.resize(columns);
+            rowDefinitions.resize(columns);
+        }
+        for (uint64_t col = WRITERPARQUET_HEADER_COLUMNS; col < columns; ++col)
+            rowDefinitions[col] = 0;
+        rowSize = 0;
+
+        int64_t scnValue = scn, timeValue = time_.toTime() * 1000, xidValue = xid;
+        rowValue(0, PARQUET_TYPE_INT64, PARQUET_CONVERTED_NONE, (const char*)&scnValue, 8);
+        rowValue(1, PARQUET_TYPE_INT64, PARQUET_CONVERTED_TIMESTAMP_MILLIS, (const char*)&timeValue, 8);
+        rowValue(2, PARQUET_TYPE_INT64, PARQUET_CONVERTED_NONE, (const char*)&xidValue, 8);
+        char provisionalValue = provisional ? 1 : 0;
+        rowValue(3, PARQUET_TYPE_BOOLEAN, PARQUET_CONVERTED_NONE, &provisionalValue, 1);
+        switch (type) {
+        case TRANSACTION_INSERT:
+            rowValue(4, PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_UTF8, "c", 1);
+            break;
+
+        case TRANSACTION_UPDATE:
+            rowValue(4, PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_UTF8, "u", 1);
+            break;
+
+        case TRANSACTION_DELETE:
+            rowValue(4, PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_UTF8, "d", 1);
+            break;
+
+        default:
+            rowValue(4, PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_UTF8, "undo", 4);
+        }
+        int64_t numValue = num, dataObjValue = dataObj;
+        rowValue(5, PARQUET_TYPE_INT64, PARQUET_CONVERTED_NONE, (const char*)&numValue, 8);
+        rowValue(6, PARQUET_TYPE_INT64, PARQUET_CONVERTED_NONE, (const char*)&dataObjValue, 8);
+        char rid[19];
+        RowId(dataObj, bdba, slot).toString(rid);
+        rowValue(7, PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_UTF8, rid, 18);
+    }
+
+    //definition level 0: row image absent, 1: column not present in redo, 2: column null, 3: value present
+    void WriterParquet::rowImage(uint64_t type) {
+        if (rowObject == nullptr)
+            return;
+
+        rowImageOffset = WRITERPARQUET_HEADER_COLUMNS;
+        if (type == VALUE_AFTER)
+            rowImageOffset += rowObject->imageColumns;
+        for (uint64_t col = rowImageOffset; col < rowImageOffset + rowObject->imageColumns; ++col)
+            rowDefinitions[col] = 1;
+    }
+
+    //parquet column of the object column in the current image, -1 for columns not stored
+    int64_t WriterParquet::rowColumn(typeCOL col) const {
+        if (rowObject == nullptr || (uint64_t)col >= rowObject->positions.size() || rowObject->positions[col] < 0)
+            return -1;
+        return rowImageOffset + rowObject->positions[col];
+    }
+
+    //value of other type than the column, like unknown value of a date, is stored as null
+    void WriterParquet::rowValue(uint64_t col, uint64_t type, uint64_t convertedType, const char* data, uint64_t length) {
+        ParquetColumn* column = rowObject->table->columns[col];
+        if (column->type != type || column->convertedType != convertedType) {
+            rowDefinitions[col] = column->maxDefinition - 1;
+            return;
+        }
+        rowDefinitions[col] = column->maxDefinition;
+        rowValues[col].assign(data, length);
+        rowSize += length;
+    }
+
+    void WriterParquet::rowNull(typeCOL col) {
+        int64_t position = rowColumn(col);
+        if (position < 0)
+            return;
+        rowDefinitions[position] = 2;
+    }
+
+    void WriterParquet::rowString(typeCOL col, const char* data, uint64_t length) {
+        int64_t position = rowColumn(col);
+        if (position < 0)
+            return;
+        rowValue(position, PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_UTF8, data, length);
+    }
+
+    void WriterParquet::rowBytes(typeCOL col, const uint8_t* data, uint64_t length) {
+        int64_t position = rowColumn(col);
+        if (position < 0)
+            return;
+        rowValue(position, PARQUET_TYPE_BYTE_ARRAY, PARQUET_CONVERTED_NONE, (const char*)data, length);
+    }
+
+    void WriterParquet::rowTimestamp(typeCOL col, int64_t micros) {
+        int64_t position = rowColumn(col);
+        if (position < 0)
+            return;
+        rowValue(position, PARQUET_TYPE_INT64, PARQUET_CONVERTED_TIMESTAMP_MICROS, (const char*)&micros, 8);
+    }
+
+    void WriterParquet::rowFloat(typeCOL col, float value) {
+        int64_t position = rowColumn(col);
+        if (position < 0)
+            return;
+        rowValue(position, PARQUET_TYPE_FLOAT, PARQUET_CONVERTED_NONE, (const char*)&value, 4);
+    }
+
+    void WriterParquet::rowDouble(typeCOL col, double value) {
+        int64_t position = rowColumn(col);
+        if (position < 0)
+            return;
+        rowValue(position, PARQUET_TYPE_DOUBLE, PARQUET_CONVERTED_NONE, (const char*)&value, 8);
+    }
+
+    //the whole row is appended at once, the writer thread may flush the table at any time
+    void WriterParquet::rowEnd(void) {
+        if (rowObject == nullptr)
+            return;
+
+        std::unique_lock<std::mutex> lck(mtx);
+        ParquetTable* table = rowObject->table;
+        for (uint64_t col = 0; col < table->columns.size(); ++col) {
+            ParquetColumn* column = table->columns[col];
+            if (rowDefinitions[col] < column->maxDefinition && column->maxDefinition > 0) {
+                table->appendNull(col, rowDefinitions[col]);
+                continue;
+            }
+
+            const std::string& value = rowValues[col];
+            int64_t valueInt;
+            switch (column->type) {
+            case PARQUET_TYPE_BOOLEAN:
+                table->appendBoolean(col, value[0] != 0);
+                break;
+
+            case PARQUET_TYPE_INT64:
+                memcpy(&valueInt, value.c_str(), 8);
+                table->appendInt64(col, valueInt);
+                break;
+
+            case PARQUET_TYPE_FLOAT:
+                table->appendFloat(col, value.c_str());
+                break;
+
+            case PARQUET_TYPE_DOUBLE:
+                table->appendDouble(col, value.c_str());
+                break;
+
+            default:
+                table->appendBytes(col, value.c_str(), value.length());
+            }
+        }
+        ++table->rows;
+        bufferedSize += rowSize;
+        rowObject = nullptr;
+    }
+
+    //the object is about to be deleted, its rows are written with the next flush
+    void WriterParquet::releaseObject(OracleObject* object) {
+        std::unique_lock<std::mutex> lck(mtx);
+        std::unordered_map<OracleObject*, ParquetObject*>::iterator it = tables.find(object);
+        if (it == tables.end())
+            return;
+        releasedTables.push_back(it->second);
+        tables.erase(it);
+    }
+
+    void WriterParquet::sendMessage(OutputBufferMsg* msg) {
+        //messages are confirmed once the rows stored before them are written
+        lastScn = msg->scn;
+    }
+
+    //one row group per table and flush, file names carry the last scn
+    void WriterParquet::flush(void) {
+        {
+            std::unique_lock<std::mutex> lck(mtx);
+            std::vector<ParquetTable*> flushTables;
+            for (auto it : tables)
+                flushTables.push_back(it.second->table);
+            for (ParquetObject* parquetObject : releasedTables)
+                flushTables.push_back(parquetObject->table);
+
+            for (ParquetTable* table : flushTables) {
+                if (table->rows == 0)
+                    continue;
+
+                std::string fileBase(output + "/" + table->name + "-" + std::to_string(lastScn));
+                std::string fileName(fileBase + ".parquet");
+                struct stat fileStat;
+                for (uint64_t n = 1; stat(fileName.c_str(), &fileStat) == 0; ++n)
+                    fileName = fileBase + "-" + std::to_string(n) + ".parquet";
+
+                TRACE(TRACE2_WRITER, "WRITER: writing " << std::dec << table->rows << " rows to: " << fileName);
+                table->write(fileName);
+                table->clear();
+            }
+
+            for (ParquetObject* parquetObject : releasedTables) {
+                delete parquetObject->table;
+                delete parquetObject;
+            }
+            releasedTables.clear();
+            bufferedSize = 0;
+            flushedCond.notify_all();
+        }
+
+        while (tmpQueueSize > 0)
+            confirmMessage(nullptr);
+        previousFlush = time(nullptr);
+    }
+
+    std::string WriterParquet::getName() const {
+        return "parquet:" + output;
+    }
+
+    void WriterParquet::pollQueue(void) {
+        {
+            std::unique_lock<std::mutex> lck(mtx);
+            if (tmpQueueSize == 0 && bufferedSize == 0)
+                return;
+
+            if (bufferedSize < maxSize && tmpQueueSize < queueSize && !stop && (uint64_t)(time(nullptr) - previousFlush) < checkpointIntervalS)
+                return;
+        }
+        flush();
+    }
+}
@@ -0,0 +1,92 @@
+/* Header for WriterParquet class
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <condition_variable>
+#include <mutex>
+#include <unordered_map>
+
+#include "OutputBuffer.h"
+#include "Writer.h"
+
+#ifndef WRITERPARQUET_H_
+#define WRITERPARQUET_H_
+
+namespace OpenLogReplicator {
+    class ParquetTable;
+
+    //parquet table of an object with the position of each object column
+    struct ParquetObject {
+        ParquetTable* table;
+        //column in the before image, -1 for columns not stored, the after image follows after imageColumns
+        std::vector<int64_t> positions;
+        uint64_t imageColumns;
+    };
+
+    class WriterParquet : public Writer, public RowCallback {
+    protected:
+        std::string output;
+        uint64_t maxSize;
+        uint64_t codec;
+        uint64_t bufferedSize;
+        time_t previousFlush;
+        typeSCN lastScn;
+        bool unknownSkipped;
+        std::mutex mtx;
+        std::condition_variable flushedCond;
+        std::unordered_map<OracleObject*, ParquetObject*> tables;
+        //tables of released objects, written with the next flush
+        std::vector<ParquetObject*> releasedTables;
+
+        //row being built by the analyzer thread, appended to the table as a whole
+        ParquetObject* rowObject;
+        uint64_t rowImageOffset;
+        uint64_t rowSize;
+        std::vector<uint64_t> rowDefinitions;
+        std::vector<std::string> rowValues;
+
+        ParquetObject* getTable(OracleObject* object);
+        int64_t rowColumn(typeCOL col) const;
+        void rowValue(uint64_t col, uint64_t type, uint64_t convertedType, const char* data, uint64_t length);
+        void flush(void);
+        virtual void sendMessage(OutputBufferMsg* msg);
+        virtual std::string getName() const;
+        virtual void pollQueue(void);
+
+    public:
+        WriterParquet(const char* alias, OracleAnalyzer* oracleAnalyzer, uint64_t pollIntervalUs, uint64_t checkpointIntervalS,
+                uint64_t queueSize, typeSCN startScn, typeSEQ startSequence, const char* startTime, uint64_t startTimeRel,
+                const char* output, uint64_t maxSize, uint64_t codec);
+        virtual ~WriterParquet();
+
+        virtual void initialize(void);
+        virtual void rowBegin(OracleObject* object, typeDATAOBJ dataObj, typeDBA bdba, typeSLOT slot, uint64_t type, typeSCN scn, typeTIME time_,
+                typeXID xid, bool provisional, uint64_t num);
+        virtual void rowImage(uint64_t type);
+        virtual void rowNull(typeCOL col);
+        virtual void rowString(typeCOL col, const char* data, uint64_t length);
+        virtual void rowBytes(typeCOL col, const uint8_t* data, uint64_t length);
+        virtual void rowTimestamp(typeCOL col, int64_t micros);
+        virtual void rowFloat(typeCOL col, float value);
+        virtual void rowDouble(typeCOL col, double value);
+        virtual void rowEnd(void);
+        virtual void releaseObject(OracleObject* object);
+    };
+}
+
+#endif
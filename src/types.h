@@ -83,6 +83,20 @@ typedef uint64_t typeunicode;
 #define MEMORY_CHUNK_SIZE                       (MEMORY_CHUNK_SIZE_MB*1024*1024)
 #define MEMORY_CHUNK_MIN_MB                     16
 #define MEMORY_CHUNK_MIN_MB_CHR                 "16"
+#define MEMORY_MAGAZINE_SIZE                    8
+#define MEMORY_MAGAZINE_BATCH                   4
+#define MEMORY_MAGAZINE_THREAD_CACHE            4
+
+#define MEMORY_MODULE_READ_BUFFER               0
+#define MEMORY_MODULE_LWN                       1
+#define MEMORY_MODULE_TRANSACTIONS              2
+#define MEMORY_MODULE_OUTPUT_BUFFER             3
+#define MEMORY_MODULE_PROTOBUF                  4
+#define MEMORY_MODULES_NUM                      5
+//the buffer being filled is always held, at least 2 more are needed to rotate
+#define MEMORY_OUTPUT_BUFFER_QUOTA_MIN_MB       (3*MEMORY_CHUNK_SIZE_MB)
+#define MEMORY_QUOTA_WRITER_IDLE_S              10
+#define MEMORY_QUOTA_REPORT_S                   5
 
 #define ARCH_LOG_PATH                           0
 #define ARCH_LOG_ONLINE                         1
@@ -95,6 +109,8 @@ typedef uint64_t typeunicode;
 //JSON only:
 #define MESSAGE_FORMAT_SKIP_BEGIN               4
 #define MESSAGE_FORMAT_SKIP_COMMIT              8
+//all formats:
+#define MESSAGE_FORMAT_BATCH                    16
 
 #define TIMESTAMP_FORMAT_UNIX                   0
 #define TIMESTAMP_FORMAT_ISO8601                1
@@ -125,6 +141,12 @@ typedef uint64_t typeunicode;
 #define UNKNOWN_TYPE_HIDE                       0
 #define UNKNOWN_TYPE_SHOW                       1
 
+//Protobuf only:
+#define NUMBER_FORMAT_TEXT                      0
+#define NUMBER_FORMAT_NATIVE                    1
+//mantissa pairs which always fit in int64
+#define NUMBER_NATIVE_PAIRS                     9
+
 //default, only changed columns for update, or PK
 #define COLUMN_FORMAT_CHANGED                   0
 //show full nulls from insert & delete
@@ -169,6 +191,7 @@ typedef uint64_t typeunicode;
 #define REDO_FLAGS_SHOW_SYSTEM_TRANSACTIONS     0x00000800
 #define REDO_FLAGS_CHECKPOINT_KEEP              0x00001000
 #define REDO_FLAGS_SCHEMA_KEEP                  0x00002000
+#define REDO_FLAGS_SKIP_NOOP_UPDATES            0x00004000
 
 #define DISABLE_CHECK_GRANTS                    0x00000001
 #define DISABLE_CHECK_SUPPLEMENTAL_LOG          0x00000002
@@ -177,6 +200,7 @@ typedef uint64_t typeunicode;
 #define TRANSACTION_INSERT                      1
 #define TRANSACTION_DELETE                      2
 #define TRANSACTION_UPDATE                      3
+#define TRANSACTION_UNDO                        4
 
 #define OUTPUT_BUFFER_DATA_SIZE                 (MEMORY_CHUNK_SIZE - sizeof(struct OutputBufferQueue))
 #define OUTPUT_BUFFER_ALLOCATED                 0x0001
@@ -302,6 +326,7 @@ typedef uint64_t typeunicode;
 #define JSON_PASSWORD_LENGTH    128
 #define JSON_SERVER_LENGTH      4096
 #define JSON_KEY_LENGTH         4096
+#define JSON_CONDITION_LENGTH   16384
 #define JSON_XID_LIST_LENGTH    1048576
 
 #define VCONTEXT_LENGTH         30
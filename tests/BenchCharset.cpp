@@ -0,0 +1,177 @@
+/* Benchmark of character set conversion to UTF-8
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include "CharacterSet.h"
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBuffer.h"
+
+#define BENCH_CHARSET_BYTES                 (16 * 1024 * 1024)
+#define BENCH_CHARSET_LENGTH                4000
+#define BENCH_CHARSET_SAMPLES               200000
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    static uint8_t* benchAppendUtf8(uint8_t* buffer, typeunicode character) {
+        if (character <= 0x7F)
+            *buffer++ = character;
+        else if (character <= 0x7FF) {
+            *buffer++ = 0xC0 | (uint8_t)(character >> 6);
+            *buffer++ = 0x80 | (uint8_t)(character & 0x3F);
+        } else if (character <= 0xFFFF) {
+            *buffer++ = 0xE0 | (uint8_t)(character >> 12);
+            *buffer++ = 0x80 | (uint8_t)((character >> 6) & 0x3F);
+            *buffer++ = 0x80 | (uint8_t)(character & 0x3F);
+        } else {
+            *buffer++ = 0xF0 | (uint8_t)(character >> 18);
+            *buffer++ = 0x80 | (uint8_t)((character >> 12) & 0x3F);
+            *buffer++ = 0x80 | (uint8_t)((character >> 6) & 0x3F);
+            *buffer++ = 0x80 | (uint8_t)(character & 0x3F);
+        }
+        return buffer;
+    }
+
+    //valid characters of a character set: sequences which decode consumes whole without a replacement character,
+    //for UTF-8 sets only the shortest form, as the database stores it
+    static std::vector<std::string> validCharacters(const CharacterSet* characterSet, bool utf8, std::mt19937_64& random) {
+        std::vector<std::string> characters;
+        uint8_t sequence[4];
+
+        for (uint64_t length = 1; length <= 4; ++length) {
+            uint64_t count = (length == 1) ? 0x100 : (length == 2) ? 0x10000 : BENCH_CHARSET_SAMPLES;
+            for (uint64_t i = 0; i < count; ++i) {
+                for (uint64_t j = 0; j < length; ++j)
+                    sequence[j] = (length <= 2) ? (i >> (8 * (length - 1 - j))) : random();
+                const uint8_t* str = sequence;
+                uint64_t left = length;
+                typeunicode character = characterSet->decode(str, left);
+                if (left != 0 || character == UNICODE_UNKNOWN_CHARACTER)
+                    continue;
+                uint8_t shortest[4];
+                if (utf8 && (benchAppendUtf8(shortest, character) - shortest != (int64_t)length || memcmp(shortest, sequence, length) != 0 ||
+                        (character >= 0xD800 && character <= 0xDFFF)))
+                    continue;
+                characters.push_back(std::string((const char*)sequence, length));
+            }
+        }
+        return characters;
+    }
+
+    //7-bit character: decodes to its last byte, any bytes before it are zero as in AL16UTF16
+    static bool asciiCharacter(const CharacterSet* characterSet, const std::string& character) {
+        uint8_t last = character[character.length() - 1];
+        if (last > 0x7F || character.find_first_not_of('\0') != character.length() - 1)
+            return false;
+        const uint8_t* str = (const uint8_t*)character.c_str();
+        uint64_t length = character.length();
+        return characterSet->decode(str, length) == last;
+    }
+
+    //every nonAsciiRate-th character on average taken from the other characters
+    static std::string randomText(const std::vector<std::string>& ascii, const std::vector<std::string>& other, uint64_t nonAsciiRate,
+            std::mt19937_64& random) {
+        std::string str;
+        while (true) {
+            const std::string& character = (nonAsciiRate > 0 && random() % nonAsciiRate == 0) ?
+                    other[random() % other.size()] : ascii[random() % ascii.size()];
+            if (str.length() + character.length() > BENCH_CHARSET_LENGTH)
+                break;
+            str += character;
+        }
+        return str;
+    }
+
+    //per-character decode as before whole-string transcoding, then parseString
+    static void benchText(TestOutputBufferJson* outputBuffer, uint64_t charsetId, const char* kind, const std::string& str, uint64_t bytes) {
+        const CharacterSet* characterSet = outputBuffer->characterMap[charsetId];
+        uint64_t iterations = bytes / str.length() + 1;
+        std::vector<uint8_t> buffer(str.length() * 4);
+        uint64_t sum = 0;
+
+        uint64_t start = testTimeUs();
+        for (uint64_t i = 0; i < iterations; ++i) {
+            const uint8_t* data = (const uint8_t*)str.c_str();
+            uint64_t length = str.length();
+            uint8_t* end = buffer.data();
+            while (length > 0)
+                end = benchAppendUtf8(end, characterSet->decode(data, length));
+            sum += end - buffer.data();
+        }
+        uint64_t timeDecode = testTimeUs() - start + 1;
+
+        start = testTimeUs();
+        for (uint64_t i = 0; i < iterations; ++i) {
+            outputBuffer->parseString((const uint8_t*)str.c_str(), str.length(), charsetId);
+            sum += outputBuffer->value().length();
+        }
+        uint64_t timeParse = testTimeUs() - start + 1;
+
+        std::cout << std::left << std::setw(18) << characterSet->name << std::right << " " << kind << ": by character: " << std::dec <<
+                (iterations * str.length() / timeDecode) << " MB/s, parseString: " << (iterations * str.length() / timeParse) <<
+                " MB/s (" << (sum & 1) << ")" << std::endl;
+    }
+
+    //every registered character set: 7-bit text, mostly 7-bit text and text without 7-bit characters
+    static void benchCharsets(uint64_t bytes) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        std::mt19937_64 random(1);
+        std::map<uint64_t, CharacterSet*> characterSets(output.outputBuffer->characterMap.begin(), output.outputBuffer->characterMap.end());
+
+        for (auto it : characterSets) {
+            std::vector<std::string> characters = validCharacters(it.second, it.first == 871 || it.first == 873, random);
+            std::vector<std::string> ascii;
+            std::vector<std::string> other;
+            for (const std::string& character : characters) {
+                if (asciiCharacter(it.second, character))
+                    ascii.push_back(character);
+                else
+                    other.push_back(character);
+            }
+
+            if (ascii.size() > 0) {
+                benchText(output.outputBuffer, it.first, "ASCII", randomText(ascii, other, 0, random), bytes);
+                if (other.size() > 0)
+                    benchText(output.outputBuffer, it.first, "1/8 other", randomText(ascii, other, 8, random), bytes);
+            }
+            if (other.size() > 0)
+                benchText(output.outputBuffer, it.first, "other", randomText(other, other, 0, random), bytes);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t bytes = BENCH_CHARSET_BYTES;
+    if (argc > 1)
+        bytes = strtoull(argv[1], nullptr, 10);
+
+    //sampling for valid characters hits invalid sequences, which decode reports
+    OpenLogReplicator::trace = TRACE_SILENT;
+
+    try {
+        OpenLogReplicator::benchCharsets(bytes);
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return TEST_PASS;
+}
@@ -0,0 +1,103 @@
+/* Benchmark of JSON string escaping and hex encoding kernels
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <vector>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBuffer.h"
+
+#define BENCH_ESCAPE_BYTES                  (512 * 1024 * 1024)
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    //character at a time, as before the vector kernels
+    static uint64_t benchScanBytes(const char* str, uint64_t length) {
+        for (uint64_t i = 0; i < length; ++i) {
+            uint8_t character = str[i];
+            if (character < 0x20 || character == '"' || character == '\\' || character == '/')
+                return i;
+        }
+        return length;
+    }
+
+    static void benchHexNibbles(uint8_t* dst, const uint8_t* src, uint64_t length) {
+        for (uint64_t i = 0; i < length; ++i) {
+            *dst++ = "0123456789abcdef"[src[i] >> 4];
+            *dst++ = "0123456789abcdef"[src[i] & 0x0F];
+        }
+    }
+
+    static void benchScan(const char* name, uint64_t length, uint64_t bytes) {
+        std::string str(length, 'x');
+        uint64_t iterations = bytes / length;
+        uint64_t sum = 0;
+
+        uint64_t start = testTimeUs();
+        for (uint64_t i = 0; i < iterations; ++i)
+            sum += benchScanBytes(str.c_str(), length - (i & 1));
+        uint64_t timeBytes = testTimeUs() - start + 1;
+
+        start = testTimeUs();
+        for (uint64_t i = 0; i < iterations; ++i)
+            sum += TestOutputBufferJson::escapeScan(str.c_str(), length - (i & 1));
+        uint64_t timeKernel = testTimeUs() - start + 1;
+
+        std::cout << name << " (" << std::dec << length << " bytes): by character: " << (iterations * length / timeBytes) << " MB/s" <<
+                ", kernel: " << (iterations * length / timeKernel) << " MB/s (" << (sum & 1) << ")" << std::endl;
+    }
+
+    static void benchHex(const char* name, uint64_t length, uint64_t bytes) {
+        std::vector<uint8_t> src(length);
+        std::vector<uint8_t> dst(length * 2);
+        for (uint64_t i = 0; i < length; ++i)
+            src[i] = i * 7;
+        uint64_t iterations = bytes / length;
+
+        uint64_t start = testTimeUs();
+        for (uint64_t i = 0; i < iterations; ++i)
+            benchHexNibbles(dst.data(), src.data(), length);
+        uint64_t timeNibbles = testTimeUs() - start + 1;
+
+        start = testTimeUs();
+        for (uint64_t i = 0; i < iterations; ++i)
+            TestOutputBufferJson::hexEncode(dst.data(), src.data(), length);
+        uint64_t timeKernel = testTimeUs() - start + 1;
+
+        std::cout << name << " (" << std::dec << length << " bytes): by nibble: " << (iterations * length / timeNibbles) << " MB/s" <<
+                ", kernel: " << (iterations * length / timeKernel) << " MB/s (" << (uint64_t)(dst[0] & 1) << ")" << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t bytes = BENCH_ESCAPE_BYTES;
+    if (argc > 1)
+        bytes = strtoull(argv[1], nullptr, 10);
+
+    try {
+        OpenLogReplicator::benchScan("short name", 12, bytes / 4);
+        OpenLogReplicator::benchScan("long VARCHAR2", 4000, bytes);
+        OpenLogReplicator::benchHex("XID/SCN", 8, bytes / 4);
+        OpenLogReplicator::benchHex("large RAW", 2000, bytes);
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return TEST_PASS;
+}
@@ -0,0 +1,98 @@
+/* Benchmark of JSON formatting throughput of the output buffer
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBuffer.h"
+
+#define BENCH_FORMAT_ROWS                   1000000
+#define BENCH_FORMAT_COLUMNS                8
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    static const char* benchKeys[BENCH_FORMAT_COLUMNS] = {
+        "\"ID\":", "\"NAME\":", "\"DESCRIPTION\":", "\"CREATED\":", "\"AMOUNT\":", "\"STATUS\":", "\"OWNER\":", "\"COMMENTS\":"
+    };
+    static const char* benchValues[BENCH_FORMAT_COLUMNS] = {
+        "\"12345\"", "\"John Smith\"", "\"a longer VARCHAR2 value with some words in it\"", "1650000000", "\"1234.56\"", "\"ACTIVE\"",
+        "\"SCOTT\"", "\"\""
+    };
+
+    //row formatted one character at a time, like appends before span copies
+    static void benchRowBytes(TestOutputBufferJson* outputBuffer) {
+        outputBuffer->outputBufferAppend('{');
+        for (uint64_t i = 0; i < BENCH_FORMAT_COLUMNS; ++i) {
+            if (i > 0)
+                outputBuffer->outputBufferAppend(',');
+            for (const char* str = benchKeys[i]; *str != 0; ++str)
+                outputBuffer->outputBufferAppend(*str);
+            for (const char* str = benchValues[i]; *str != 0; ++str)
+                outputBuffer->outputBufferAppend(*str);
+        }
+        outputBuffer->outputBufferAppend('}');
+    }
+
+    static void benchRowSpans(TestOutputBufferJson* outputBuffer) {
+        outputBuffer->outputBufferAppend('{');
+        for (uint64_t i = 0; i < BENCH_FORMAT_COLUMNS; ++i) {
+            if (i > 0)
+                outputBuffer->outputBufferAppend(',');
+            outputBuffer->outputBufferAppend(benchKeys[i]);
+            outputBuffer->outputBufferAppend(benchValues[i]);
+        }
+        outputBuffer->outputBufferAppend('}');
+    }
+
+    static void benchRun(const char* name, void (*row)(TestOutputBufferJson*), uint64_t rows) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        TestOutputBufferJson* outputBuffer = output.outputBuffer;
+        uint64_t bytes = 0;
+
+        uint64_t start = testTimeUs();
+        outputBuffer->outputBufferBegin(0);
+        for (uint64_t i = 0; i < rows; ++i) {
+            row(outputBuffer);
+            //keep the memory bounded, the writer would confirm the chunks
+            if (outputBuffer->buffersAllocated > 4) {
+                bytes += outputBuffer->length();
+                outputBuffer->discard();
+                outputBuffer->outputBufferBegin(0);
+            }
+        }
+        bytes += outputBuffer->length();
+        uint64_t time = testTimeUs() - start + 1;
+
+        std::cout << name << ": " << std::dec << (rows * 1000000 / time) << " rows/s, " << (bytes / time) << " MB/s" << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t rows = BENCH_FORMAT_ROWS;
+    if (argc > 1)
+        rows = strtoull(argv[1], nullptr, 10);
+
+    try {
+        OpenLogReplicator::benchRun("byte appends", OpenLogReplicator::benchRowBytes, rows);
+        OpenLogReplicator::benchRun("span appends", OpenLogReplicator::benchRowSpans, rows);
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return TEST_PASS;
+}
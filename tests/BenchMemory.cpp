@@ -0,0 +1,146 @@
+/* Benchmark of memory chunk allocation with many threads
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "OracleAnalyzer.h"
+#include "RuntimeException.h"
+#include "Test.h"
+
+#define BENCH_MEMORY_HELD                   4
+#define BENCH_MEMORY_THREADS_MAX            16
+#define BENCH_MEMORY_ITERATIONS             1000000
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    class BenchMemoryAnalyzer : public OracleAnalyzer {
+    public:
+        BenchMemoryAnalyzer(uint64_t memoryMb) :
+            OracleAnalyzer(nullptr, 0, 0, "", "bench", "bench", memoryMb, memoryMb, 1, 0) {
+        }
+
+        uint64_t depotLocks(void) const {
+            return memoryDepotLocks;
+        }
+
+        uint64_t depotContended(void) const {
+            return memoryDepotContended;
+        }
+    };
+
+    //the single locked pool used before per-thread magazines, as a reference
+    class BenchMemoryLockedPool {
+    public:
+        std::mutex mtx;
+        std::vector<uint8_t*> chunks;
+
+        uint8_t* get(void) {
+            std::unique_lock<std::mutex> lck(mtx);
+            uint8_t* chunk = chunks.back();
+            chunks.pop_back();
+            return chunk;
+        }
+
+        void free(uint8_t* chunk) {
+            std::unique_lock<std::mutex> lck(mtx);
+            chunks.push_back(chunk);
+        }
+    };
+
+    static void benchAnalyzer(BenchMemoryAnalyzer* analyzer, uint64_t iterations) {
+        uint8_t* held[BENCH_MEMORY_HELD];
+        for (uint64_t i = 0; i < iterations; ++i) {
+            for (uint64_t j = 0; j < BENCH_MEMORY_HELD; ++j)
+                held[j] = analyzer->getMemoryChunk(MEMORY_MODULE_TRANSACTIONS, false);
+            for (uint64_t j = 0; j < BENCH_MEMORY_HELD; ++j)
+                analyzer->freeMemoryChunk(MEMORY_MODULE_TRANSACTIONS, held[j], false);
+        }
+    }
+
+    static void benchLockedPool(BenchMemoryLockedPool* pool, uint64_t iterations) {
+        uint8_t* held[BENCH_MEMORY_HELD];
+        for (uint64_t i = 0; i < iterations; ++i) {
+            for (uint64_t j = 0; j < BENCH_MEMORY_HELD; ++j)
+                held[j] = pool->get();
+            for (uint64_t j = 0; j < BENCH_MEMORY_HELD; ++j)
+                pool->free(held[j]);
+        }
+    }
+
+    static void benchRun(uint64_t threadsNum, uint64_t iterations) {
+        //every thread holds some chunks and may cache a full magazine
+        uint64_t memoryMb = threadsNum * (BENCH_MEMORY_HELD + MEMORY_MAGAZINE_SIZE) * MEMORY_CHUNK_SIZE_MB + MEMORY_CHUNK_MIN_MB;
+        BenchMemoryAnalyzer* analyzer = new BenchMemoryAnalyzer(memoryMb);
+        analyzer->initialize();
+
+        std::vector<std::thread> threads;
+        uint64_t start = testTimeUs();
+        for (uint64_t i = 0; i < threadsNum; ++i)
+            threads.push_back(std::thread(benchAnalyzer, analyzer, iterations));
+        for (std::thread& thread : threads)
+            thread.join();
+        uint64_t timeAnalyzer = testTimeUs() - start + 1;
+        threads.clear();
+
+        uint64_t ops = threadsNum * iterations * BENCH_MEMORY_HELD * 2;
+        uint64_t depotLocks = analyzer->depotLocks();
+        uint64_t depotContended = analyzer->depotContended();
+        delete analyzer;
+
+        BenchMemoryLockedPool pool;
+        for (uint64_t i = 0; i < threadsNum * BENCH_MEMORY_HELD; ++i)
+            pool.chunks.push_back(new uint8_t[1]);
+        start = testTimeUs();
+        for (uint64_t i = 0; i < threadsNum; ++i)
+            threads.push_back(std::thread(benchLockedPool, &pool, iterations));
+        for (std::thread& thread : threads)
+            thread.join();
+        uint64_t timeLocked = testTimeUs() - start + 1;
+        for (uint8_t* chunk : pool.chunks)
+            delete[] chunk;
+
+        std::cout << "threads: " << std::dec << threadsNum <<
+                ", magazines: " << (ops * 1000000 / timeAnalyzer) << " ops/s" <<
+                ", depot locks: " << depotLocks << " (" << (depotLocks * 1000000 / ops) << " per 1M ops, contended: " << depotContended << ")" <<
+                ", single lock: " << (ops * 1000000 / timeLocked) << " ops/s" << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t iterations = BENCH_MEMORY_ITERATIONS;
+    if (argc > 1)
+        iterations = strtoull(argv[1], nullptr, 10);
+
+    uint64_t threadsMax = std::thread::hardware_concurrency();
+    if (threadsMax < 2)
+        threadsMax = 2;
+    if (threadsMax > BENCH_MEMORY_THREADS_MAX)
+        threadsMax = BENCH_MEMORY_THREADS_MAX;
+
+    try {
+        for (uint64_t threadsNum = 1; threadsNum <= threadsMax; threadsNum *= 2)
+            OpenLogReplicator::benchRun(threadsNum, iterations);
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return TEST_PASS;
+}
@@ -0,0 +1,214 @@
+/* Benchmark of rows written as Parquet files compared with JSON file output
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <random>
+#include <sys/stat.h>
+
+#include "ParquetTable.h"
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestNumberEncoder.h"
+#include "TestOutputBuffer.h"
+#include "TestOutputBufferAvro.h"
+#include "WriterFile.h"
+#include "WriterParquet.h"
+
+#define BENCH_PARQUET_ROWS                  1000000
+#define BENCH_PARQUET_TRANSACTION_ROWS      10
+#define BENCH_PARQUET_VALUES                4096
+#define BENCH_PARQUET_QUEUE_SIZE            65536
+#define BENCH_PARQUET_MAX_SIZE              134217728
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    class BenchWriterFile : public WriterFile {
+    public:
+        BenchWriterFile(OracleAnalyzer* oracleAnalyzer, const char* output) :
+            WriterFile("bench", oracleAnalyzer, 1000, 10, BENCH_PARQUET_QUEUE_SIZE, ZERO_SCN, ZERO_SEQ, "", 0, output, "", 0, 1, 1,
+                    1000, 1048576, 1000000000) {
+        }
+
+        using WriterFile::flush;
+        using WriterFile::pollQueue;
+
+        void send(OutputBufferMsg* msg) {
+            createMessage(msg);
+            sendMessage(msg);
+        }
+    };
+
+    class BenchWriterParquet : public WriterParquet {
+    public:
+        BenchWriterParquet(OracleAnalyzer* oracleAnalyzer, const char* output, uint64_t codec) :
+            WriterParquet("bench", oracleAnalyzer, 1000, 10, BENCH_PARQUET_QUEUE_SIZE, ZERO_SCN, ZERO_SEQ, "", 0, output, BENCH_PARQUET_MAX_SIZE,
+                    codec) {
+        }
+
+        using WriterParquet::flush;
+        using WriterParquet::pollQueue;
+
+        void send(OutputBufferMsg* msg) {
+            createMessage(msg);
+            sendMessage(msg);
+        }
+    };
+
+    //column values of the N, V, D, R, F, B columns, rows take them in turns
+    struct BenchValues {
+        std::vector<std::string> columns[6];
+
+        BenchValues(void) {
+            std::mt19937_64 random(1);
+            for (uint64_t i = 0; i < BENCH_PARQUET_VALUES; ++i) {
+                std::vector<uint8_t> number = encodeNumber(false, std::to_string(random() % 1000000), std::to_string(random() % 100 + 1));
+                columns[0].push_back(std::string(number.begin(), number.end()));
+                columns[1].push_back("customer name " + std::to_string(random() % 100000));
+                std::string date("\x78\x7A\x0A\x13\x0D\x23\x39", 7);
+                date[3] = 1 + random() % 28;
+                date[6] = 1 + random() % 60;
+                columns[2].push_back(date);
+                std::string raw;
+                for (uint64_t j = 0; j < 16; ++j)
+                    raw.push_back((char)random());
+                columns[3].push_back(raw);
+                float f = (float)(random() % 100000) / 100;
+                double b = (double)(random() % 10000000) / 1000;
+                columns[4].push_back(std::string((const char*)&f, 4));
+                columns[5].push_back(std::string((const char*)&b, 8));
+            }
+        }
+    };
+
+    //all messages of the output buffer, which keeps the chunks until they are discarded
+    template<class WRITER> static void benchSend(TestOutputBufferJson* outputBuffer, WRITER& writer) {
+        for (OutputBufferQueue* buffer = outputBuffer->firstBuffer; buffer != nullptr; buffer = buffer->next) {
+            uint64_t pos = 0;
+            while (pos + sizeof(struct OutputBufferMsg) < buffer->length) {
+                OutputBufferMsg* msg = (OutputBufferMsg*)(buffer->data + pos);
+                if (msg->length == 0)
+                    break;
+                if (pos + sizeof(struct OutputBufferMsg) + msg->length > buffer->length) {
+                    RUNTIME_FAIL("benchmark message spans output buffer chunks");
+                }
+                writer.send(msg);
+                pos += sizeof(struct OutputBufferMsg) + ((msg->length + 7) & 0xFFFFFFFFFFFFFFF8);
+            }
+        }
+    }
+
+    template<class WRITER> static void benchRows(TestOutputBufferJson* outputBuffer, WRITER& writer, OracleObject* object, const BenchValues& values,
+            uint64_t rows) {
+        for (uint64_t i = 0; i < rows; ++i) {
+            if (i % BENCH_PARQUET_TRANSACTION_ROWS == 0)
+                outputBuffer->processBegin(i + 1, 1000, 0, i);
+
+            for (uint64_t column = 0; column < 6; ++column)
+                outputBuffer->set(VALUE_AFTER, column, values.columns[column][i % BENCH_PARQUET_VALUES]);
+            outputBuffer->row(TRANSACTION_INSERT, object, 0x01000010, i % 256);
+            //like Writer::run, the parquet writer flushes here once the rows reach the file size
+            writer.pollQueue();
+
+            if (i % BENCH_PARQUET_TRANSACTION_ROWS == BENCH_PARQUET_TRANSACTION_ROWS - 1 || i == rows - 1)
+                outputBuffer->processCommit();
+
+            //keep the memory bounded, the writer confirms the messages once written
+            if (outputBuffer->buffersAllocated > 4 && outputBuffer->msg == nullptr) {
+                benchSend(outputBuffer, writer);
+                writer.flush();
+                outputBuffer->discard();
+            }
+        }
+        benchSend(outputBuffer, writer);
+        writer.flush();
+        outputBuffer->discard();
+    }
+
+    static uint64_t benchBytes(const TestDirectory& output) {
+        uint64_t bytes = 0;
+        for (const std::string& name : output.files()) {
+            struct stat fileStat;
+            if (stat((output.path + "/" + name).c_str(), &fileStat) == 0)
+                bytes += fileStat.st_size;
+        }
+        return bytes;
+    }
+
+    static void benchReport(const char* name, uint64_t rows, uint64_t time, uint64_t bytes, uint64_t jsonBytes) {
+        std::cout << name << ": " << std::dec << (rows * 1000000 / time) << " rows/s, " << bytes << " bytes";
+        if (jsonBytes > 0)
+            std::cout << " (" << (bytes * 100 / jsonBytes) << "% of JSON)";
+        std::cout << std::endl;
+    }
+
+    //JSON messages written to one file by the file writer
+    static uint64_t benchJson(OracleObject* object, const BenchValues& values, uint64_t rows) {
+        TestOutput json(NUMBER_FORMAT_TEXT);
+        TestDirectory output;
+        std::string fileName(output.path + "/output.json");
+        BenchWriterFile writer(json.analyzer, fileName.c_str());
+        writer.initialize();
+
+        uint64_t start = testTimeUs();
+        benchRows(json.outputBuffer, writer, object, values, rows);
+        uint64_t time = testTimeUs() - start + 1;
+
+        uint64_t bytes = benchBytes(output);
+        benchReport("JSON file", rows, time, bytes, 0);
+        return bytes;
+    }
+
+    //rows passed to the parquet writer, messages carry only begin and commit
+    static void benchParquet(const char* name, uint64_t codec, OracleObject* object, const BenchValues& values, uint64_t rows, uint64_t jsonBytes) {
+        TestOutput json(NUMBER_FORMAT_TEXT);
+        TestDirectory output;
+        BenchWriterParquet writer(json.analyzer, output.path.c_str(), codec);
+        writer.initialize();
+
+        uint64_t start = testTimeUs();
+        benchRows(json.outputBuffer, writer, object, values, rows);
+        uint64_t time = testTimeUs() - start + 1;
+
+        benchReport(name, rows, time, benchBytes(output), jsonBytes);
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t rows = BENCH_PARQUET_ROWS;
+    if (argc > 1)
+        rows = strtoull(argv[1], nullptr, 10);
+
+    OpenLogReplicator::OracleObject* object = OpenLogReplicator::testAvroObject();
+    try {
+        OpenLogReplicator::BenchValues values;
+        uint64_t jsonBytes = OpenLogReplicator::benchJson(object, values, rows);
+        OpenLogReplicator::benchParquet("parquet", PARQUET_CODEC_UNCOMPRESSED, object, values, rows, jsonBytes);
+#ifdef LINK_LIBRARY_SNAPPY
+        OpenLogReplicator::benchParquet("parquet snappy", PARQUET_CODEC_SNAPPY, object, values, rows, jsonBytes);
+#endif /* LINK_LIBRARY_SNAPPY */
+#ifdef LINK_LIBRARY_ZSTD
+        OpenLogReplicator::benchParquet("parquet zstd", PARQUET_CODEC_ZSTD, object, values, rows, jsonBytes);
+#endif /* LINK_LIBRARY_ZSTD */
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        delete object;
+        return TEST_FAIL;
+    }
+    delete object;
+    return TEST_PASS;
+}
@@ -0,0 +1,174 @@
+/* Benchmark of Protobuf message serialization
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <atomic>
+#include <new>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBufferProtobuf.h"
+
+#define BENCH_PROTOBUF_MESSAGES             200000
+#define BENCH_PROTOBUF_LARGE_DIVIDER        1000
+
+TEST_GLOBALS
+
+//every heap allocation of the process is counted
+static std::atomic<uint64_t> benchAllocations(0);
+
+void* operator new(size_t size) {
+    ++benchAllocations;
+    void* ptr = malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    ++benchAllocations;
+    void* ptr = malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t size) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t size) noexcept {
+    free(ptr);
+}
+
+namespace OpenLogReplicator {
+    //one insert with the given number of columns, string values of the given length
+    static void fillResponse(pb::RedoResponse* redoResponsePB, uint64_t columns, const std::string& value) {
+        redoResponsePB->set_scn(123456789);
+        redoResponsePB->set_tm(1600000000);
+        redoResponsePB->set_xid("0x0001.002.00000003");
+        redoResponsePB->add_payload();
+        pb::Payload* payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
+        payloadPB->set_op(pb::INSERT);
+
+        for (uint64_t column = 0; column < columns; ++column) {
+            payloadPB->add_after();
+            pb::Value* valuePB = payloadPB->mutable_after(payloadPB->after_size() - 1);
+            valuePB->set_name("C");
+            if ((column & 1) == 0)
+                valuePB->set_value_int(column * 1000003);
+            else
+                valuePB->set_value_string(value);
+        }
+    }
+
+    //heap message, serialized to a string when it doesn't fit in the chunk, as before the arena
+    static void benchHeap(TestOutputBufferProtobuf* outputBuffer, uint64_t messages, uint64_t columns, const std::string& value) {
+        for (uint64_t i = 0; i < messages; ++i) {
+            outputBuffer->outputBufferBegin(0);
+            pb::RedoResponse* redoResponsePB = new pb::RedoResponse;
+            fillResponse(redoResponsePB, columns, value);
+
+            uint64_t size = redoResponsePB->ByteSizeLong();
+            uint8_t* data = outputBuffer->outputBufferReserve(size);
+            bool ret;
+            if (data != nullptr) {
+                ret = redoResponsePB->SerializeToArray(data, size);
+                if (ret)
+                    outputBuffer->outputBufferReserveCommit(size);
+            } else {
+                std::string output;
+                ret = redoResponsePB->SerializeToString(&output);
+                if (ret)
+                    outputBuffer->outputBufferAppend(output);
+            }
+            delete redoResponsePB;
+            if (!ret) {
+                RUNTIME_FAIL("serialization failed");
+            }
+            outputBuffer->discard();
+        }
+    }
+
+    static void benchArena(TestOutputBufferProtobuf* outputBuffer, uint64_t messages, uint64_t columns, const std::string& value) {
+        for (uint64_t i = 0; i < messages; ++i) {
+            outputBuffer->outputBufferBegin(0);
+            outputBuffer->createResponse();
+            fillResponse(outputBuffer->redoResponsePB, columns, value);
+            if (!outputBuffer->appendResponse()) {
+                RUNTIME_FAIL("serialization failed");
+            }
+            outputBuffer->discard();
+        }
+    }
+
+    static void benchRun(const char* name, uint64_t messages, uint64_t columns, uint64_t valueLength) {
+        TestOutputProtobuf output(NUMBER_FORMAT_TEXT);
+        std::string value(valueLength, 'v');
+
+        //warm up, the first run allocates chunks and arena blocks
+        benchHeap(output.outputBuffer, 1, columns, value);
+        benchArena(output.outputBuffer, 1, columns, value);
+
+        uint64_t allocations = benchAllocations;
+        uint64_t start = testTimeUs();
+        benchHeap(output.outputBuffer, messages, columns, value);
+        uint64_t timeHeap = testTimeUs() - start + 1;
+        uint64_t allocationsHeap = benchAllocations - allocations;
+
+        allocations = benchAllocations;
+        start = testTimeUs();
+        benchArena(output.outputBuffer, messages, columns, value);
+        uint64_t timeArena = testTimeUs() - start + 1;
+        uint64_t allocationsArena = benchAllocations - allocations;
+
+        std::cout << name << ": " << std::dec << messages << " messages of " << columns << " columns" <<
+                ", arena: " << (messages * 1000000 / timeArena) << " msg/s, " <<
+                ((double)allocationsArena / messages) << " allocations/msg" <<
+                ", heap: " << (messages * 1000000 / timeHeap) << " msg/s, " <<
+                ((double)allocationsHeap / messages) << " allocations/msg" << std::endl;
+    }
+
+    //a message larger than a chunk, streamed across chunks
+    static void benchLarge(uint64_t messages) {
+        benchRun("large message", messages / BENCH_PROTOBUF_LARGE_DIVIDER + 1, 40, OUTPUT_BUFFER_DATA_SIZE / 16);
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t messages = BENCH_PROTOBUF_MESSAGES;
+    if (argc > 1)
+        messages = strtoull(argv[1], nullptr, 10);
+
+    try {
+        OpenLogReplicator::benchRun("short values", messages, 10, 8);
+        OpenLogReplicator::benchRun("long values", messages, 10, 100);
+        OpenLogReplicator::benchLarge(messages);
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return TEST_PASS;
+}
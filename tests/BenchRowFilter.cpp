@@ -0,0 +1,101 @@
+/* Benchmark of table row filter conditions
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <random>
+
+#include "ConfigurationException.h"
+#include "OracleColumn.h"
+#include "OracleObject.h"
+#include "RowFilter.h"
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestNumberEncoder.h"
+#include "TestOutputBuffer.h"
+
+#define BENCH_ROW_FILTER_ROWS               10000000
+#define BENCH_ROW_FILTER_VALUES             4096
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    uint8_t* values[MAX_NO_COLUMNS][4];
+    uint64_t lengths[MAX_NO_COLUMNS][4];
+
+    //encoded bytes compared against encoded literals, or every value decoded to text and parsed as a double
+    static void benchNumbers(uint64_t rows) {
+        std::string owner("TEST");
+        std::string name("T");
+        std::string columnName("N");
+        OracleObject* object = new OracleObject(1, 1, 1, 0, 0, owner, name);
+        object->addColumn(new OracleColumn(1, -1, 1, columnName, 2, 22, -1, -1, 0, 0, true, false, false, false, false, false, false, false));
+        RowFilter filter(object, "N > 1000 AND N <= 5000.5 OR N IN (-1, -2, -3)");
+        TestOutputBufferJson outputBuffer(NUMBER_FORMAT_NATIVE);
+
+        std::mt19937_64 random(1);
+        std::vector<std::vector<uint8_t>> numbers;
+        for (uint64_t i = 0; i < BENCH_ROW_FILTER_VALUES; ++i) {
+            std::string fraction = (random() % 2 == 0) ? "" : std::to_string(random() % 100);
+            if (fraction.length() > 0 && fraction[fraction.length() - 1] == '0')
+                fraction.pop_back();
+            numbers.push_back(encodeNumber(random() % 8 == 0, std::to_string(random() % 10000), fraction));
+        }
+
+        uint64_t passedFilter = 0;
+        uint64_t start = testTimeUs();
+        for (uint64_t i = 0; i < rows; ++i) {
+            std::vector<uint8_t>& number = numbers[i % BENCH_ROW_FILTER_VALUES];
+            values[0][VALUE_AFTER] = number.data();
+            lengths[0][VALUE_AFTER] = number.size();
+            if (filter.evaluate(values, lengths, TRANSACTION_INSERT))
+                ++passedFilter;
+        }
+        uint64_t timeFilter = testTimeUs() - start + 1;
+
+        uint64_t passedDecoded = 0;
+        start = testTimeUs();
+        for (uint64_t i = 0; i < rows; ++i) {
+            std::vector<uint8_t>& number = numbers[i % BENCH_ROW_FILTER_VALUES];
+            outputBuffer.parseNumber(number.data(), number.size());
+            std::string text = outputBuffer.value();
+            double value = strtod(text.c_str(), nullptr);
+            if ((value > 1000 && value <= 5000.5) || value == -1 || value == -2 || value == -3)
+                ++passedDecoded;
+        }
+        uint64_t timeDecoded = testTimeUs() - start + 1;
+
+        std::cout << "NUMBER condition: decoded: " << std::dec << (rows * 1000000 / timeDecoded) << " rows/s, row filter: " <<
+                (rows * 1000000 / timeFilter) << " rows/s, passed: " << passedFilter << "/" << passedDecoded << std::endl;
+        delete object;
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t rows = BENCH_ROW_FILTER_ROWS;
+    if (argc > 1)
+        rows = strtoull(argv[1], nullptr, 10);
+
+    try {
+        OpenLogReplicator::benchNumbers(rows);
+    } catch (OpenLogReplicator::ConfigurationException& ex) {
+        return TEST_FAIL;
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return TEST_PASS;
+}
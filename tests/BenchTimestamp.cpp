@@ -0,0 +1,122 @@
+/* Benchmark of DATE/TIMESTAMP conversion and time zone lookup
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <ctime>
+#include <vector>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBuffer.h"
+
+#define BENCH_TIMESTAMP_VALUES              10000000
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    //rows of a batch mostly share the day, only the time changes
+    static void benchDates(TestOutputBufferJson* outputBuffer, uint64_t values) {
+        int64_t sum = 0;
+        struct tm epochTime;
+        memset(&epochTime, 0, sizeof(epochTime));
+
+        uint64_t start = testTimeUs();
+        for (uint64_t i = 0; i < values; ++i) {
+            epochTime.tm_year = 2022 - 1900;
+            epochTime.tm_mon = 3;
+            epochTime.tm_mday = 1 + (i >> 16) % 28;
+            epochTime.tm_hour = (i >> 10) % 24;
+            epochTime.tm_min = (i >> 4) % 60;
+            epochTime.tm_sec = i % 60;
+            sum += timegm(&epochTime);
+        }
+        uint64_t timeGeneric = testTimeUs() - start + 1;
+
+        start = testTimeUs();
+        for (uint64_t i = 0; i < values; ++i)
+            sum += outputBuffer->daysFromCivil(2022, 4, 1 + (i >> 16) % 28) * 86400 + ((i >> 10) % 24) * 3600 + ((i >> 4) % 60) * 60 + i % 60;
+        uint64_t timeCached = testTimeUs() - start + 1;
+
+        std::cout << "epoch seconds: timegm: " << std::dec << (values * 1000000 / timeGeneric) << " values/s, cached days: " <<
+                (values * 1000000 / timeCached) << " values/s (" << (sum & 1) << ")" << std::endl;
+    }
+
+    static void benchIso8601(TestOutputBufferJson* outputBuffer, uint64_t values) {
+        char buffer[64];
+        uint64_t sum = 0;
+        struct tm epochTime;
+        memset(&epochTime, 0, sizeof(epochTime));
+        epochTime.tm_year = 2022;
+        epochTime.tm_mon = 4;
+        epochTime.tm_mday = 23;
+
+        uint64_t start = testTimeUs();
+        for (uint64_t i = 0; i < values; ++i) {
+            epochTime.tm_sec = i % 60;
+            sum += snprintf(buffer, sizeof(buffer), "%d-%02d-%02dT%02d:%02d:%02d.%09d", epochTime.tm_year, epochTime.tm_mon, epochTime.tm_mday,
+                    epochTime.tm_hour, epochTime.tm_min, epochTime.tm_sec, (int)i);
+        }
+        uint64_t timePrintf = testTimeUs() - start + 1;
+
+        start = testTimeUs();
+        for (uint64_t i = 0; i < values; ++i) {
+            epochTime.tm_sec = i % 60;
+            sum += outputBuffer->timestampToIso8601(buffer, epochTime, i + 1);
+        }
+        uint64_t timeFixed = testTimeUs() - start + 1;
+
+        std::cout << "ISO-8601: snprintf: " << std::dec << (values * 1000000 / timePrintf) << " values/s, fixed width: " <<
+                (values * 1000000 / timeFixed) << " values/s (" << (sum & 1) << ")" << std::endl;
+    }
+
+    static void benchTimeZones(TestOutputBufferJson* outputBuffer, uint64_t values) {
+        std::vector<uint16_t> keys;
+        for (auto it : outputBuffer->timeZoneMap)
+            keys.push_back(it.first);
+        uint64_t sum = 0;
+
+        uint64_t start = testTimeUs();
+        for (uint64_t i = 0; i < values; ++i)
+            sum += (uint64_t)outputBuffer->timeZoneMap[keys[i % keys.size()]];
+        uint64_t timeMap = testTimeUs() - start + 1;
+
+        start = testTimeUs();
+        for (uint64_t i = 0; i < values; ++i)
+            sum += (uint64_t)outputBuffer->findTimeZone(keys[i % keys.size()]);
+        uint64_t timeHash = testTimeUs() - start + 1;
+
+        std::cout << "time zones: unordered_map: " << std::dec << (values * 1000000 / timeMap) << " lookups/s, perfect hash: " <<
+                (values * 1000000 / timeHash) << " lookups/s (" << (sum & 1) << ")" << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t values = BENCH_TIMESTAMP_VALUES;
+    if (argc > 1)
+        values = strtoull(argv[1], nullptr, 10);
+
+    try {
+        OpenLogReplicator::TestOutput output(NUMBER_FORMAT_TEXT);
+        OpenLogReplicator::benchDates(output.outputBuffer, values);
+        OpenLogReplicator::benchIso8601(output.outputBuffer, values);
+        OpenLogReplicator::benchTimeZones(output.outputBuffer, values);
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return TEST_PASS;
+}
@@ -0,0 +1,133 @@
+/* Benchmark of the file writer: vectored batches compared with a write per message
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <random>
+#include <sys/stat.h>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBuffer.h"
+#include "TestOutputBufferAvro.h"
+#include "WriterFile.h"
+
+#define BENCH_WRITER_FILE_MESSAGES          1000000
+#define BENCH_WRITER_FILE_RING              8192
+#define BENCH_WRITER_FILE_LENGTH_MAX        400
+#define BENCH_WRITER_FILE_QUEUE_SIZE        65536
+#define BENCH_WRITER_FILE_BATCH_BYTES       1048576
+#define BENCH_WRITER_FILE_WAIT_US           1000000000
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    //writer to a file with every writev counted, each call is one system call
+    class BenchWriterFile : public WriterFile {
+    protected:
+        virtual int64_t writeBuffers(const struct iovec* iov, uint64_t count) {
+            ++calls;
+            return WriterFile::writeBuffers(iov, count);
+        }
+
+    public:
+        uint64_t calls;
+
+        BenchWriterFile(OracleAnalyzer* oracleAnalyzer, const char* output, uint64_t batchMessages) :
+            WriterFile("bench", oracleAnalyzer, 1000, 10, BENCH_WRITER_FILE_QUEUE_SIZE, ZERO_SCN, ZERO_SEQ, "", 0, output, "", 0, 1, 1,
+                    batchMessages, BENCH_WRITER_FILE_BATCH_BYTES, BENCH_WRITER_FILE_WAIT_US),
+            calls(0) {
+        }
+
+        using WriterFile::flush;
+
+        //queued like by Writer::run
+        void send(OutputBufferMsg* msg) {
+            createMessage(msg);
+            sendMessage(msg);
+        }
+    };
+
+    //messages reused in turns, a batch is written and confirmed before its messages come again
+    struct BenchMessages {
+        std::vector<std::string> data;
+        std::vector<OutputBufferMsg> msgs;
+
+        BenchMessages(void) :
+            data(BENCH_WRITER_FILE_RING),
+            msgs(BENCH_WRITER_FILE_RING) {
+            std::mt19937_64 random(1);
+            for (uint64_t i = 0; i < BENCH_WRITER_FILE_RING; ++i) {
+                uint64_t length = 1 + random() % BENCH_WRITER_FILE_LENGTH_MAX;
+                for (uint64_t j = 0; j < length; ++j)
+                    data[i] += (char)('a' + (random() % 26));
+            }
+        }
+
+        OutputBufferMsg* get(uint64_t id) {
+            OutputBufferMsg* msg = &msgs[id % BENCH_WRITER_FILE_RING];
+            memset(msg, 0, sizeof(struct OutputBufferMsg));
+            msg->id = id;
+            msg->queueId = 0;
+            msg->length = data[id % BENCH_WRITER_FILE_RING].length();
+            msg->scn = id + 1;
+            msg->sequence = 1;
+            msg->data = (uint8_t*)&data[id % BENCH_WRITER_FILE_RING][0];
+            return msg;
+        }
+    };
+
+    //batch of 1 message is one write per message, like before the writes were vectored
+    static void benchWriter(const char* name, uint64_t batchMessages, BenchMessages& messages, uint64_t count) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        TestDirectory directory;
+        std::string fileName(directory.path + "/output.json");
+        BenchWriterFile writer(output.analyzer, fileName.c_str(), batchMessages);
+        writer.initialize();
+
+        uint64_t start = testTimeUs();
+        for (uint64_t i = 0; i < count; ++i)
+            writer.send(messages.get(i));
+        writer.flush();
+        uint64_t timeUs = testTimeUs() - start + 1;
+
+        struct stat fileStat;
+        if (stat(fileName.c_str(), &fileStat) != 0) {
+            RUNTIME_FAIL("benchmark output file missing: " << fileName);
+        }
+        std::cout << name << ": " << std::dec << (count * 1000000 / timeUs) << " messages/s, " << writer.calls << " writes, " <<
+                ((double)writer.calls / count) << " syscalls/message, " << fileStat.st_size << " bytes" << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t count = BENCH_WRITER_FILE_MESSAGES;
+    if (argc > 1)
+        count = strtoull(argv[1], nullptr, 10);
+
+    try {
+        OpenLogReplicator::BenchMessages messages;
+        OpenLogReplicator::benchWriter("per message", 1, messages, count);
+        OpenLogReplicator::benchWriter("batch 16", 16, messages, count);
+        OpenLogReplicator::benchWriter("batch 256", 256, messages, count);
+        OpenLogReplicator::benchWriter("batch 1024", 1024, messages, count);
+        OpenLogReplicator::benchWriter("batch 4096", 4096, messages, count);
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return TEST_PASS;
+}
@@ -0,0 +1,65 @@
+/* Helpers for tests and benchmarks
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <iostream>
+#include <sys/time.h>
+
+#include "types.h"
+
+#ifndef TEST_H_
+#define TEST_H_
+
+//exit codes understood by "make check"
+#define TEST_PASS                           0
+#define TEST_FAIL                           1
+#define TEST_SKIP                           77
+
+#define CHECK(__cond,__msg) \
+    do { \
+        ++testChecks; \
+        if (!(__cond)) { \
+            ++testFailures; \
+            if (testFailures <= 20) \
+                std::cerr << __FILE__ << ":" << std::dec << __LINE__ << ": failed: " << #__cond << " - " << __msg << std::endl; \
+        } \
+    } while (0)
+
+namespace OpenLogReplicator {
+    extern uint64_t testChecks;
+    extern uint64_t testFailures;
+
+    static inline uint64_t testTimeUs(void) {
+        struct timeval tv;
+        gettimeofday(&tv, nullptr);
+        return (1000000 * tv.tv_sec) + tv.tv_usec;
+    }
+
+    static inline int testResult(const char* name) {
+        std::cout << name << ": " << std::dec << testChecks << " checks, " << testFailures << " failed" << std::endl;
+        return testFailures == 0 ? TEST_PASS : TEST_FAIL;
+    }
+}
+
+#define TEST_GLOBALS \
+    namespace OpenLogReplicator { \
+        uint64_t testChecks = 0; \
+        uint64_t testFailures = 0; \
+    }
+
+#endif
@@ -0,0 +1,101 @@
+/* Test of output buffer appends across chunk boundaries
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <random>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBuffer.h"
+
+#define TEST_APPEND_MESSAGES                20
+#define TEST_APPEND_PIECE_MAX               5000
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    //every append flavor mixed, messages up to 3 chunks long
+    static void testAppend(void) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        TestOutputBufferJson* outputBuffer = output.outputBuffer;
+        std::mt19937_64 random(1);
+
+        for (uint64_t message = 0; message < TEST_APPEND_MESSAGES; ++message) {
+            std::string expected;
+            uint64_t size = random() % (3 * OUTPUT_BUFFER_DATA_SIZE);
+            outputBuffer->outputBufferBegin(0);
+
+            while (expected.length() < size) {
+                std::string piece;
+                uint64_t length = random() % TEST_APPEND_PIECE_MAX;
+                //exactly up to the end of the chunk
+                if (random() % 8 == 0)
+                    length = OUTPUT_BUFFER_DATA_SIZE - outputBuffer->lastBuffer->length;
+                for (uint64_t i = 0; i < length; ++i)
+                    piece += (char)('a' + (random() % 26));
+
+                switch (random() % 5) {
+                case 0:
+                    for (char character : piece)
+                        outputBuffer->outputBufferAppend(character);
+                    break;
+
+                case 1:
+                    outputBuffer->outputBufferAppend(piece.c_str(), piece.length());
+                    break;
+
+                case 2:
+                    outputBuffer->outputBufferAppend(piece);
+                    break;
+
+                case 3:
+                    outputBuffer->outputBufferAppend(piece.c_str());
+                    break;
+
+                case 4: {
+                    uint8_t* data = outputBuffer->outputBufferReserve(piece.length());
+                    if (data == nullptr) {
+                        CHECK(outputBuffer->lastBuffer->length + piece.length() > OUTPUT_BUFFER_DATA_SIZE, "reserve refused with space left");
+                        outputBuffer->outputBufferAppend(piece);
+                    } else {
+                        memcpy(data, piece.c_str(), piece.length());
+                        outputBuffer->outputBufferReserveCommit(piece.length());
+                    }
+                    break;
+                }
+                }
+                expected += piece;
+
+                CHECK(outputBuffer->lastBuffer->length < OUTPUT_BUFFER_DATA_SIZE, "chunk not rotated at: " << std::dec << outputBuffer->lastBuffer->length);
+            }
+
+            CHECK(outputBuffer->length() == expected.length(), "message length: " << std::dec << outputBuffer->length() << ", expected: " << expected.length());
+            CHECK(outputBuffer->message() == expected, "message #" << std::dec << message << " content differs");
+            outputBuffer->discard();
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        OpenLogReplicator::testAppend();
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return OpenLogReplicator::testResult("TestAppend");
+}
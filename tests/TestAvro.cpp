@@ -0,0 +1,445 @@
+/* Test of Avro encoding against the schema registry
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <rapidjson/document.h>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestNumberEncoder.h"
+#include "TestOutputBufferAvro.h"
+
+#define TEST_AVRO_SCN                       100
+#define TEST_AVRO_TIME                      1000
+#define TEST_AVRO_XID                       0x0001000200000003
+#define TEST_AVRO_BDBA                      0x01000010
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    //schemas read back from the registry, decoding follows only the .avsc
+    class TestRegistry {
+    protected:
+        std::string path;
+        std::map<uint64_t, rapidjson::Document*> documents;
+        std::map<std::string, const rapidjson::Value*> named;
+
+        void addNames(const rapidjson::Value& type) {
+            if (type.IsArray()) {
+                for (rapidjson::SizeType i = 0; i < type.Size(); ++i)
+                    addNames(type[i]);
+                return;
+            }
+            if (!type.IsObject())
+                return;
+            if (type.HasMember("name"))
+                named[type["name"].GetString()] = &type;
+            if (type.HasMember("fields")) {
+                const rapidjson::Value& fields = type["fields"];
+                for (rapidjson::SizeType i = 0; i < fields.Size(); ++i)
+                    addNames(fields[i]["type"]);
+            }
+            if (type.HasMember("values"))
+                addNames(type["values"]);
+            if (type.HasMember("items"))
+                addNames(type["items"]);
+        }
+
+        int64_t readLong(const uint8_t*& pos, const uint8_t* end) {
+            uint64_t value = 0;
+            for (uint64_t shift = 0; shift < 64; shift += 7) {
+                if (pos >= end) {
+                    RUNTIME_FAIL("Avro message truncated");
+                }
+                uint8_t byte = *pos++;
+                value |= (uint64_t)(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+            }
+            RUNTIME_FAIL("Avro long longer than 10 bytes");
+        }
+
+        std::string readBytes(const uint8_t*& pos, const uint8_t* end, uint64_t length) {
+            if ((uint64_t)(end - pos) < length) {
+                RUNTIME_FAIL("Avro message truncated");
+            }
+            std::string str((const char*)pos, length);
+            pos += length;
+            return str;
+        }
+
+    public:
+        TestRegistry(const std::string& path) :
+            path(path) {
+        }
+
+        ~TestRegistry() {
+            for (auto it : documents)
+                delete it.second;
+        }
+
+        const rapidjson::Value& schema(uint64_t fingerprint) {
+            std::map<uint64_t, rapidjson::Document*>::iterator it = documents.find(fingerprint);
+            if (it != documents.end())
+                return *it->second;
+
+            std::string fileName(path + "/" + OutputBufferAvro::fingerprintName(fingerprint) + ".avsc");
+            std::ifstream inputStream(fileName.c_str(), std::ios::in);
+            if (!inputStream.is_open()) {
+                RUNTIME_FAIL("schema not in registry: " << fileName);
+            }
+            std::string schemaJSON((std::istreambuf_iterator<char>(inputStream)), std::istreambuf_iterator<char>());
+            rapidjson::Document* document = new rapidjson::Document();
+            documents[fingerprint] = document;
+            if (document->Parse(schemaJSON.c_str()).HasParseError()) {
+                RUNTIME_FAIL("schema can't be parsed: " << fileName);
+            }
+            addNames(*document);
+            return *document;
+        }
+
+        //parsing canonical form: full names, only the attributes below in this order, primitives as strings
+        std::string canonical(const rapidjson::Value& type) {
+            if (type.IsString())
+                return "\"" + std::string(type.GetString()) + "\"";
+
+            std::string str;
+            if (type.IsArray()) {
+                str = "[";
+                for (rapidjson::SizeType i = 0; i < type.Size(); ++i) {
+                    if (i > 0)
+                        str += ",";
+                    str += canonical(type[i]);
+                }
+                return str + "]";
+            }
+
+            std::string typeName(type["type"].IsString() ? type["type"].GetString() : "");
+            if (typeName != "record" && typeName != "enum" && typeName != "map" && typeName != "array" && typeName != "fixed")
+                return canonical(type["type"]);
+
+            str = "{";
+            for (const char* key : {"name", "type", "fields", "symbols", "items", "values", "size"}) {
+                if (!type.HasMember(key))
+                    continue;
+                if (str.length() > 1)
+                    str += ",";
+                str += "\"" + std::string(key) + "\":";
+                const rapidjson::Value& value = type[key];
+                if (strcmp(key, "fields") == 0) {
+                    str += "[";
+                    for (rapidjson::SizeType i = 0; i < value.Size(); ++i) {
+                        if (i > 0)
+                            str += ",";
+                        str += "{\"name\":" + canonical(value[i]["name"]) + ",\"type\":" + canonical(value[i]["type"]) + "}";
+                    }
+                    str += "]";
+                } else if (strcmp(key, "size") == 0)
+                    str += std::to_string(value.GetUint64());
+                else
+                    str += canonical(value);
+            }
+            return str + "}";
+        }
+
+        //value as text: records and maps in braces, strings quoted, bytes in hex, null for the null branch
+        std::string decode(const rapidjson::Value& type, const uint8_t*& pos, const uint8_t* end) {
+            if (type.IsArray()) {
+                int64_t branch = readLong(pos, end);
+                if (branch < 0 || branch >= (int64_t)type.Size()) {
+                    RUNTIME_FAIL("union branch out of range: " << std::dec << branch);
+                }
+                return decode(type[(rapidjson::SizeType)branch], pos, end);
+            }
+
+            std::string typeName(type.IsString() ? type.GetString() : type["type"].GetString());
+
+            std::string str;
+            if (typeName == "null")
+                return "null";
+            if (typeName == "boolean") {
+                std::string value = readBytes(pos, end, 1);
+                if (value[0] != 0 && value[0] != 1) {
+                    RUNTIME_FAIL("boolean not 0 or 1: " << std::dec << (uint64_t)value[0]);
+                }
+                return value[0] != 0 ? "true" : "false";
+            }
+            if (typeName == "long" || typeName == "int")
+                return std::to_string(readLong(pos, end));
+            if (typeName == "float") {
+                float value;
+                memcpy(&value, readBytes(pos, end, 4).c_str(), 4);
+                return std::to_string(value);
+            }
+            if (typeName == "double") {
+                double value;
+                memcpy(&value, readBytes(pos, end, 8).c_str(), 8);
+                return std::to_string(value);
+            }
+            if (typeName == "string")
+                return "\"" + readBytes(pos, end, readLong(pos, end)) + "\"";
+            if (typeName == "bytes") {
+                std::string value = readBytes(pos, end, readLong(pos, end));
+                str = "0x";
+                for (uint64_t i = 0; i < value.length(); ++i) {
+                    str += "0123456789abcdef"[(uint8_t)value[i] >> 4];
+                    str += "0123456789abcdef"[value[i] & 0xF];
+                }
+                return str;
+            }
+            if (typeName == "enum") {
+                int64_t symbol = readLong(pos, end);
+                const rapidjson::Value& symbols = type["symbols"];
+                if (symbol < 0 || symbol >= (int64_t)symbols.Size()) {
+                    RUNTIME_FAIL("enum symbol out of range: " << std::dec << symbol);
+                }
+                return symbols[(rapidjson::SizeType)symbol].GetString();
+            }
+            if (typeName == "record") {
+                const rapidjson::Value& fields = type["fields"];
+                str = "{";
+                for (rapidjson::SizeType i = 0; i < fields.Size(); ++i) {
+                    if (i > 0)
+                        str += ",";
+                    str += std::string(fields[i]["name"].GetString()) + ":" + decode(fields[i]["type"], pos, end);
+                }
+                return str + "}";
+            }
+            if (typeName == "map") {
+                str = "{";
+                int64_t count;
+                bool first = true;
+                while ((count = readLong(pos, end)) != 0) {
+                    //negative count is followed by the block size
+                    if (count < 0) {
+                        count = -count;
+                        readLong(pos, end);
+                    }
+                    for (int64_t i = 0; i < count; ++i) {
+                        if (!first)
+                            str += ",";
+                        first = false;
+                        std::string key = readBytes(pos, end, readLong(pos, end));
+                        str += key + ":" + decode(type["values"], pos, end);
+                    }
+                }
+                return str + "}";
+            }
+
+            std::map<std::string, const rapidjson::Value*>::iterator it = named.find(typeName);
+            if (it == named.end()) {
+                RUNTIME_FAIL("unknown type: " << typeName);
+            }
+            return decode(*it->second, pos, end);
+        }
+
+        //single object encoding: marker, fingerprint, record; the whole message must be used
+        std::string decodeMessage(const std::string& message, uint64_t& fingerprint) {
+            if (message.length() < 10 || (uint8_t)message[0] != 0xC3 || (uint8_t)message[1] != 0x01) {
+                RUNTIME_FAIL("message not in single object encoding");
+            }
+            fingerprint = 0;
+            for (uint64_t i = 0; i < 8; ++i)
+                fingerprint |= (uint64_t)(uint8_t)message[2 + i] << (i * 8);
+
+            const uint8_t* pos = (const uint8_t*)message.c_str() + 10;
+            const uint8_t* end = (const uint8_t*)message.c_str() + message.length();
+            std::string str = decode(schema(fingerprint), pos, end);
+            if (pos != end) {
+                RUNTIME_FAIL("trailing bytes after record: " << std::dec << (end - pos));
+            }
+            return str;
+        }
+    };
+
+    //CRC-64-AVRO of primitive schemas, the fingerprints from the Avro specification test suite
+    static void testFingerprint(void) {
+        std::vector<std::pair<std::string, int64_t>> vectors = {
+            {"\"null\"", 7195948357588979594},
+            {"\"boolean\"", -6970731678124411036},
+            {"\"int\"", 8247732601305521295},
+            {"\"long\"", -3434872931120570953},
+            {"\"float\"", 5583340709985441680},
+            {"\"double\"", -8181574048448539266},
+            {"\"bytes\"", 5746618253357095269},
+            {"\"string\"", -8142146995180207161}
+        };
+        for (std::pair<std::string, int64_t>& vector : vectors) {
+            int64_t fingerprint = (int64_t)TestOutputBufferAvro::fingerprint(vector.first);
+            CHECK(fingerprint == vector.second, "fingerprint of " << vector.first << ": " << std::dec << fingerprint << ", expected: " <<
+                    vector.second);
+        }
+
+        std::string empty;
+        CHECK(TestOutputBufferAvro::fingerprint(empty) == 0xC15D213AA4D7A795, "fingerprint of empty schema: " << std::hex <<
+                TestOutputBufferAvro::fingerprint(empty));
+    }
+
+    //zig-zag varint from the Avro specification: 0, -1, 1, -2, 2 are 00 01 02 03 04
+    static void testZigZag(void) {
+        TestOutputAvro avro;
+        TestOutputBufferAvro* outputBuffer = avro.outputBuffer;
+        std::vector<std::pair<int64_t, std::string>> vectors = {
+            {0, std::string("\x00", 1)},
+            {-1, "\x01"},
+            {1, "\x02"},
+            {-2, "\x03"},
+            {2, "\x04"},
+            {-64, "\x7F"},
+            {64, "\x80\x01"},
+            {-65, "\x81\x01"},
+            {8191, "\xFE\x7F"},
+            {8192, "\x80\x80\x01"},
+            {INT32_MAX, "\xFE\xFF\xFF\xFF\x0F"},
+            {INT32_MIN, "\xFF\xFF\xFF\xFF\x0F"},
+            {INT64_MAX, "\xFE\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x01"},
+            {INT64_MIN, "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x01"}
+        };
+
+        for (std::pair<int64_t, std::string>& vector : vectors) {
+            outputBuffer->outputBufferBegin(0);
+            outputBuffer->appendLong(vector.first);
+            outputBuffer->outputBufferCommit(false);
+            std::string str((const char*)outputBuffer->messages().back()->data, outputBuffer->messages().back()->length);
+            CHECK(str == vector.second, "zig-zag of " << std::dec << vector.first << ": " << str.length() << " bytes, expected: " <<
+                    vector.second.length());
+        }
+    }
+
+    //registry keeps logical types, the fingerprint is of the parsing canonical form
+    static void testCanonical(void) {
+        TestOutputAvro avro;
+        TestOutputBufferAvro* outputBuffer = avro.outputBuffer;
+        TestRegistry registry(avro.registry.path);
+        OracleObject* object = testAvroObject();
+
+        outputBuffer->processBegin(TEST_AVRO_SCN, TEST_AVRO_TIME, 0, TEST_AVRO_XID);
+        std::string value("1");
+        outputBuffer->set(VALUE_AFTER, 3, value);
+        outputBuffer->insert(object, TEST_AVRO_BDBA, 0);
+        outputBuffer->processCommit();
+
+        std::string canonical;
+        outputBuffer->buildRecord(canonical, object, true);
+        CHECK(registry.canonical(registry.schema(object->avroFingerprint)) == canonical, "canonical form of registry schema differs: " <<
+                registry.canonical(registry.schema(object->avroFingerprint)));
+        CHECK(TestOutputBufferAvro::fingerprint(canonical) == object->avroFingerprint, "table schema fingerprint");
+        CHECK(canonical.find("logicalType") == std::string::npos, "logical type in canonical form");
+        CHECK(object->avroSchema.find("\"logicalType\":\"timestamp-micros\"") != std::string::npos, "no logical type in registry");
+
+        for (std::string* schema : {&outputBuffer->controlSchema, &outputBuffer->unknownSchema}) {
+            uint64_t fingerprint = TestOutputBufferAvro::fingerprint(*schema);
+            CHECK(registry.canonical(registry.schema(fingerprint)) == *schema, "control schema not in canonical form: " << *schema);
+        }
+        delete object;
+    }
+
+    static std::string numberBytes(bool negative, const char* integer, const char* fraction) {
+        std::vector<uint8_t> bytes = encodeNumber(negative, integer, fraction);
+        return std::string(bytes.begin(), bytes.end());
+    }
+
+    static std::string rowId(typeDATAOBJ dataObj, typeSLOT slot) {
+        char str[19];
+        RowId(dataObj, TEST_AVRO_BDBA, slot).toString(str);
+        return std::string(str, 18);
+    }
+
+    //rows encoded by the buffer and decoded with the schema found by the fingerprint of each message
+    static void testLayout(void) {
+        TestOutputAvro avro;
+        TestOutputBufferAvro* outputBuffer = avro.outputBuffer;
+        TestRegistry registry(avro.registry.path);
+        OracleObject* object = testAvroObject();
+
+        //2022-10-19 12:34:56
+        std::string n1 = numberBytes(false, "1", ""), n2 = numberBytes(true, "7", "5");
+        std::string v1("abc"), null;
+        std::string d1("\x78\x7A\x0A\x13\x0D\x23\x39", 7);
+        std::string r1("\x01\x00\xFF", 3);
+        float f = 1.5;
+        double b = -2.25;
+        std::string f1((const char*)&f, 4), b1((const char*)&b, 8);
+
+        outputBuffer->processBegin(TEST_AVRO_SCN, TEST_AVRO_TIME, 0, TEST_AVRO_XID);
+        outputBuffer->set(VALUE_AFTER, 0, n1);
+        outputBuffer->set(VALUE_AFTER, 1, v1);
+        outputBuffer->set(VALUE_AFTER, 2, d1);
+        outputBuffer->set(VALUE_AFTER, 3, r1);
+        outputBuffer->set(VALUE_AFTER, 4, f1);
+        outputBuffer->set(VALUE_AFTER, 5, b1);
+        outputBuffer->insert(object, TEST_AVRO_BDBA, 0);
+        outputBuffer->set(VALUE_BEFORE, 0, n1);
+        outputBuffer->set(VALUE_BEFORE, 1, v1);
+        outputBuffer->set(VALUE_AFTER, 0, n2);
+        outputBuffer->set(VALUE_AFTER, 1, null);
+        outputBuffer->update(object, TEST_AVRO_BDBA, 0);
+        outputBuffer->set(VALUE_BEFORE, 0, n2);
+        outputBuffer->remove(object, TEST_AVRO_BDBA, 0);
+        //table without dictionary information
+        outputBuffer->set(VALUE_AFTER, 0, r1);
+        outputBuffer->set(VALUE_AFTER, 2, null);
+        outputBuffer->insert(nullptr, TEST_AVRO_BDBA, 1);
+        //rollback to savepoint of a row sent earlier
+        outputBuffer->undo(object, TEST_AVRO_BDBA, 0);
+        outputBuffer->processCommit();
+
+        typeTIME tm(TEST_AVRO_TIME);
+        std::string header("scn:100,tm:" + std::to_string((int64_t)tm.toTime() * 1000) + ",xid:" + std::to_string(TEST_AVRO_XID) +
+                ",provisional:false,");
+        std::string row("dataobj:2,rid:\"" + rowId(2, 0) + "\",");
+        //columns not present in redo are the empty absent record, told apart from null
+        std::vector<std::pair<uint64_t, std::string>> expected = {
+            {outputBuffer->controlFingerprint, "{" + header + "op:begin,dataobj:0,sql:null,seq:0,offset:0,redo:false}"},
+            {object->avroFingerprint, "{" + header + "op:c,num:0," + row + "before:null,after:{N:\"1\",V:\"abc\",D:" +
+                    std::to_string((int64_t)1666182896 * 1000000) + ",R:0x0100ff,F:" + std::to_string(f) + ",B:" + std::to_string(b) + "}}"},
+            {object->avroFingerprint, "{" + header + "op:u,num:1," + row +
+                    "before:{N:\"1\",V:\"abc\",D:{},R:{},F:{},B:{}},after:{N:\"-7.5\",V:null,D:{},R:{},F:{},B:{}}}"},
+            {object->avroFingerprint, "{" + header + "op:d,num:2," + row + "before:{N:\"-7.5\",V:{},D:{},R:{},F:{},B:{}},after:null}"},
+            {outputBuffer->unknownFingerprint, "{" + header + "op:c,num:3,dataobj:0,rid:\"" + rowId(0, 1) +
+                    "\",before:null,after:{COL_0:0x0100ff,COL_2:null}}"},
+            {object->avroFingerprint, "{" + header + "op:undo,num:4," + row + "before:null,after:null}"},
+            {outputBuffer->controlFingerprint, "{" + header + "op:commit,dataobj:0,sql:null,seq:0,offset:0,redo:false}"}
+        };
+
+        std::vector<OutputBufferMsg*> msgs = outputBuffer->messages();
+        CHECK(msgs.size() == expected.size(), "messages: " << std::dec << msgs.size() << ", expected: " << expected.size());
+        for (uint64_t i = 0; i < msgs.size() && i < expected.size(); ++i) {
+            uint64_t fingerprint = 0;
+            std::string str = registry.decodeMessage(std::string((const char*)msgs[i]->data, msgs[i]->length), fingerprint);
+            CHECK(fingerprint == expected[i].first, "message #" << std::dec << i << " fingerprint: " << std::hex << fingerprint);
+            CHECK(str == expected[i].second, "message #" << std::dec << i << ": " << str << ", expected: " << expected[i].second);
+        }
+        delete object;
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        OpenLogReplicator::testFingerprint();
+        OpenLogReplicator::testZigZag();
+        OpenLogReplicator::testCanonical();
+        OpenLogReplicator::testLayout();
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return OpenLogReplicator::testResult("TestAvro");
+}
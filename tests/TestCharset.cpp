@@ -0,0 +1,468 @@
+/* Test of character set conversion to UTF-8
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <iconv.h>
+#include <random>
+
+#include "CharacterSet7bit.h"
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBuffer.h"
+
+#define TEST_CHARSET_RANDOM                 100000
+#define TEST_CHARSET_LENGTH_MAX             300
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    static uint64_t referenceAsciiLength(const uint8_t* data, uint64_t length) {
+        for (uint64_t i = 0; i < length; ++i)
+            if (data[i] > 0x7F)
+                return i;
+        return length;
+    }
+
+    static void referenceAppend(std::string& str, typeunicode character) {
+        if (character <= 0x7F) {
+            str += (char)character;
+        } else if (character <= 0x7FF) {
+            str += (char)(0xC0 | (character >> 6));
+            str += (char)(0x80 | (character & 0x3F));
+        } else if (character <= 0xFFFF) {
+            str += (char)(0xE0 | (character >> 12));
+            str += (char)(0x80 | ((character >> 6) & 0x3F));
+            str += (char)(0x80 | (character & 0x3F));
+        } else {
+            str += (char)(0xF0 | (character >> 18));
+            str += (char)(0x80 | ((character >> 12) & 0x3F));
+            str += (char)(0x80 | ((character >> 6) & 0x3F));
+            str += (char)(0x80 | (character & 0x3F));
+        }
+    }
+
+    //one character at a time through decode, like parseString before whole-string transcoding
+    static std::string referenceUtf8(const CharacterSet* characterSet, const uint8_t* data, uint64_t length) {
+        std::string str;
+        while (length > 0)
+            referenceAppend(str, characterSet->decode(data, length));
+        return str;
+    }
+
+    //mostly 7-bit text with runs of random bytes above 0x7F
+    static std::string randomText(std::mt19937_64& random, uint64_t length) {
+        std::string str;
+        uint64_t rate = 1 + random() % 64;
+        for (uint64_t i = 0; i < length; ++i) {
+            if (random() % rate == 0)
+                str += (char)(0x80 + random() % 0x80);
+            else
+                str += (char)(random() % 0x80);
+        }
+        return str;
+    }
+
+    static void testAsciiLength(void) {
+        std::mt19937_64 random(1);
+        for (uint64_t i = 0; i < TEST_CHARSET_RANDOM; ++i) {
+            std::string str = randomText(random, random() % TEST_CHARSET_LENGTH_MAX);
+            //unaligned start
+            uint64_t offset = (str.length() > 0) ? random() % 16 % (str.length() + 1) : 0;
+            const uint8_t* data = (const uint8_t*)str.c_str() + offset;
+            uint64_t expected = referenceAsciiLength(data, str.length() - offset);
+            uint64_t scan = CharacterSet::asciiLength(data, str.length() - offset);
+            CHECK(scan == expected, "length: " << std::dec << str.length() - offset << ", scan: " << scan << ", expected: " << expected);
+        }
+
+        //every byte value at every position of a 64 byte block, at every length
+        for (uint64_t character = 0; character < 256; ++character) {
+            for (uint64_t pos = 0; pos < 64; ++pos) {
+                uint8_t block[64];
+                memset(block, 'a', sizeof(block));
+                block[pos] = character;
+                for (uint64_t length = pos; length <= 64; ++length) {
+                    uint64_t expected = (character > 0x7F && pos < length) ? pos : length;
+                    uint64_t scan = CharacterSet::asciiLength(block, length);
+                    CHECK(scan == expected, "byte: " << std::dec << character << " at: " << pos << ", length: " << length << ", scan: " << scan);
+                }
+            }
+        }
+    }
+
+    //7-bit and 8-bit tables: every byte alone, then ASCII runs of every length between other bytes
+    static void testSingleByte(void) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        std::mt19937_64 random(3);
+        uint8_t buffer[TEST_CHARSET_LENGTH_MAX * 3 + 1];
+
+        for (auto it : output.outputBuffer->characterMap) {
+            CharacterSet* characterSet = it.second;
+            if (dynamic_cast<CharacterSet7bit*>(characterSet) == nullptr)
+                continue;
+
+            for (uint64_t character = 0; character < 256; ++character) {
+                uint8_t byte1 = character;
+                uint64_t length = characterSet->transcodeToUtf8(&byte1, 1, buffer);
+                CHECK(std::string((const char*)buffer, length) == referenceUtf8(characterSet, &byte1, 1), "character set: " << characterSet->name <<
+                        ", byte: " << std::dec << character);
+            }
+
+            for (uint64_t run = 0; run <= 40; ++run) {
+                std::string str;
+                while (str.length() + run + 1 <= TEST_CHARSET_LENGTH_MAX) {
+                    for (uint64_t i = 0; i < run; ++i)
+                        str += (char)(random() % 0x80);
+                    str += (char)(0x80 + random() % 0x80);
+                }
+                const uint8_t* data = (const uint8_t*)str.c_str();
+                std::string expected = referenceUtf8(characterSet, data, str.length());
+                //guard byte past the 3 bytes per input byte of room must not be overwritten
+                buffer[str.length() * 3] = 0xAA;
+                uint64_t length = characterSet->transcodeToUtf8(data, str.length(), buffer);
+                CHECK(std::string((const char*)buffer, length) == expected, "character set: " << characterSet->name << ", run: " << std::dec << run);
+                CHECK(buffer[str.length() * 3] == 0xAA, "character set: " << characterSet->name << ", written past the end, run: " << std::dec << run);
+            }
+        }
+    }
+
+    static std::string hexString(const std::string& str) {
+        std::stringstream hex;
+        for (uint64_t i = 0; i < str.length(); ++i)
+            hex << std::setfill('0') << std::setw(2) << std::hex << (uint64_t)(uint8_t)str[i];
+        return hex.str();
+    }
+
+    static void checkTranscode(const CharacterSet* characterSet, const std::string& str, const std::string& expected) {
+        uint8_t buffer[TEST_CHARSET_LENGTH_MAX * 3 + 1];
+        buffer[str.length() * 3] = 0xAA;
+        uint64_t length = characterSet->transcodeToUtf8((const uint8_t*)str.c_str(), str.length(), buffer);
+        CHECK(std::string((const char*)buffer, length) == expected && buffer[str.length() * 3] == 0xAA, "character set: " << characterSet->name <<
+                ", input: " << hexString(str));
+    }
+
+    static void checkTranscode(const CharacterSet* characterSet, const std::string& str) {
+        checkTranscode(characterSet, str, referenceUtf8(characterSet, (const uint8_t*)str.c_str(), str.length()));
+    }
+
+    //valid characters of every length, CESU-8 surrogate pairs and invalid bytes, mixed with ASCII runs
+    static std::string randomUtf8(std::mt19937_64& random, uint64_t length) {
+        std::string str;
+        while (str.length() + 6 <= length) {
+            uint64_t kind = random() % 8;
+            typeunicode character;
+            if (kind == 0) {
+                for (uint64_t i = random() % 40; i > 0 && str.length() < length; --i)
+                    str += (char)(random() % 0x80);
+                continue;
+            } else if (kind == 1) {
+                str += (char)(0x80 + random() % 0x80);
+                continue;
+            } else if (kind == 2) {
+                //CESU-8 pair, valid only in UTF8
+                typeunicode high = 0xD800 + random() % 0x400;
+                typeunicode low = 0xDC00 + random() % 0x400;
+                referenceAppend(str, high);
+                referenceAppend(str, low);
+                continue;
+            } else if (kind == 3)
+                character = 0x80 + random() % 0x780;
+            else if (kind == 4 || kind == 5)
+                character = 0x800 + random() % 0xF800;
+            else if (kind == 6)
+                character = 0x10000 + random() % 0x100000;
+            else
+                character = random() % 0x80;
+            referenceAppend(str, character);
+        }
+        return str;
+    }
+
+    //UTF-8 sources: validated prefix is copied, the rest must match per-character decode
+    static void testUtf8(void) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        std::mt19937_64 random(4);
+        const uint64_t ids[] = {871, 873};
+
+        for (uint64_t id : ids) {
+            const CharacterSet* characterSet = output.outputBuffer->characterMap[id];
+
+            for (uint64_t i = 0; i < TEST_CHARSET_RANDOM / 10; ++i)
+                checkTranscode(characterSet, randomUtf8(random, random() % TEST_CHARSET_LENGTH_MAX));
+
+            //every 1..3 byte sequence after an ASCII block, so the vector scan runs first
+            for (uint64_t byte1 = 0x80; byte1 < 0x100; ++byte1) {
+                for (uint64_t byte2 = 0; byte2 < 0x100; ++byte2) {
+                    std::string str(33, 'a');
+                    str += (char)byte1;
+                    str += (char)byte2;
+                    checkTranscode(characterSet, str);
+                    for (uint64_t byte3 = 0; byte3 < 0x100; byte3 += (byte2 >= 0x80 && byte2 < 0xC0) ? 1 : 0x3F) {
+                        std::string str3 = str;
+                        str3 += (char)byte3;
+                        str3 += "bc";
+                        checkTranscode(characterSet, str3);
+                    }
+                }
+            }
+
+            //4 byte sequences with boundary continuation bytes
+            const uint8_t continuation[] = {0x00, 0x41, 0x7F, 0x80, 0x8F, 0x90, 0xBF, 0xC0, 0xFF};
+            for (uint64_t byte1 = 0xF0; byte1 < 0x100; ++byte1)
+                for (uint64_t byte2 = 0; byte2 < 0x100; ++byte2)
+                    for (uint8_t byte3 : continuation)
+                        for (uint8_t byte4 : continuation) {
+                            std::string str("x");
+                            str += (char)byte1;
+                            str += (char)byte2;
+                            str += (char)byte3;
+                            str += (char)byte4;
+                            checkTranscode(characterSet, str);
+                        }
+        }
+    }
+
+    static void appendUnit(std::string& str, typeunicode unit) {
+        str += (char)(unit >> 8);
+        str += (char)(unit & 0xFF);
+    }
+
+    //AL16UTF16: whole BMP and every surrogate pair against per-character decode
+    static void testUtf16(void) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        const CharacterSet* characterSet = output.outputBuffer->characterMap[2000];
+        std::mt19937_64 random(5);
+
+        //every code unit alone and after an ASCII run of every length around the vector block sizes
+        for (typeunicode unit = 0; unit <= 0xFFFF; ++unit) {
+            std::string str;
+            appendUnit(str, unit);
+            checkTranscode(characterSet, str);
+
+            str.clear();
+            for (uint64_t i = unit % 67; i > 0; --i)
+                appendUnit(str, 0x20 + random() % 0x5F);
+            appendUnit(str, unit);
+            appendUnit(str, 'z');
+            checkTranscode(characterSet, str);
+        }
+
+        //every surrogate pair
+        for (typeunicode high = 0xD800; high <= 0xDBFF; ++high)
+            for (typeunicode low = 0xDC00; low <= 0xDFFF; ++low) {
+                std::string str;
+                appendUnit(str, 'a');
+                appendUnit(str, high);
+                appendUnit(str, low);
+                checkTranscode(characterSet, str);
+            }
+
+        //unpaired surrogates, odd trailing byte and units which are not ASCII in only one of the two bytes
+        const typeunicode special[] = {0x0080, 0x00FF, 0x0100, 0x017F, 0x7F00, 0xD800, 0xDBFF, 0xDC00, 0xDFFF, 0xFFFF};
+        for (uint64_t i = 0; i < TEST_CHARSET_RANDOM / 10; ++i) {
+            std::string str;
+            uint64_t length = random() % (TEST_CHARSET_LENGTH_MAX / 2);
+            while (str.length() + 2 <= length) {
+                if (random() % 8 == 0)
+                    appendUnit(str, special[random() % (sizeof(special) / sizeof(typeunicode))]);
+                else
+                    appendUnit(str, random() % 0x80);
+            }
+            if (random() % 4 == 0)
+                str += (char)(random() % 0x100);
+            checkTranscode(characterSet, str);
+        }
+    }
+
+    //whole string through iconv, false when some character can't be converted
+    static bool iconvString(iconv_t cd, const std::string& str, std::string& out) {
+        char buffer[TEST_CHARSET_LENGTH_MAX * 4];
+        char* in = (char*)str.c_str();
+        size_t inLength = str.length();
+        char* outPtr = buffer;
+        size_t outLength = sizeof(buffer);
+        iconv(cd, nullptr, nullptr, nullptr, nullptr);
+        if (iconv(cd, &in, &inLength, &outPtr, &outLength) == (size_t)-1)
+            return false;
+        out.assign(buffer, outPtr - buffer);
+        return true;
+    }
+
+    //single-byte sets whose Oracle tables agree with iconv on every byte iconv defines
+    static void testConformance(void) {
+        static const char* conformance[][2] = {
+            {"US7ASCII", "ASCII"}, {"WE8ISO8859P1", "ISO-8859-1"}, {"EE8ISO8859P2", "ISO-8859-2"}, {"SE8ISO8859P3", "ISO-8859-3"},
+            {"CL8ISO8859P5", "ISO-8859-5"}, {"AR8ISO8859P6", "ISO-8859-6"}, {"IW8ISO8859P8", "ISO-8859-8"}, {"WE8ISO8859P9", "ISO-8859-9"},
+            {"TH8TISASCII", "TIS-620"}, {"WE8ISO8859P15", "ISO-8859-15"}, {"BLT8ISO8859P13", "ISO-8859-13"}, {"CEL8ISO8859P14", "ISO-8859-14"},
+            {"CL8ISOIR111", "ISO-IR-111"}, {"CL8KOI8U", "KOI8-U"}, {"WE8PC850", "CP850"}, {"WE8PC858", "CP858"}, {"EE8PC852", "CP852"},
+            {"RU8PC866", "CP866"}, {"TR8PC857", "CP857"}, {"EE8MSWIN1250", "CP1250"}, {"CL8MSWIN1251", "CP1251"}, {"WE8MSWIN1252", "CP1252"},
+            {"EL8MSWIN1253", "CP1253"}, {"TR8MSWIN1254", "CP1254"}, {"AR8MSWIN1256", "CP1256"}, {"BLT8MSWIN1257", "CP1257"}
+        };
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        std::mt19937_64 random(6);
+        uint64_t skipped = 0;
+
+        for (auto names : conformance) {
+            const CharacterSet* characterSet = nullptr;
+            for (auto it : output.outputBuffer->characterMap)
+                if (strcmp(it.second->name, names[0]) == 0)
+                    characterSet = it.second;
+            CHECK(characterSet != nullptr, "character set not registered: " << names[0]);
+            if (characterSet == nullptr)
+                continue;
+
+            //reference tables come from iconv on the build machine, sets it doesn't know are skipped
+            iconv_t toUtf8 = iconv_open("UTF-8", names[1]);
+            iconv_t fromUtf8 = iconv_open(names[1], "UTF-8");
+            if (toUtf8 == (iconv_t)-1 || fromUtf8 == (iconv_t)-1) {
+                if (toUtf8 != (iconv_t)-1)
+                    iconv_close(toUtf8);
+                if (fromUtf8 != (iconv_t)-1)
+                    iconv_close(fromUtf8);
+                ++skipped;
+                continue;
+            }
+
+            //every defined byte, and back to the same byte from our UTF-8
+            std::string defined;
+            std::string definedAscii;
+            for (uint64_t character = 0; character < 256; ++character) {
+                std::string str(1, (char)character);
+                std::string expected;
+                if (!iconvString(toUtf8, str, expected))
+                    continue;
+                defined += str;
+                if (character <= 0x7F)
+                    definedAscii += str;
+                checkTranscode(characterSet, str, expected);
+
+                uint8_t buffer[4];
+                uint64_t length = characterSet->transcodeToUtf8((const uint8_t*)str.c_str(), 1, buffer);
+                std::string back;
+                CHECK(iconvString(fromUtf8, std::string((const char*)buffer, length), back) && back == str, "character set: " << names[0] <<
+                        ", no round trip for byte: " << std::dec << character);
+            }
+
+            //whole strings with ASCII runs, converted by iconv in one call
+            for (uint64_t i = 0; i < TEST_CHARSET_RANDOM / 100 && definedAscii.length() > 0; ++i) {
+                std::string str;
+                uint64_t length = random() % TEST_CHARSET_LENGTH_MAX;
+                uint64_t rate = 1 + random() % 64;
+                while (str.length() < length) {
+                    if (random() % rate == 0)
+                        str += defined[random() % defined.length()];
+                    else
+                        str += definedAscii[random() % definedAscii.length()];
+                }
+                std::string expected;
+                CHECK(iconvString(toUtf8, str, expected), "character set: " << names[0] << ", iconv failed for: " << hexString(str));
+                checkTranscode(characterSet, str, expected);
+            }
+
+            iconv_close(toUtf8);
+            iconv_close(fromUtf8);
+        }
+
+        if (skipped > 0)
+            std::cout << "character sets unknown to iconv, not checked: " << std::dec << skipped << std::endl;
+    }
+
+    //every code point from UTF-32 through iconv to UTF-8 and UTF-16, then through AL32UTF8, AL16UTF16 and UTF8 (CESU-8) back to UTF-8
+    static void testUnicodeConformance(void) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        const CharacterSet* characterSetUtf8 = output.outputBuffer->characterMap[871];
+        const CharacterSet* characterSetAl32utf8 = output.outputBuffer->characterMap[873];
+        const CharacterSet* characterSetAl16utf16 = output.outputBuffer->characterMap[2000];
+
+        iconv_t toUtf8 = iconv_open("UTF-8", "UTF-32BE");
+        iconv_t toUtf16 = iconv_open("UTF-16BE", "UTF-32BE");
+        if (toUtf8 == (iconv_t)-1 || toUtf16 == (iconv_t)-1) {
+            if (toUtf8 != (iconv_t)-1)
+                iconv_close(toUtf8);
+            if (toUtf16 != (iconv_t)-1)
+                iconv_close(toUtf16);
+            std::cout << "iconv can't convert UTF-32BE, Unicode character sets not checked" << std::endl;
+            return;
+        }
+
+        for (typeunicode first = 0; first <= 0x10FFFF; first += 50) {
+            std::string utf32;
+            for (typeunicode character = first; character < first + 50 && character <= 0x10FFFF; ++character) {
+                if (character >= 0xD800 && character <= 0xDFFF)
+                    continue;
+                utf32 += (char)(character >> 24);
+                utf32 += (char)((character >> 16) & 0xFF);
+                utf32 += (char)((character >> 8) & 0xFF);
+                utf32 += (char)(character & 0xFF);
+            }
+            if (utf32.length() == 0)
+                continue;
+
+            std::string utf8;
+            std::string utf16;
+            CHECK(iconvString(toUtf8, utf32, utf8) && iconvString(toUtf16, utf32, utf16), "iconv failed from: U+" << std::hex << first);
+
+            //Oracle UTF8 stores code points above U+FFFF as two 3-byte surrogates
+            std::string cesu8;
+            for (uint64_t i = 0; i + 1 < utf16.length(); i += 2)
+                referenceAppend(cesu8, (((typeunicode)(uint8_t)utf16[i]) << 8) | (uint8_t)utf16[i + 1]);
+
+            checkTranscode(characterSetAl32utf8, utf8, utf8);
+            checkTranscode(characterSetAl16utf16, utf16, utf8);
+            checkTranscode(characterSetUtf8, cesu8, utf8);
+        }
+
+        iconv_close(toUtf8);
+        iconv_close(toUtf16);
+    }
+
+    //whole-string path of parseString against per-character decode, for every character set
+    static void testParseString(void) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        TestOutputBufferJson* outputBuffer = output.outputBuffer;
+        std::mt19937_64 random(2);
+
+        for (auto it : outputBuffer->characterMap) {
+            CharacterSet* characterSet = it.second;
+            for (uint64_t i = 0; i < TEST_CHARSET_RANDOM / 100; ++i) {
+                std::string str = randomText(random, random() % TEST_CHARSET_LENGTH_MAX);
+                const uint8_t* data = (const uint8_t*)str.c_str();
+                outputBuffer->parseString(data, str.length(), it.first);
+                CHECK(outputBuffer->value() == referenceUtf8(characterSet, data, str.length()), "character set: " << characterSet->name <<
+                        ", length: " << std::dec << str.length());
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    //invalid sequences in random text are reported by decode
+    OpenLogReplicator::trace = TRACE_SILENT;
+
+    try {
+        OpenLogReplicator::testAsciiLength();
+        OpenLogReplicator::testSingleByte();
+        OpenLogReplicator::testUtf8();
+        OpenLogReplicator::testUtf16();
+        OpenLogReplicator::testConformance();
+        OpenLogReplicator::testUnicodeConformance();
+        OpenLogReplicator::testParseString();
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return OpenLogReplicator::testResult("TestCharset");
+}
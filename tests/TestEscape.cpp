@@ -0,0 +1,149 @@
+/* Test of JSON string escaping and hex encoding kernels
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <random>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBuffer.h"
+
+#define TEST_ESCAPE_RANDOM                  100000
+#define TEST_ESCAPE_LENGTH_MAX              300
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    static uint64_t referenceScan(const char* str, uint64_t length) {
+        for (uint64_t i = 0; i < length; ++i) {
+            uint8_t character = str[i];
+            if (character < 0x20 || character == '"' || character == '\\' || character == '/')
+                return i;
+        }
+        return length;
+    }
+
+    static std::string referenceEscape(const std::string& str) {
+        std::string out;
+        for (char character : str) {
+            switch (character) {
+            case '\t': out += "\\t"; break;
+            case '\r': out += "\\r"; break;
+            case '\n': out += "\\n"; break;
+            case '\f': out += "\\f"; break;
+            case '\b': out += "\\b"; break;
+            case 0: out += "\\u0000"; break;
+            case '"':
+            case '\\':
+            case '/':
+                out += '\\';
+                out += character;
+                break;
+            default:
+                out += character;
+            }
+        }
+        return out;
+    }
+
+    //mostly clean text with rare special characters, also bytes above 0x7F
+    static std::string randomText(std::mt19937_64& random, uint64_t length) {
+        static const char special[] = {'"', '\\', '/', '\t', '\r', '\n', '\f', '\b', 0, 0x01, 0x1F};
+        std::string str;
+        uint64_t rate = 1 + random() % 64;
+        for (uint64_t i = 0; i < length; ++i) {
+            if (random() % rate == 0)
+                str += special[random() % sizeof(special)];
+            else if (random() % 16 == 0)
+                str += (char)(0x80 + random() % 0x80);
+            else
+                str += (char)(0x20 + random() % 0x5F);
+        }
+        return str;
+    }
+
+    static void testScan(void) {
+        std::mt19937_64 random(1);
+        for (uint64_t i = 0; i < TEST_ESCAPE_RANDOM; ++i) {
+            std::string str = randomText(random, random() % TEST_ESCAPE_LENGTH_MAX);
+            //unaligned start
+            uint64_t offset = (str.length() > 0) ? random() % 16 % (str.length() + 1) : 0;
+            uint64_t expected = referenceScan(str.c_str() + offset, str.length() - offset);
+            uint64_t scan = TestOutputBufferJson::escapeScan(str.c_str() + offset, str.length() - offset);
+            CHECK(scan == expected, "length: " << std::dec << str.length() - offset << ", scan: " << scan << ", expected: " << expected);
+        }
+
+        //every special byte at every position of a 64 byte block
+        for (uint64_t character = 0; character < 256; ++character) {
+            uint8_t c = character;
+            bool special = (c < 0x20 || c == '"' || c == '\\' || c == '/');
+            for (uint64_t pos = 0; pos < 64; ++pos) {
+                std::string str(64, 'a');
+                str[pos] = c;
+                uint64_t scan = TestOutputBufferJson::escapeScan(str.c_str(), str.length());
+                CHECK(scan == (special ? pos : 64), "byte: " << std::dec << character << " at: " << pos << ", scan: " << scan);
+            }
+        }
+    }
+
+    static void testAppendEscape(void) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        TestOutputBufferJson* outputBuffer = output.outputBuffer;
+        std::mt19937_64 random(2);
+
+        for (uint64_t i = 0; i < TEST_ESCAPE_RANDOM / 10; ++i) {
+            std::string str = randomText(random, random() % TEST_ESCAPE_LENGTH_MAX);
+            outputBuffer->outputBufferBegin(0);
+            outputBuffer->appendEscape(str.c_str(), str.length());
+            CHECK(outputBuffer->message() == referenceEscape(str), "escaped text differs, length: " << std::dec << str.length());
+            outputBuffer->discard();
+        }
+    }
+
+    static void testHex(void) {
+        std::mt19937_64 random(3);
+        uint8_t src[TEST_ESCAPE_LENGTH_MAX];
+        uint8_t dst[TEST_ESCAPE_LENGTH_MAX * 2 + 1];
+
+        for (uint64_t i = 0; i < TEST_ESCAPE_RANDOM; ++i) {
+            uint64_t length = random() % TEST_ESCAPE_LENGTH_MAX;
+            std::string expected;
+            for (uint64_t j = 0; j < length; ++j) {
+                src[j] = random();
+                expected += "0123456789abcdef"[src[j] >> 4];
+                expected += "0123456789abcdef"[src[j] & 0x0F];
+            }
+            //guard byte must not be overwritten
+            dst[length * 2] = 0xAA;
+            TestOutputBufferJson::hexEncode(dst, src, length);
+            CHECK(std::string((const char*)dst, length * 2) == expected, "hex differs, length: " << std::dec << length);
+            CHECK(dst[length * 2] == 0xAA, "hex written past the end, length: " << std::dec << length);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        OpenLogReplicator::testScan();
+        OpenLogReplicator::testAppendEscape();
+        OpenLogReplicator::testHex();
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return OpenLogReplicator::testResult("TestEscape");
+}
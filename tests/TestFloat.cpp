@@ -0,0 +1,183 @@
+/* Test of shortest round-trip formatting of binary_float and binary_double
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "FloatFormatter.h"
+#include "RuntimeException.h"
+#include "Test.h"
+
+//every float bit pattern is checked with "TestFloat full", make check uses a stride
+#define TEST_FLOAT_STRIDE                   97
+#define TEST_FLOAT_DOUBLES                  2000000
+#define TEST_FLOAT_THREADS_MAX              16
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    std::atomic<uint64_t> floatFailures(0);
+    std::atomic<uint64_t> floatChecks(0);
+
+    //significant digits of the formatted value
+    static uint64_t significantDigits(const char* str, uint64_t length) {
+        std::string digits;
+        for (uint64_t i = 0; i < length && str[i] != 'e'; ++i)
+            if (str[i] >= '0' && str[i] <= '9')
+                digits += str[i];
+        uint64_t first = digits.find_first_not_of('0');
+        if (first == std::string::npos)
+            return 0;
+        uint64_t last = digits.find_last_not_of('0');
+        return last - first + 1;
+    }
+
+    static void floatRange(uint64_t first, uint64_t last, uint64_t stride) {
+        char buffer[FLOAT_FORMATTER_BUFFER_SIZE + 1];
+        uint64_t checks = 0;
+        uint64_t failures = 0;
+
+        for (uint64_t bits = first; bits < last; bits += stride) {
+            uint32_t bits32 = bits;
+            float value;
+            memcpy(&value, &bits32, sizeof(value));
+            uint64_t length = FloatFormatter::format(value, buffer);
+            buffer[length] = 0;
+            ++checks;
+
+            if (std::isnan(value)) {
+                if (strcmp(buffer, "nan") != 0)
+                    ++failures;
+                continue;
+            }
+
+            float parsed = strtof(buffer, nullptr);
+            uint32_t parsedBits;
+            memcpy(&parsedBits, &parsed, sizeof(parsedBits));
+            //shortest form of a float never needs more than 9 digits
+            if (parsedBits != bits32 || significantDigits(buffer, length) > 9) {
+                if (++failures <= 20)
+                    std::cerr << "float 0x" << std::hex << bits32 << " formatted as: " << buffer << std::endl;
+            }
+        }
+        floatChecks += checks;
+        floatFailures += failures;
+    }
+
+    static void testFloats(uint64_t stride) {
+        uint64_t threadsNum = std::thread::hardware_concurrency();
+        if (threadsNum < 1)
+            threadsNum = 1;
+        if (threadsNum > TEST_FLOAT_THREADS_MAX)
+            threadsNum = TEST_FLOAT_THREADS_MAX;
+
+        //ranges start at multiples of the stride, so the sample is the same for every thread count
+        uint64_t total = 0x100000000ULL;
+        uint64_t step = ((total / threadsNum) / stride + 1) * stride;
+        std::vector<std::thread> threads;
+        for (uint64_t first = 0; first < total; first += step)
+            threads.push_back(std::thread(floatRange, first, (first + step < total) ? first + step : total, stride));
+        for (std::thread& thread : threads)
+            thread.join();
+
+        testChecks += floatChecks;
+        testFailures += floatFailures;
+        std::cout << "floats checked: " << std::dec << floatChecks << std::endl;
+    }
+
+    static void checkDouble(double value, uint64_t& longer) {
+        char buffer[FLOAT_FORMATTER_BUFFER_SIZE + 1];
+        uint64_t length = FloatFormatter::format(value, buffer);
+        buffer[length] = 0;
+
+        if (std::isnan(value)) {
+            CHECK(strcmp(buffer, "nan") == 0, buffer);
+            return;
+        }
+        if (std::isinf(value)) {
+            CHECK(strcmp(buffer, value < 0 ? "-inf" : "inf") == 0, buffer);
+            return;
+        }
+
+        //%.17g is always exact, both must parse to the same bits
+        char reference[32];
+        snprintf(reference, sizeof(reference), "%.17g", value);
+        double parsed = strtod(buffer, nullptr);
+        double parsedReference = strtod(reference, nullptr);
+        CHECK(memcmp(&parsed, &value, sizeof(double)) == 0, "formatted: " << buffer << ", %.17g: " << reference);
+        CHECK(memcmp(&parsedReference, &parsed, sizeof(double)) == 0, "formatted: " << buffer << ", %.17g: " << reference);
+
+        uint64_t digits = significantDigits(buffer, length);
+        CHECK(digits <= 17, "formatted: " << buffer);
+
+        //Grisu2 is shortest for almost all values, count the rest
+        uint64_t shortest = 1;
+        for (; shortest < 17; ++shortest) {
+            snprintf(reference, sizeof(reference), "%.*g", (int)shortest, value);
+            if (strtod(reference, nullptr) == value)
+                break;
+        }
+        if (digits > shortest)
+            ++longer;
+    }
+
+    static void testDoubles(void) {
+        std::mt19937_64 random(1);
+        uint64_t longer = 0;
+
+        const double fixed[] = {0.0, -0.0, 1.0, -1.0, 0.1, 0.2, 0.3, 1e21, 1e22, 1e-7, 123456789012345678.0, 5e-324, 2.2250738585072014e-308,
+                1.7976931348623157e308, 4.35, 0.000001, 1.0 / 3.0, INFINITY, -INFINITY, NAN};
+        for (double value : fixed)
+            checkDouble(value, longer);
+
+        for (uint64_t i = 0; i < TEST_FLOAT_DOUBLES; ++i) {
+            double value;
+            if ((i & 1) == 0) {
+                //any bit pattern
+                uint64_t bits = random();
+                memcpy(&value, &bits, sizeof(value));
+            } else {
+                //typical column values
+                value = (double)(random() % 100000000) / std::pow(10.0, (double)(random() % 10));
+                if ((random() & 1) != 0)
+                    value = -value;
+            }
+            checkDouble(value, longer);
+        }
+        std::cout << "doubles checked: " << std::dec << TEST_FLOAT_DOUBLES << ", not shortest: " << longer << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t stride = TEST_FLOAT_STRIDE;
+    if (argc > 1 && strcmp(argv[1], "full") == 0)
+        stride = 1;
+
+    try {
+        OpenLogReplicator::testFloats(stride);
+        OpenLogReplicator::testDoubles();
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return OpenLogReplicator::testResult("TestFloat");
+}
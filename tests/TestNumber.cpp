@@ -0,0 +1,138 @@
+/* Test of Oracle NUMBER decoding
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <random>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestNumberEncoder.h"
+#include "TestOutputBuffer.h"
+
+#define TEST_NUMBER_RANDOM                  1000000
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    static void checkNumber(TestOutputBufferJson& outputBuffer, bool negative, const std::string& integer, const std::string& fraction) {
+        std::vector<uint8_t> bytes = encodeNumber(negative, integer, fraction);
+        std::string expected = integer;
+        if (fraction.length() > 0)
+            expected += "." + fraction;
+        bool zero = (bytes.size() == 1);
+        if (negative && !zero)
+            expected = "-" + expected;
+
+        bool valid = outputBuffer.parseNumber(bytes.data(), bytes.size());
+        CHECK(valid, expected);
+        CHECK(outputBuffer.value() == expected, "got: " << outputBuffer.value() << ", expected: " << expected);
+
+        //pairs counted like the decoder: integer part (when not 0) and fraction padded to full pairs
+        uint64_t pairs = (fraction.length() + 1) / 2;
+        if (integer != "0")
+            pairs += (integer.length() + 1) / 2;
+        if (pairs > NUMBER_NATIVE_PAIRS) {
+            CHECK(!outputBuffer.native(), expected);
+            return;
+        }
+
+        std::string digits = (integer == "0" ? "" : integer) + fraction;
+        int64_t mantissa = (digits.length() == 0) ? 0 : strtoll(digits.c_str(), nullptr, 10);
+        if (negative)
+            mantissa = -mantissa;
+        CHECK(outputBuffer.native(), expected);
+        CHECK(outputBuffer.mantissa() == mantissa, expected << " mantissa: " << outputBuffer.mantissa() << ", expected: " << mantissa);
+        CHECK(outputBuffer.scale() == (zero ? 0 : fraction.length()), expected << " scale: " << outputBuffer.scale());
+    }
+
+    static std::string randomDigits(std::mt19937_64& random, uint64_t length, bool leading, bool trailing) {
+        std::string str;
+        for (uint64_t i = 0; i < length; ++i)
+            str += (char)('0' + random() % 10);
+        if (length > 0 && !leading && str[0] == '0')
+            str[0] = '1' + random() % 9;
+        if (length > 0 && !trailing && str[length - 1] == '0')
+            str[length - 1] = '1' + random() % 9;
+        return str;
+    }
+
+    static void testNumbers(void) {
+        TestOutputBufferJson outputBuffer(NUMBER_FORMAT_NATIVE);
+
+        checkNumber(outputBuffer, false, "0", "");
+        checkNumber(outputBuffer, false, "1", "");
+        checkNumber(outputBuffer, true, "1", "");
+        checkNumber(outputBuffer, false, "100", "");
+        checkNumber(outputBuffer, false, "0", "5");
+        checkNumber(outputBuffer, true, "0", "005");
+        checkNumber(outputBuffer, false, "123", "45");
+        checkNumber(outputBuffer, false, "999999999999999999", "");
+        checkNumber(outputBuffer, true, "999999999999999999", "");
+        checkNumber(outputBuffer, false, "9999999999999999999", "");
+        checkNumber(outputBuffer, false, "1", "00000000000000001");
+        checkNumber(outputBuffer, false, "9999999999999999999999999999999999999", "9");
+        checkNumber(outputBuffer, true, "99999999999999999999999999999999999999", "");
+
+        std::mt19937_64 random(1);
+        for (uint64_t i = 0; i < TEST_NUMBER_RANDOM; ++i) {
+            //at most 20 mantissa pairs, up to 38 integer digits
+            uint64_t integerLength = random() % 39;
+            uint64_t fractionLength = random() % (39 - integerLength + 1);
+            std::string integer = (integerLength == 0) ? "0" : randomDigits(random, integerLength, false, true);
+            std::string fraction = randomDigits(random, fractionLength, true, false);
+            if (fraction.find_first_not_of('0') == std::string::npos)
+                fraction = "";
+            checkNumber(outputBuffer, (random() & 1) != 0, integer, fraction);
+        }
+    }
+
+    //digit bytes must be 1..100 for positive and 2..101 for negative numbers
+    static void testInvalid(void) {
+        TestOutputBufferJson outputBuffer(NUMBER_FORMAT_NATIVE);
+        const uint8_t invalid[][4] = {
+            {0xC1, 0x00, 0x00, 0x00},
+            {0xC1, 0x66, 0x00, 0x00},
+            {0xC1, 0xFF, 0x00, 0x00},
+            {0xC2, 0x02, 0x00, 0x00},
+            {0xC0, 0x02, 0x00, 0x00},
+            {0xC0, 0x02, 0x65, 0x00},
+            {0x3E, 0x01, 0x66, 0x00},
+            {0x3E, 0x00, 0x66, 0x00},
+            {0x3D, 0x02, 0xFF, 0x66},
+            {0x3F, 0x02, 0x01, 0x66}
+        };
+        const uint64_t lengths[] = {2, 2, 2, 3, 3, 4, 3, 3, 4, 4};
+
+        for (uint64_t i = 0; i < sizeof(lengths) / sizeof(uint64_t); ++i) {
+            bool valid = outputBuffer.parseNumber(invalid[i], lengths[i]);
+            CHECK(!valid, "invalid number #" << std::dec << i << " accepted as: " << outputBuffer.value());
+            CHECK(!outputBuffer.native(), "invalid number #" << std::dec << i);
+            CHECK(outputBuffer.value().length() == 0, "invalid number #" << std::dec << i);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        OpenLogReplicator::testNumbers();
+        OpenLogReplicator::testInvalid();
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return OpenLogReplicator::testResult("TestNumber");
+}
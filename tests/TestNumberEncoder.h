@@ -0,0 +1,73 @@
+/* Reference encoder of Oracle NUMBER values for tests
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <string>
+#include <vector>
+
+#include "types.h"
+
+#ifndef TESTNUMBERENCODER_H_
+#define TESTNUMBERENCODER_H_
+
+namespace OpenLogReplicator {
+    //reference encoder: integer digits without leading zeros ("0" when none), fraction digits without trailing zeros
+    static inline std::vector<uint8_t> encodeNumber(bool negative, std::string integer, std::string fraction) {
+        std::vector<uint8_t> bytes;
+        if (integer == "0" && fraction.length() == 0) {
+            bytes.push_back(0x80);
+            return bytes;
+        }
+
+        if (integer == "0")
+            integer = "";
+        if ((integer.length() & 1) != 0)
+            integer = "0" + integer;
+        if ((fraction.length() & 1) != 0)
+            fraction += "0";
+
+        std::vector<uint8_t> pairs;
+        for (uint64_t i = 0; i < integer.length(); i += 2)
+            pairs.push_back((integer[i] - '0') * 10 + integer[i + 1] - '0');
+        int64_t exponent = (int64_t)(integer.length() / 2) - 1;
+        for (uint64_t i = 0; i < fraction.length(); i += 2)
+            pairs.push_back((fraction[i] - '0') * 10 + fraction[i + 1] - '0');
+
+        while (pairs.front() == 0) {
+            pairs.erase(pairs.begin());
+            --exponent;
+        }
+        while (pairs.back() == 0)
+            pairs.pop_back();
+
+        if (negative) {
+            bytes.push_back(62 - exponent);
+            for (uint8_t pair : pairs)
+                bytes.push_back(101 - pair);
+            if (pairs.size() < 20)
+                bytes.push_back(102);
+        } else {
+            bytes.push_back(193 + exponent);
+            for (uint8_t pair : pairs)
+                bytes.push_back(pair + 1);
+        }
+        return bytes;
+    }
+}
+
+#endif
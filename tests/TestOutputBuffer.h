@@ -0,0 +1,177 @@
+/* Output buffer fixture for tests and benchmarks
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <string>
+
+#include "OracleAnalyzer.h"
+#include "OracleObject.h"
+#include "OutputBufferJson.h"
+
+#ifndef TESTOUTPUTBUFFER_H_
+#define TESTOUTPUTBUFFER_H_
+
+#define TEST_OUTPUT_BUFFER_MEMORY_MB        (MEMORY_CHUNK_MIN_MB + 8 * MEMORY_CHUNK_SIZE_MB)
+
+namespace OpenLogReplicator {
+    class TestAnalyzer : public OracleAnalyzer {
+    public:
+        TestAnalyzer(OutputBuffer* outputBuffer, uint64_t memoryMb) :
+            OracleAnalyzer(outputBuffer, 0, 0, "", "test", "test", memoryMb, memoryMb, 1, 0) {
+        }
+    };
+
+    //messages in the order read by Writer::run, all must be in the first chunk
+    static inline std::vector<OutputBufferMsg*> testMessages(const OutputBuffer* outputBuffer) {
+        std::vector<OutputBufferMsg*> msgs;
+        if (outputBuffer->firstBuffer != outputBuffer->lastBuffer) {
+            RUNTIME_FAIL("test messages don't fit in one output buffer chunk");
+        }
+        uint64_t pos = 0;
+        while (pos + sizeof(struct OutputBufferMsg) < outputBuffer->firstBuffer->length) {
+            OutputBufferMsg* message = (OutputBufferMsg*)(outputBuffer->firstBuffer->data + pos);
+            if (message->length == 0)
+                break;
+            msgs.push_back(message);
+            pos += sizeof(struct OutputBufferMsg) + ((message->length + 7) & 0xFFFFFFFFFFFFFFF8);
+        }
+        return msgs;
+    }
+
+    //output buffer with the protected formatting methods opened for tests
+    template<class OUTPUT> class TestOutputBufferOf : public OUTPUT {
+    public:
+        TestOutputBufferOf(uint64_t numberFormat) :
+            OUTPUT(MESSAGE_FORMAT_DEFAULT, RID_FORMAT_SKIP, XID_FORMAT_TEXT, TIMESTAMP_FORMAT_UNIX, CHAR_FORMAT_UTF8, SCN_FORMAT_NUMERIC,
+                    UNKNOWN_FORMAT_QUESTION_MARK, SCHEMA_FORMAT_NAME, COLUMN_FORMAT_CHANGED, UNKNOWN_TYPE_HIDE, numberFormat, 0) {
+        }
+
+        using OUTPUT::parseNumber;
+        using OUTPUT::parseString;
+        using OUTPUT::outputBufferBegin;
+        using OUTPUT::outputBufferCommit;
+        using OUTPUT::outputBufferAppend;
+        using OUTPUT::outputBufferReserve;
+        using OUTPUT::outputBufferReserveCommit;
+        using OUTPUT::daysFromCivil;
+        using OUTPUT::timestampToIso8601;
+        using OUTPUT::findTimeZone;
+        using OUTPUT::timeZoneMap;
+        using OutputBuffer::processBegin;
+
+        //value of the row, null when empty; the data must be kept until the row is processed
+        void set(uint64_t type, typeCOL column, const std::string& data) {
+            this->valueSet(type, column, (uint8_t*)data.c_str(), data.length(), 0);
+        }
+
+        //row like processDML sends it after decoding redo, type is one of TRANSACTION_*
+        void row(uint64_t type, OracleObject* object, typeDBA bdba, typeSLOT slot) {
+            this->processRow(type, object, object != nullptr ? object->dataObj : 0, bdba, slot, this->lastXid);
+            this->valuesRelease();
+        }
+
+        std::string value(void) const {
+            return std::string(this->valueBuffer, this->valueLength);
+        }
+
+        int64_t mantissa(void) const {
+            return this->numberMantissa;
+        }
+
+        uint64_t scale(void) const {
+            return this->numberScale;
+        }
+
+        bool native(void) const {
+            return this->numberNative;
+        }
+
+        uint64_t length(void) const {
+            return this->messageLength;
+        }
+
+        //drops all output like a writer which confirmed everything, keeps the last chunk
+        void discard(void) {
+            while (this->firstBuffer != this->lastBuffer) {
+                OutputBufferQueue* nextBuffer = this->firstBuffer->next;
+                this->oracleAnalyzer->freeMemoryChunk(MEMORY_MODULE_OUTPUT_BUFFER, (uint8_t*)this->firstBuffer, true);
+                this->firstBuffer = nextBuffer;
+                --this->buffersAllocated;
+            }
+            this->lastBuffer->length = 0;
+            this->messageLength = 0;
+            this->msg = nullptr;
+        }
+
+        //bytes of the current message, which may span many chunks
+        std::string message(void) const {
+            std::string str;
+            bool found = false;
+            for (OutputBufferQueue* buffer = this->firstBuffer; buffer != nullptr; buffer = buffer->next) {
+                const uint8_t* data = buffer->data;
+                uint64_t length = buffer->length;
+                if (!found) {
+                    if (this->msg->data < buffer->data || this->msg->data > buffer->data + OUTPUT_BUFFER_DATA_SIZE)
+                        continue;
+                    found = true;
+                    length -= this->msg->data - buffer->data;
+                    data = this->msg->data;
+                }
+                str.append((const char*)data, length);
+            }
+            return str;
+        }
+    };
+
+    class TestOutputBufferJson : public TestOutputBufferOf<OutputBufferJson> {
+    public:
+        TestOutputBufferJson(uint64_t numberFormat) :
+            TestOutputBufferOf<OutputBufferJson>(numberFormat) {
+        }
+
+        using OutputBufferJson::appendEscape;
+        using OutputBufferJson::appendHex;
+        using OutputBufferJson::appendDec;
+        using OutputBufferJson::escapeScan;
+        using OutputBufferJson::hexEncode;
+    };
+
+    //output buffer with its own memory, released in the right order
+    template<class OUTPUT> class TestOutputOf {
+    public:
+        OUTPUT* outputBuffer;
+        TestAnalyzer* analyzer;
+
+        TestOutputOf(uint64_t numberFormat) :
+            outputBuffer(new OUTPUT(numberFormat)),
+            analyzer(nullptr) {
+            analyzer = new TestAnalyzer(outputBuffer, TEST_OUTPUT_BUFFER_MEMORY_MB);
+            analyzer->initialize();
+            outputBuffer->initialize(analyzer);
+        }
+
+        ~TestOutputOf() {
+            delete outputBuffer;
+            delete analyzer;
+        }
+    };
+
+    typedef TestOutputOf<TestOutputBufferJson> TestOutput;
+}
+
+#endif
@@ -0,0 +1,163 @@
+/* Avro output buffer fixture for tests and benchmarks
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <dirent.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "OracleColumn.h"
+#include "OracleObject.h"
+#include "OutputBufferAvro.h"
+#include "TestOutputBuffer.h"
+
+#ifndef TESTOUTPUTBUFFERAVRO_H_
+#define TESTOUTPUTBUFFERAVRO_H_
+
+namespace OpenLogReplicator {
+    //directory removed with its files when the test ends
+    class TestDirectory {
+    public:
+        std::string path;
+
+        TestDirectory(void) {
+            const char* tmp = getenv("TMPDIR");
+            std::string pattern((tmp != nullptr && tmp[0] != 0) ? tmp : "/tmp");
+            pattern += "/OpenLogReplicator.XXXXXX";
+            if (mkdtemp(&pattern[0]) == nullptr) {
+                RUNTIME_FAIL("can't create temporary directory: " << pattern << " - " << strerror(errno));
+            }
+            path = pattern;
+        }
+
+        ~TestDirectory() {
+            for (const std::string& name : files())
+                unlink((path + "/" + name).c_str());
+            rmdir(path.c_str());
+        }
+
+        std::vector<std::string> files(void) const {
+            std::vector<std::string> names;
+            DIR* dir = opendir(path.c_str());
+            if (dir == nullptr)
+                return names;
+            struct dirent* ent;
+            while ((ent = readdir(dir)) != nullptr)
+                if (ent->d_name[0] != '.')
+                    names.push_back(ent->d_name);
+            closedir(dir);
+            return names;
+        }
+    };
+
+    //Avro output buffer with rows set directly, like processDML does after decoding redo
+    class TestOutputBufferAvro : public OutputBufferAvro {
+    public:
+        TestOutputBufferAvro(const char* registryPath) :
+            OutputBufferAvro(MESSAGE_FORMAT_DEFAULT, RID_FORMAT_DEFAULT, XID_FORMAT_TEXT, TIMESTAMP_FORMAT_UNIX, CHAR_FORMAT_UTF8, SCN_FORMAT_NUMERIC,
+                    UNKNOWN_FORMAT_QUESTION_MARK, SCHEMA_FORMAT_NAME, COLUMN_FORMAT_CHANGED, UNKNOWN_TYPE_HIDE, NUMBER_FORMAT_TEXT, 0, registryPath) {
+        }
+
+        using OutputBufferAvro::controlFingerprint;
+        using OutputBufferAvro::unknownFingerprint;
+        using OutputBufferAvro::controlSchema;
+        using OutputBufferAvro::unknownSchema;
+        using OutputBufferAvro::fingerprint;
+        using OutputBufferAvro::buildRecord;
+        using OutputBufferAvro::appendLong;
+        using OutputBufferAvro::outputBufferBegin;
+        using OutputBufferAvro::outputBufferCommit;
+        using OutputBuffer::processBegin;
+
+        //value of the row, null when empty; the data must be kept until the row is sent
+        void set(uint64_t type, typeCOL column, const std::string& data) {
+            valueSet(type, column, (uint8_t*)data.c_str(), data.length(), 0);
+        }
+
+        void insert(OracleObject* object, typeDBA bdba, typeSLOT slot) {
+            processInsert(object, object != nullptr ? object->dataObj : 0, bdba, slot, lastXid);
+            valuesRelease();
+        }
+
+        void update(OracleObject* object, typeDBA bdba, typeSLOT slot) {
+            processUpdate(object, object != nullptr ? object->dataObj : 0, bdba, slot, lastXid);
+            valuesRelease();
+        }
+
+        void remove(OracleObject* object, typeDBA bdba, typeSLOT slot) {
+            processDelete(object, object != nullptr ? object->dataObj : 0, bdba, slot, lastXid);
+            valuesRelease();
+        }
+
+        void undo(OracleObject* object, typeDBA bdba, typeSLOT slot) {
+            processUndo(object, object != nullptr ? object->dataObj : 0, bdba, slot, lastXid);
+        }
+
+        std::vector<OutputBufferMsg*> messages(void) const {
+            return testMessages(this);
+        }
+    };
+
+    //Avro output with its own registry directory
+    class TestOutputAvro {
+    public:
+        TestDirectory registry;
+        TestOutputBufferAvro* outputBuffer;
+        TestAnalyzer* analyzer;
+
+        TestOutputAvro(void) :
+            outputBuffer(nullptr),
+            analyzer(nullptr) {
+            outputBuffer = new TestOutputBufferAvro(registry.path.c_str());
+            analyzer = new TestAnalyzer(outputBuffer, TEST_OUTPUT_BUFFER_MEMORY_MB);
+            analyzer->initialize();
+            outputBuffer->initialize(analyzer);
+        }
+
+        ~TestOutputAvro() {
+            delete outputBuffer;
+            delete analyzer;
+        }
+    };
+
+    static inline void testAddColumn(OracleObject* object, const char* name, uint64_t typeNo, uint64_t charsetId) {
+        std::string columnName(name);
+        typeCOL segColNo = object->columns.size() + 1;
+        OracleColumn* column = new OracleColumn(segColNo, -1, segColNo, columnName, typeNo, 22, -1, -1, 0, charsetId, true, false, false,
+                false, false, false, false, false);
+        object->addColumn(column);
+    }
+
+    //N NUMBER, V VARCHAR2, D DATE, R RAW, F BINARY_FLOAT, B BINARY_DOUBLE
+    static inline OracleObject* testAvroObject(void) {
+        std::string owner("TEST");
+        std::string name("T");
+        OracleObject* object = new OracleObject(1, 2, 1, 0, 0, owner, name);
+        testAddColumn(object, "N", 2, 0);
+        testAddColumn(object, "V", 1, 873);
+        testAddColumn(object, "D", 12, 0);
+        testAddColumn(object, "R", 23, 0);
+        testAddColumn(object, "F", 100, 0);
+        testAddColumn(object, "B", 101, 0);
+        return object;
+    }
+}
+
+#endif
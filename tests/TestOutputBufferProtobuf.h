@@ -0,0 +1,45 @@
+/* Protobuf output buffer fixture for tests and benchmarks
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include "OutputBufferProtobuf.h"
+#include "TestOutputBuffer.h"
+
+#ifndef TESTOUTPUTBUFFERPROTOBUF_H_
+#define TESTOUTPUTBUFFERPROTOBUF_H_
+
+namespace OpenLogReplicator {
+    class TestOutputBufferProtobuf : public TestOutputBufferOf<OutputBufferProtobuf> {
+    public:
+        TestOutputBufferProtobuf(uint64_t numberFormat) :
+            TestOutputBufferOf<OutputBufferProtobuf>(numberFormat) {
+        }
+
+        using OutputBufferProtobuf::createResponse;
+        using OutputBufferProtobuf::appendResponse;
+        using OutputBufferProtobuf::redoResponsePB;
+        using OutputBufferProtobuf::payloadPB;
+        using OutputBufferProtobuf::valuePB;
+        using OutputBufferProtobuf::arena;
+        using OutputBufferProtobuf::batchOpen;
+    };
+
+    typedef TestOutputOf<TestOutputBufferProtobuf> TestOutputProtobuf;
+}
+
+#endif
@@ -0,0 +1,298 @@
+/* Test of rows written as Parquet files
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include "ParquetTable.h"
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestNumberEncoder.h"
+#include "TestOutputBuffer.h"
+#include "TestOutputBufferAvro.h"
+#include "WriterParquet.h"
+
+#define TEST_PARQUET_SCN                    100
+#define TEST_PARQUET_TIME                   1000
+#define TEST_PARQUET_XID                    0x0001000200000003
+#define TEST_PARQUET_BDBA                   0x01000010
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    //parquet writer with the row groups opened for tests
+    class TestWriterParquet : public WriterParquet {
+    public:
+        TestWriterParquet(OracleAnalyzer* oracleAnalyzer, const char* output) :
+            WriterParquet("test", oracleAnalyzer, 1000, 10, 4096, ZERO_SCN, ZERO_SEQ, "", 0, output, UINT64_MAX, PARQUET_CODEC_UNCOMPRESSED) {
+        }
+
+        using WriterParquet::flush;
+
+        //queued like by Writer::run
+        void send(OutputBufferMsg* msg) {
+            createMessage(msg);
+            sendMessage(msg);
+        }
+
+        ParquetTable* table(OracleObject* object) {
+            if (tables.count(object) == 0)
+                return nullptr;
+            return tables[object]->table;
+        }
+
+        typeSCN confirmed(void) const {
+            return confirmedScn;
+        }
+
+        uint64_t queued(void) const {
+            return tmpQueueSize;
+        }
+    };
+
+    //values by row: "-" for absent row image, "absent" for column not present in redo, "null" for null column
+    static std::vector<std::string> columnRows(ParquetColumn* column, uint64_t rows) {
+        std::vector<std::string> values;
+        uint64_t pos = 0;
+        for (uint64_t row = 0; row < rows; ++row) {
+            if (column->maxDefinition > 0) {
+                if (row >= column->definitions.size()) {
+                    values.push_back("missing");
+                    continue;
+                }
+                uint8_t definition = column->definitions[row];
+                if (definition < column->maxDefinition) {
+                    if (definition + 1 == column->maxDefinition)
+                        values.push_back("null");
+                    else
+                        values.push_back(definition == 0 ? "-" : "absent");
+                    continue;
+                }
+            }
+
+            const char* data = column->plain.c_str() + pos;
+            int64_t valueInt = 0;
+            float valueFloat;
+            double valueDouble;
+            uint64_t length = 0;
+            switch (column->type) {
+            case PARQUET_TYPE_BOOLEAN:
+                values.push_back(data[0] != 0 ? "true" : "false");
+                pos += 1;
+                break;
+
+            case PARQUET_TYPE_INT64:
+                for (uint64_t i = 0; i < 8; ++i)
+                    valueInt |= (int64_t)(uint8_t)data[i] << (i * 8);
+                values.push_back(std::to_string(valueInt));
+                pos += 8;
+                break;
+
+            case PARQUET_TYPE_FLOAT:
+                memcpy(&valueFloat, data, 4);
+                values.push_back(std::to_string(valueFloat));
+                pos += 4;
+                break;
+
+            case PARQUET_TYPE_DOUBLE:
+                memcpy(&valueDouble, data, 8);
+                values.push_back(std::to_string(valueDouble));
+                pos += 8;
+                break;
+
+            default:
+                for (uint64_t i = 0; i < 4; ++i)
+                    length |= (uint64_t)(uint8_t)data[i] << (i * 8);
+                values.push_back(std::string(data + 4, length));
+                pos += 4 + length;
+            }
+        }
+        return values;
+    }
+
+    static std::string numberBytes(bool negative, const char* integer, const char* fraction) {
+        std::vector<uint8_t> bytes = encodeNumber(negative, integer, fraction);
+        return std::string(bytes.begin(), bytes.end());
+    }
+
+    static std::string rowId(typeDATAOBJ dataObj, typeSLOT slot) {
+        char str[19];
+        RowId(dataObj, TEST_PARQUET_BDBA, slot).toString(str);
+        return std::string(str, 18);
+    }
+
+    static std::string readFile(const std::string& fileName) {
+        std::ifstream inputStream(fileName.c_str(), std::ios::in | std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(inputStream)), std::istreambuf_iterator<char>());
+    }
+
+    //rows passed by the output buffer are stored as columns, messages carry only begin and commit
+    static void testRows(void) {
+        TestOutput json(NUMBER_FORMAT_TEXT);
+        TestOutputBufferJson* outputBuffer = json.outputBuffer;
+        TestDirectory output;
+        OracleObject* object = testAvroObject();
+
+        TestWriterParquet writer(json.analyzer, output.path.c_str());
+        writer.initialize();
+
+        //2022-10-19 12:34:56
+        std::string n1 = numberBytes(false, "1", ""), n2 = numberBytes(false, "2", ""), n3 = numberBytes(true, "7", "5");
+        std::string v1("abc"), v2("xyz"), null;
+        std::string d1("\x78\x7A\x0A\x13\x0D\x23\x39", 7), d2("\x78\x7A\x0A", 3);
+        std::string r1("\x01\x00\xFF", 3);
+        float f = 1.5;
+        double b = -2.25;
+        std::string f1((const char*)&f, 4), b1((const char*)&b, 8);
+
+        outputBuffer->processBegin(TEST_PARQUET_SCN, TEST_PARQUET_TIME, 0, TEST_PARQUET_XID);
+        outputBuffer->set(VALUE_AFTER, 0, n1);
+        outputBuffer->set(VALUE_AFTER, 1, v1);
+        outputBuffer->set(VALUE_AFTER, 2, d1);
+        outputBuffer->set(VALUE_AFTER, 3, r1);
+        outputBuffer->set(VALUE_AFTER, 4, f1);
+        outputBuffer->set(VALUE_AFTER, 5, b1);
+        outputBuffer->row(TRANSACTION_INSERT, object, TEST_PARQUET_BDBA, 0);
+        //malformed date is an unknown value, stored as null
+        outputBuffer->set(VALUE_AFTER, 0, n3);
+        outputBuffer->set(VALUE_AFTER, 1, null);
+        outputBuffer->set(VALUE_AFTER, 2, d2);
+        outputBuffer->row(TRANSACTION_INSERT, object, TEST_PARQUET_BDBA, 1);
+        outputBuffer->set(VALUE_BEFORE, 0, n1);
+        outputBuffer->set(VALUE_BEFORE, 1, v1);
+        outputBuffer->set(VALUE_AFTER, 0, n2);
+        outputBuffer->set(VALUE_AFTER, 1, v2);
+        outputBuffer->row(TRANSACTION_UPDATE, object, TEST_PARQUET_BDBA, 0);
+        outputBuffer->set(VALUE_BEFORE, 0, n2);
+        outputBuffer->row(TRANSACTION_DELETE, object, TEST_PARQUET_BDBA, 0);
+        outputBuffer->row(TRANSACTION_UNDO, object, TEST_PARQUET_BDBA, 1);
+        //table without schema information is skipped
+        uint64_t traceOld = trace;
+        trace = TRACE_SILENT;
+        outputBuffer->set(VALUE_AFTER, 0, n1);
+        outputBuffer->row(TRANSACTION_INSERT, nullptr, TEST_PARQUET_BDBA, 2);
+        trace = traceOld;
+        outputBuffer->processCommit();
+
+        std::vector<OutputBufferMsg*> msgs = testMessages(outputBuffer);
+        CHECK(msgs.size() == 2, "messages: " << std::dec << msgs.size());
+        for (OutputBufferMsg* msg : msgs)
+            writer.send(msg);
+
+        ParquetTable* table = writer.table(object);
+        CHECK(table != nullptr && table->rows == 5 && table->columns.size() == 20, "table layout");
+        if (table == nullptr || table->rows != 5 || table->columns.size() != 20) {
+            delete object;
+            return;
+        }
+        CHECK(table->name == "TEST.T", "table name: " << table->name);
+
+        std::string d1Text(std::to_string((int64_t)1666182896 * 1000000));
+        std::string f1Text(std::to_string(f)), b1Text(std::to_string(b));
+        typeTIME tm(TEST_PARQUET_TIME);
+        std::string time(std::to_string((int64_t)tm.toTime() * 1000)), xid(std::to_string(TEST_PARQUET_XID));
+        std::vector<std::vector<std::string>> expected = {
+            {"100", "100", "100", "100", "100"},
+            {time, time, time, time, time},
+            {xid, xid, xid, xid, xid},
+            {"false", "false", "false", "false", "false"},
+            {"c", "c", "u", "d", "undo"},
+            {"0", "1", "2", "3", "4"},
+            {"2", "2", "2", "2", "2"},
+            {rowId(2, 0), rowId(2, 1), rowId(2, 0), rowId(2, 0), rowId(2, 1)},
+            //before: N, V, D, R, F, B
+            {"-", "-", "1", "2", "-"},
+            {"-", "-", "abc", "absent", "-"},
+            {"-", "-", "absent", "absent", "-"},
+            {"-", "-", "absent", "absent", "-"},
+            {"-", "-", "absent", "absent", "-"},
+            {"-", "-", "absent", "absent", "-"},
+            //after
+            {"1", "-7.5", "2", "-", "-"},
+            {"abc", "null", "xyz", "-", "-"},
+            {d1Text, "null", "absent", "-", "-"},
+            {r1, "absent", "absent", "-", "-"},
+            {f1Text, "absent", "absent", "-", "-"},
+            {b1Text, "absent", "absent", "-", "-"}
+        };
+        for (uint64_t col = 0; col < expected.size(); ++col) {
+            ParquetColumn* column = table->columns[col];
+            std::string path;
+            for (const std::string& group : column->groups)
+                path += group + ".";
+            path += column->name;
+            std::vector<std::string> values = columnRows(column, table->rows);
+            for (uint64_t row = 0; row < table->rows; ++row)
+                CHECK(values[row] == expected[col][row], "column: " << path << ", row: " << std::dec << row << ", value: " << values[row] <<
+                        ", expected: " << expected[col][row]);
+        }
+
+        //image and column groups, the value is the leaf
+        CHECK(table->columns[8]->groups.size() == 2 && table->columns[8]->groups[0] == "before" && table->columns[8]->groups[1] == "N" &&
+                table->columns[8]->name == "value" && table->columns[8]->maxDefinition == 3, "layout of column before.N");
+
+        //confirmed once the files are written, named after the last scn
+        CHECK(writer.queued() == 2, "confirmed before flush: " << std::dec << writer.queued());
+        writer.flush();
+        CHECK(writer.queued() == 0, "left unconfirmed: " << std::dec << writer.queued());
+        CHECK(writer.confirmed() == TEST_PARQUET_SCN, "confirmed scn: " << std::dec << writer.confirmed());
+        CHECK(table->rows == 0, "rows left after flush: " << std::dec << table->rows);
+
+        std::vector<std::string> files = output.files();
+        CHECK(files.size() == 1 && files[0] == "TEST.T-100.parquet", "parquet files: " << std::dec << files.size());
+        std::string content = readFile(output.path + "/TEST.T-100.parquet");
+        CHECK(content.length() > 8 && content.substr(0, 4) == "PAR1" && content.substr(content.length() - 4) == "PAR1", "not a parquet file");
+
+        //rows of an open transaction are written with the next flush, an existing file is not overwritten
+        outputBuffer->processBegin(TEST_PARQUET_SCN + 1, TEST_PARQUET_TIME, 0, TEST_PARQUET_XID);
+        outputBuffer->set(VALUE_AFTER, 0, n2);
+        outputBuffer->row(TRANSACTION_INSERT, object, TEST_PARQUET_BDBA, 3);
+        writer.flush();
+        files = output.files();
+        CHECK(files.size() == 2 && std::count(files.begin(), files.end(), "TEST.T-100-1.parquet") == 1,
+                "file written twice for scn: " << std::dec << TEST_PARQUET_SCN);
+
+        //table of a released object is written with the next flush
+        outputBuffer->set(VALUE_AFTER, 0, n3);
+        outputBuffer->row(TRANSACTION_INSERT, object, TEST_PARQUET_BDBA, 4);
+        outputBuffer->releaseObject(object);
+        CHECK(writer.table(object) == nullptr, "table kept for released object");
+        outputBuffer->processCommit();
+        msgs = testMessages(outputBuffer);
+        CHECK(msgs.size() == 4, "messages: " << std::dec << msgs.size());
+        for (uint64_t i = 2; i < msgs.size(); ++i)
+            writer.send(msgs[i]);
+        writer.flush();
+        CHECK(writer.confirmed() == TEST_PARQUET_SCN + 1, "confirmed scn: " << std::dec << writer.confirmed());
+        files = output.files();
+        CHECK(files.size() == 3 && std::count(files.begin(), files.end(), "TEST.T-101.parquet") == 1, "released table not written");
+
+        delete object;
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        OpenLogReplicator::testRows();
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return OpenLogReplicator::testResult("TestParquet");
+}
@@ -0,0 +1,155 @@
+/* Test of Protobuf message serialization to output buffer chunks
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <random>
+
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBufferProtobuf.h"
+
+#define TEST_PROTOBUF_MESSAGES              20
+#define TEST_PROTOBUF_VALUE_MAX             20000
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    //response with columns of every kind, the same seed gives the same message
+    static void fillResponse(pb::RedoResponse* redoResponsePB, std::mt19937_64& random, uint64_t size) {
+        redoResponsePB->set_scn(random());
+        redoResponsePB->set_tm(random());
+        redoResponsePB->set_xid("0x0001.002.00000003");
+        redoResponsePB->add_payload();
+        pb::Payload* payloadPB = redoResponsePB->mutable_payload(redoResponsePB->payload_size() - 1);
+        payloadPB->set_op(pb::INSERT);
+
+        for (uint64_t column = 0; redoResponsePB->ByteSizeLong() < size; ++column) {
+            payloadPB->add_after();
+            pb::Value* valuePB = payloadPB->mutable_after(payloadPB->after_size() - 1);
+            valuePB->set_name("COL" + std::to_string(column));
+            switch (random() % 3) {
+            case 0:
+                valuePB->set_value_int(random());
+                break;
+
+            case 1:
+                valuePB->set_value_double((double)random() / 3);
+                break;
+
+            case 2: {
+                std::string value;
+                uint64_t length = random() % TEST_PROTOBUF_VALUE_MAX;
+                for (uint64_t i = 0; i < length; ++i)
+                    value += (char)('a' + (random() % 26));
+                valuePB->set_value_string(value);
+                break;
+            }
+            }
+        }
+    }
+
+    //messages up to 3 chunks long, written directly or streamed across chunks
+    static void testSerialize(void) {
+        TestOutputProtobuf output(NUMBER_FORMAT_TEXT);
+        TestOutputBufferProtobuf* outputBuffer = output.outputBuffer;
+        std::mt19937_64 random(1);
+
+        for (uint64_t message = 0; message < TEST_PROTOBUF_MESSAGES; ++message) {
+            uint64_t size = random() % (3 * OUTPUT_BUFFER_DATA_SIZE);
+            uint64_t seed = random();
+
+            //start some messages a few bytes before the end of the chunk
+            if (message % 4 == 1) {
+                outputBuffer->outputBufferBegin(0);
+                std::string padding(OUTPUT_BUFFER_DATA_SIZE - outputBuffer->lastBuffer->length - sizeof(struct OutputBufferMsg) - 64 - message, 'x');
+                outputBuffer->outputBufferAppend(padding);
+                outputBuffer->outputBufferCommit(true);
+            }
+            outputBuffer->outputBufferBegin(0);
+
+            std::mt19937_64 randomMessage(seed);
+            outputBuffer->createResponse();
+            fillResponse(outputBuffer->redoResponsePB, randomMessage, size);
+            std::string expected;
+            outputBuffer->redoResponsePB->SerializeToString(&expected);
+
+            bool ret = outputBuffer->appendResponse();
+            CHECK(ret, "message #" << std::dec << message);
+            CHECK(outputBuffer->redoResponsePB == nullptr, "message #" << std::dec << message << " not released");
+            CHECK(outputBuffer->length() == expected.length(), "message #" << std::dec << message << " length: " << outputBuffer->length() <<
+                    ", expected: " << expected.length());
+
+            std::string str = outputBuffer->message();
+            CHECK(str == expected, "message #" << std::dec << message << " differs");
+
+            pb::RedoResponse redoResponse;
+            CHECK(redoResponse.ParseFromString(str), "message #" << std::dec << message << " can't be parsed");
+            std::mt19937_64 randomCheck(seed);
+            pb::RedoResponse check;
+            fillResponse(&check, randomCheck, size);
+            CHECK(redoResponse.SerializeAsString() == check.SerializeAsString(), "message #" << std::dec << message << " parsed differently");
+
+            outputBuffer->discard();
+        }
+    }
+
+    //messages of a batch are length delimited in one output message
+    static void testBatch(void) {
+        TestOutputProtobuf output(NUMBER_FORMAT_TEXT);
+        TestOutputBufferProtobuf* outputBuffer = output.outputBuffer;
+        std::mt19937_64 random(2);
+        std::vector<std::string> expected;
+
+        outputBuffer->outputBufferBegin(0);
+        outputBuffer->batchOpen = true;
+        for (uint64_t message = 0; message < TEST_PROTOBUF_MESSAGES; ++message) {
+            outputBuffer->createResponse();
+            fillResponse(outputBuffer->redoResponsePB, random, random() % (OUTPUT_BUFFER_DATA_SIZE / 4));
+            expected.push_back(outputBuffer->redoResponsePB->SerializeAsString());
+            CHECK(outputBuffer->appendResponse(), "batch message #" << std::dec << message);
+        }
+        outputBuffer->batchOpen = false;
+
+        std::string str = outputBuffer->message();
+        google::protobuf::io::ArrayInputStream arrayStream(str.c_str(), str.length());
+        google::protobuf::io::CodedInputStream codedStream(&arrayStream);
+        codedStream.SetTotalBytesLimit(str.length());
+        for (uint64_t message = 0; message < TEST_PROTOBUF_MESSAGES; ++message) {
+            uint32_t length = 0;
+            std::string data;
+            CHECK(codedStream.ReadVarint32(&length), "batch message #" << std::dec << message << " length missing");
+            CHECK(codedStream.ReadString(&data, length), "batch message #" << std::dec << message << " truncated");
+            CHECK(data == expected[message], "batch message #" << std::dec << message << " differs");
+        }
+        CHECK(codedStream.CurrentPosition() == (int)str.length(), "trailing bytes after batch");
+
+        outputBuffer->discard();
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        OpenLogReplicator::testSerialize();
+        OpenLogReplicator::testBatch();
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return OpenLogReplicator::testResult("TestProtobuf");
+}
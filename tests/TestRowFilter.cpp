@@ -0,0 +1,384 @@
+/* Test of table row filter conditions
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <random>
+
+#include "ConfigurationException.h"
+#include "OracleColumn.h"
+#include "OracleObject.h"
+#include "RowFilter.h"
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestNumberEncoder.h"
+
+#define TEST_ROW_FILTER_VALUES              64
+#define TEST_ROW_FILTER_ROUNDS              8
+#define TEST_ROW_FILTER_MANTISSA            1000000000000
+
+#define TEST_COL_N                          0
+#define TEST_COL_C                          1
+#define TEST_COL_V                          2
+#define TEST_COL_D                          3
+#define TEST_COL_NC                         4
+#define TEST_COL_L                          5
+#define TEST_COL_R                          6
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    uint8_t* values[MAX_NO_COLUMNS][4];
+    uint64_t lengths[MAX_NO_COLUMNS][4];
+    std::string data[MAX_NO_COLUMNS][4];
+
+    static void rowClear(void) {
+        for (uint64_t col = 0; col < MAX_NO_COLUMNS; ++col)
+            for (uint64_t type = 0; type < 4; ++type) {
+                values[col][type] = nullptr;
+                lengths[col][type] = 0;
+            }
+    }
+
+    static void rowSet(typeCOL col, uint64_t type, const std::string& bytes) {
+        data[col][type] = bytes;
+        values[col][type] = (uint8_t*)data[col][type].c_str();
+        lengths[col][type] = bytes.length();
+    }
+
+    static void addColumn(OracleObject* object, const char* name, uint64_t typeNo, uint64_t charsetId, bool storedAsLob) {
+        std::string columnName(name);
+        typeCOL segColNo = object->columns.size() + 1;
+        OracleColumn* column = new OracleColumn(segColNo, -1, segColNo, columnName, typeNo, 22, -1, -1, 0, charsetId, true, false, storedAsLob,
+                false, false, false, false, false);
+        object->addColumn(column);
+    }
+
+    //N NUMBER, C CHAR, V VARCHAR2, D DATE, NC NCHAR, L CLOB, R RAW
+    static OracleObject* createObject(void) {
+        std::string owner("TEST");
+        std::string name("T");
+        OracleObject* object = new OracleObject(1, 1, 1, 0, 0, owner, name);
+        addColumn(object, "N", 2, 0, false);
+        addColumn(object, "C", 96, 873, false);
+        addColumn(object, "V", 1, 873, false);
+        addColumn(object, "D", 12, 0, false);
+        addColumn(object, "NC", 96, 2000, false);
+        addColumn(object, "L", 1, 873, true);
+        addColumn(object, "R", 23, 0, false);
+        return object;
+    }
+
+    static bool evaluate(OracleObject* object, const char* condition, uint64_t type) {
+        RowFilter filter(object, condition);
+        return filter.evaluate(values, lengths, type);
+    }
+
+    static bool rejected(OracleObject* object, const std::string& condition) {
+        uint64_t traceOld = trace;
+        trace = TRACE_SILENT;
+        bool ret = false;
+        try {
+            RowFilter filter(object, condition);
+        } catch (ConfigurationException& ex) {
+            ret = true;
+        }
+        trace = traceOld;
+        return ret;
+    }
+
+    //value m / 10^scale as digits in the form taken by the reference encoder
+    struct TestDecimal {
+        int64_t mantissa;
+        uint64_t scale;
+        bool negative;
+        std::string integer;
+        std::string fraction;
+        std::string text;
+        std::string bytes;
+    };
+
+    static TestDecimal makeDecimal(int64_t mantissa, uint64_t scale) {
+        TestDecimal value;
+        value.mantissa = mantissa;
+        value.scale = scale;
+        value.negative = (mantissa < 0);
+
+        std::string digits = std::to_string(value.negative ? -mantissa : mantissa);
+        while (digits.length() <= scale)
+            digits = "0" + digits;
+        value.integer = digits.substr(0, digits.length() - scale);
+        value.fraction = digits.substr(digits.length() - scale);
+        value.integer.erase(0, value.integer.find_first_not_of('0'));
+        if (value.integer.length() == 0)
+            value.integer = "0";
+        while (value.fraction.length() > 0 && value.fraction[value.fraction.length() - 1] == '0')
+            value.fraction.pop_back();
+        if (value.integer == "0" && value.fraction.length() == 0)
+            value.negative = false;
+
+        value.text = (value.negative ? "-" : "") + value.integer;
+        if (value.fraction.length() > 0)
+            value.text += "." + value.fraction;
+        std::vector<uint8_t> bytes = encodeNumber(value.negative, value.integer, value.fraction);
+        value.bytes.assign(bytes.begin(), bytes.end());
+        return value;
+    }
+
+    static int64_t compareDecimal(const TestDecimal& a, const TestDecimal& b) {
+        int64_t left = a.mantissa;
+        int64_t right = b.mantissa;
+        for (uint64_t i = a.scale; i < 6; ++i)
+            left *= 10;
+        for (uint64_t i = b.scale; i < 6; ++i)
+            right *= 10;
+        return (left < right) ? -1 : (left > right ? 1 : 0);
+    }
+
+    //every comparison of every pair of a random pool against exact decimal comparison
+    static void testNumberCompare(OracleObject* object) {
+        const char* ops[] = {"=", "<>", "<", "<=", ">", ">="};
+        std::mt19937_64 random(1);
+        rowClear();
+
+        for (uint64_t round = 0; round < TEST_ROW_FILTER_ROUNDS; ++round) {
+            std::vector<TestDecimal> pool;
+            pool.push_back(makeDecimal(0, 0));
+            pool.push_back(makeDecimal(1, 0));
+            pool.push_back(makeDecimal(-1, 0));
+            pool.push_back(makeDecimal(15, 1));
+            pool.push_back(makeDecimal(-15, 1));
+            pool.push_back(makeDecimal(100, 0));
+            while (pool.size() < TEST_ROW_FILTER_VALUES) {
+                //narrow ranges give equal values and shared digit prefixes
+                int64_t range = (random() % 2 == 0) ? 1000 : TEST_ROW_FILTER_MANTISSA;
+                int64_t mantissa = (int64_t)(random() % range) - (range / 2);
+                pool.push_back(makeDecimal(mantissa, random() % 7));
+            }
+
+            for (const TestDecimal& literal : pool) {
+                for (uint64_t op = 0; op < 6; ++op) {
+                    RowFilter filter(object, std::string("N ") + ops[op] + " " + literal.text);
+                    for (const TestDecimal& value : pool) {
+                        rowSet(TEST_COL_N, VALUE_AFTER, value.bytes);
+                        int64_t ret = compareDecimal(value, literal);
+                        bool expected;
+                        switch (op) {
+                        case 0: expected = (ret == 0); break;
+                        case 1: expected = (ret != 0); break;
+                        case 2: expected = (ret < 0); break;
+                        case 3: expected = (ret <= 0); break;
+                        case 4: expected = (ret > 0); break;
+                        default: expected = (ret >= 0);
+                        }
+                        CHECK(filter.evaluate(values, lengths, TRANSACTION_INSERT) == expected, value.text << " " << ops[op] << " " << literal.text);
+                    }
+                }
+            }
+        }
+    }
+
+    //NULL compares as UNKNOWN, NOT keeps UNKNOWN, only TRUE passes
+    static void testNull(OracleObject* object) {
+        rowClear();
+        rowSet(TEST_COL_V, VALUE_AFTER, "A");
+        CHECK(!evaluate(object, "N = 5", TRANSACTION_INSERT), "null = 5");
+        CHECK(!evaluate(object, "NOT N = 5", TRANSACTION_INSERT), "not (null = 5)");
+        CHECK(!evaluate(object, "N <> 5", TRANSACTION_INSERT), "null <> 5");
+        CHECK(evaluate(object, "N IS NULL", TRANSACTION_INSERT), "null is null");
+        CHECK(!evaluate(object, "N IS NOT NULL", TRANSACTION_INSERT), "null is not null");
+        CHECK(evaluate(object, "N = 5 OR V = 'A'", TRANSACTION_INSERT), "unknown or true");
+        CHECK(!evaluate(object, "N = 5 AND V = 'A'", TRANSACTION_INSERT), "unknown and true");
+        CHECK(evaluate(object, "NOT (N = 5 AND V = 'B')", TRANSACTION_INSERT), "not (unknown and false)");
+        CHECK(!evaluate(object, "NOT (N = 5 OR V = 'B')", TRANSACTION_INSERT), "not (unknown or false)");
+
+        //empty value is NULL
+        rowSet(TEST_COL_N, VALUE_AFTER, "");
+        CHECK(evaluate(object, "N IS NULL", TRANSACTION_INSERT), "empty is null");
+        CHECK(!evaluate(object, "N IN (1, 2)", TRANSACTION_INSERT), "empty in");
+        CHECK(!evaluate(object, "N NOT IN (1, 2)", TRANSACTION_INSERT), "empty not in");
+    }
+
+    static void testStrings(OracleObject* object) {
+        rowClear();
+        rowSet(TEST_COL_V, VALUE_AFTER, "B");
+        CHECK(evaluate(object, "V IN ('A', 'B')", TRANSACTION_INSERT), "B in (A, B)");
+        CHECK(!evaluate(object, "V NOT IN ('A', 'B')", TRANSACTION_INSERT), "B not in (A, B)");
+        CHECK(!evaluate(object, "V IN ('A', 'C')", TRANSACTION_INSERT), "B in (A, C)");
+        CHECK(evaluate(object, "V NOT IN ('A', 'C')", TRANSACTION_INSERT), "B not in (A, C)");
+        CHECK(evaluate(object, "v = 'B'", TRANSACTION_INSERT), "lower case column name");
+        CHECK(evaluate(object, "\"V\" = 'B'", TRANSACTION_INSERT), "quoted column name");
+        CHECK(evaluate(object, "V > 'A' AND V < 'BA'", TRANSACTION_INSERT), "B between A and BA");
+
+        //VARCHAR2 keeps trailing blanks
+        rowSet(TEST_COL_V, VALUE_AFTER, "A ");
+        CHECK(!evaluate(object, "V = 'A'", TRANSACTION_INSERT), "varchar2 'A ' = 'A'");
+        CHECK(evaluate(object, "V = 'A '", TRANSACTION_INSERT), "varchar2 'A ' = 'A '");
+        rowSet(TEST_COL_V, VALUE_AFTER, "it's");
+        CHECK(evaluate(object, "V = 'it''s'", TRANSACTION_INSERT), "doubled quote");
+
+        //CHAR compares without trailing blanks on both sides
+        rowSet(TEST_COL_C, VALUE_AFTER, "AB   ");
+        CHECK(evaluate(object, "C = 'AB'", TRANSACTION_INSERT), "char 'AB   ' = 'AB'");
+        CHECK(evaluate(object, "C = 'AB '", TRANSACTION_INSERT), "char 'AB   ' = 'AB '");
+        CHECK(!evaluate(object, "C = 'A'", TRANSACTION_INSERT), "char 'AB   ' = 'A'");
+        CHECK(evaluate(object, "C > 'AA'", TRANSACTION_INSERT), "char 'AB   ' > 'AA'");
+        CHECK(!evaluate(object, "C > 'AB'", TRANSACTION_INSERT), "char 'AB   ' > 'AB'");
+
+        //NCHAR in AL16UTF16
+        rowSet(TEST_COL_NC, VALUE_AFTER, std::string("\0X\0 \0 ", 6));
+        CHECK(evaluate(object, "NC = 'X'", TRANSACTION_INSERT), "nchar = 'X'");
+        CHECK(!evaluate(object, "NC = 'Y'", TRANSACTION_INSERT), "nchar = 'Y'");
+        CHECK(evaluate(object, "NC < 'XA'", TRANSACTION_INSERT), "nchar < 'XA'");
+    }
+
+    static void testDates(OracleObject* object) {
+        rowClear();
+        //2020-06-15 12:30:00
+        rowSet(TEST_COL_D, VALUE_AFTER, std::string("\x78\x78\x06\x0F\x0D\x1F\x01", 7));
+        CHECK(evaluate(object, "D >= DATE '2020-01-01'", TRANSACTION_INSERT), "date >= 2020-01-01");
+        CHECK(evaluate(object, "D > '2020-06-15'", TRANSACTION_INSERT), "date > 2020-06-15");
+        CHECK(evaluate(object, "D = TIMESTAMP '2020-06-15 12:30:00'", TRANSACTION_INSERT), "date = 2020-06-15 12:30:00");
+        CHECK(!evaluate(object, "D < '2020-06-15 12:30:00'", TRANSACTION_INSERT), "date < 2020-06-15 12:30:00");
+        CHECK(evaluate(object, "D < '2020-06-15 12:30:01'", TRANSACTION_INSERT), "date < 2020-06-15 12:30:01");
+        CHECK(!evaluate(object, "D < '1999-12-31'", TRANSACTION_INSERT), "date < 1999-12-31");
+    }
+
+    //update: after image, before image when the column is not changed, pass when the column is not in redo at all
+    static void testUpdateDelete(OracleObject* object) {
+        rowClear();
+        CHECK(evaluate(object, "N = 6", TRANSACTION_UPDATE), "update without column passes");
+        CHECK(evaluate(object, "N IS NULL AND N = 6", TRANSACTION_UPDATE), "update without column passes");
+        CHECK(!evaluate(object, "N = 6", TRANSACTION_INSERT), "insert without column");
+
+        rowSet(TEST_COL_N, VALUE_BEFORE, std::string("\xC1\x06", 2));
+        CHECK(evaluate(object, "N = 5", TRANSACTION_UPDATE), "update with before only");
+        CHECK(!evaluate(object, "N = 6", TRANSACTION_UPDATE), "update with before only");
+
+        rowSet(TEST_COL_N, VALUE_AFTER, std::string("\xC1\x07", 2));
+        CHECK(evaluate(object, "N = 6", TRANSACTION_UPDATE), "update with after");
+        CHECK(!evaluate(object, "N = 5", TRANSACTION_UPDATE), "update with after");
+
+        //delete uses the before image only
+        CHECK(evaluate(object, "N = 5", TRANSACTION_DELETE), "delete with before");
+        CHECK(!evaluate(object, "N = 6", TRANSACTION_DELETE), "delete with before");
+        values[TEST_COL_N][VALUE_BEFORE] = nullptr;
+        CHECK(!evaluate(object, "N = 6", TRANSACTION_DELETE), "delete without before");
+        CHECK(evaluate(object, "N IS NULL", TRANSACTION_DELETE), "delete without before");
+    }
+
+    static void testRejected(OracleObject* object) {
+        const char* conditions[] = {
+            "",
+            "   ",
+            "N",
+            "N >",
+            "N = ",
+            "N == 1",
+            "X = 1",
+            "N = 'a'",
+            "N = 1.2.3",
+            "V = 1",
+            "(N = 1",
+            "N = 1)",
+            "N = 1 N",
+            "N = 1 AND",
+            "N IS 5",
+            "N NOT 5",
+            "N IN ()",
+            "N IN (1,)",
+            "V = 'unterminated",
+            "\"V = 'A'",
+            "N = 1 @ 2",
+            "NC = '\xC3\xA9'",
+            "D = '2020-13-01'",
+            "D = '2020-01-01 24:00:00'",
+            "D = 'yesterday'",
+            "L = 'a'",
+            "R = 1"
+        };
+        for (const char* condition : conditions)
+            CHECK(rejected(object, condition), "accepted: " << condition);
+    }
+
+    //exponent byte 0x81 is the smallest positive one, 0x80 is zero
+    static void testNumberRange(OracleObject* object) {
+        std::string small("0.");
+        small.append(127, '0');
+        rowClear();
+
+        rowSet(TEST_COL_N, VALUE_AFTER, std::string("\x81\x02", 2));
+        CHECK(evaluate(object, (std::string("N = ") + small + "1").c_str(), TRANSACTION_INSERT), "1e-128");
+        CHECK(evaluate(object, "N > 0", TRANSACTION_INSERT), "1e-128 > 0");
+        CHECK(rejected(object, std::string("N = ") + small + "01"), "1e-129");
+        CHECK(rejected(object, std::string("N > ") + small + "09"), "9e-129");
+
+        rowSet(TEST_COL_N, VALUE_AFTER, std::string("\x7E\x64\x66", 3));
+        CHECK(evaluate(object, (std::string("N = -") + small + "1").c_str(), TRANSACTION_INSERT), "-1e-128");
+        CHECK(rejected(object, std::string("N = -") + small + "01"), "-1e-129");
+
+        std::string large("1");
+        large.append(125, '0');
+        rowSet(TEST_COL_N, VALUE_AFTER, std::string("\xFF\x0B", 2));
+        CHECK(evaluate(object, (std::string("N = ") + large).c_str(), TRANSACTION_INSERT), "1e125");
+        CHECK(rejected(object, std::string("N = ") + large + "0"), "1e126");
+
+        //at most 20 base 100 digits
+        CHECK(!rejected(object, "N = 1234567890123456789012345678901234567890"), "40 digits");
+        CHECK(rejected(object, "N = 1.234567890123456789012345678901234567891"), "41 digits");
+    }
+
+    //nesting is limited by the evaluation stack
+    static void testDepth(OracleObject* object) {
+        rowClear();
+        rowSet(TEST_COL_N, VALUE_AFTER, std::string("\xC1\x02", 2));
+
+        for (uint64_t levels = ROW_FILTER_MAX_DEPTH; levels <= ROW_FILTER_MAX_DEPTH + 1; ++levels) {
+            std::string condition;
+            for (uint64_t i = 1; i < levels; ++i)
+                condition += "N = 1 AND (";
+            condition += "N = 1";
+            condition.append(levels - 1, ')');
+
+            if (levels <= ROW_FILTER_MAX_DEPTH)
+                CHECK(evaluate(object, condition.c_str(), TRANSACTION_INSERT), "depth " << std::dec << levels);
+            else
+                CHECK(rejected(object, condition), "depth " << std::dec << levels);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    OpenLogReplicator::OracleObject* object = nullptr;
+    try {
+        object = OpenLogReplicator::createObject();
+        OpenLogReplicator::testNumberCompare(object);
+        OpenLogReplicator::testNull(object);
+        OpenLogReplicator::testStrings(object);
+        OpenLogReplicator::testDates(object);
+        OpenLogReplicator::testUpdateDelete(object);
+        OpenLogReplicator::testRejected(object);
+        OpenLogReplicator::testNumberRange(object);
+        OpenLogReplicator::testDepth(object);
+    } catch (OpenLogReplicator::ConfigurationException& ex) {
+        return TEST_FAIL;
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    delete object;
+    return OpenLogReplicator::testResult("TestRowFilter");
+}
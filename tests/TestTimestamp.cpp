@@ -0,0 +1,116 @@
+/* Test of calendar arithmetic, ISO-8601 formatting and time zone lookup
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <ctime>
+#include <random>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBuffer.h"
+
+#define TEST_TIMESTAMP_YEAR_MIN             -4712
+#define TEST_TIMESTAMP_YEAR_MAX             9999
+#define TEST_TIMESTAMP_RANDOM               100000
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    static int64_t referenceDays(int64_t year, int64_t month, int64_t day) {
+        struct tm epochTime;
+        memset(&epochTime, 0, sizeof(epochTime));
+        epochTime.tm_year = year - 1900;
+        epochTime.tm_mon = month - 1;
+        epochTime.tm_mday = day;
+        return timegm(&epochTime) / 86400;
+    }
+
+    //every day of the supported range, the cache is hit by asking for each day twice
+    static void testDays(void) {
+        TestOutputBufferJson outputBuffer(NUMBER_FORMAT_TEXT);
+        const int64_t monthDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        int64_t previous = referenceDays(TEST_TIMESTAMP_YEAR_MIN, 1, 1) - 1;
+
+        for (int64_t year = TEST_TIMESTAMP_YEAR_MIN; year <= TEST_TIMESTAMP_YEAR_MAX; ++year) {
+            bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+            for (int64_t month = 1; month <= 12; ++month) {
+                int64_t days = monthDays[month - 1] + ((month == 2 && leap) ? 1 : 0);
+                for (int64_t day = 1; day <= days; ++day) {
+                    int64_t result = outputBuffer.daysFromCivil(year, month, day);
+                    CHECK(result == previous + 1, "date: " << std::dec << year << "-" << month << "-" << day << " days: " << result);
+                    CHECK(outputBuffer.daysFromCivil(year, month, day) == result, "cached date: " << std::dec << year << "-" << month << "-" << day);
+                    previous = result;
+                }
+            }
+            CHECK(outputBuffer.daysFromCivil(year, 1, 1) == referenceDays(year, 1, 1), "year: " << std::dec << year);
+        }
+        CHECK(outputBuffer.daysFromCivil(1970, 1, 1) == 0, "epoch");
+    }
+
+    static void testIso8601(void) {
+        TestOutputBufferJson outputBuffer(NUMBER_FORMAT_TEXT);
+        std::mt19937_64 random(1);
+
+        for (uint64_t i = 0; i < TEST_TIMESTAMP_RANDOM; ++i) {
+            struct tm epochTime;
+            memset(&epochTime, 0, sizeof(epochTime));
+            epochTime.tm_year = (int64_t)(random() % (TEST_TIMESTAMP_YEAR_MAX - TEST_TIMESTAMP_YEAR_MIN + 1)) + TEST_TIMESTAMP_YEAR_MIN;
+            epochTime.tm_mon = 1 + random() % 12;
+            epochTime.tm_mday = 1 + random() % 28;
+            epochTime.tm_hour = random() % 24;
+            epochTime.tm_min = random() % 60;
+            epochTime.tm_sec = random() % 60;
+            uint64_t fraction = (random() & 1) ? random() % 1000000000 : 0;
+
+            char expected[64];
+            int length = snprintf(expected, sizeof(expected), "%d%s-%02d-%02dT%02d:%02d:%02d", abs(epochTime.tm_year), epochTime.tm_year > 0 ? "" : "BC",
+                    epochTime.tm_mon, epochTime.tm_mday, epochTime.tm_hour, epochTime.tm_min, epochTime.tm_sec);
+            if (fraction > 0)
+                snprintf(expected + length, sizeof(expected) - length, ".%09d", (int)fraction);
+
+            char buffer[64];
+            uint64_t bufferLength = outputBuffer.timestampToIso8601(buffer, epochTime, fraction);
+            CHECK(std::string(buffer, bufferLength) == expected, "got: " << std::string(buffer, bufferLength) << ", expected: " << expected);
+        }
+    }
+
+    //every possible key, only the known ones may be found
+    static void testTimeZones(void) {
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        TestOutputBufferJson* outputBuffer = output.outputBuffer;
+
+        for (uint64_t key = 0; key <= 0xFFFF; ++key) {
+            auto it = outputBuffer->timeZoneMap.find(key);
+            const char* expected = (it != outputBuffer->timeZoneMap.end()) ? it->second : nullptr;
+            const char* name = outputBuffer->findTimeZone(key);
+            CHECK(name == expected, "key: 0x" << std::hex << key << " found: " << (name != nullptr ? name : "none") <<
+                    ", expected: " << (expected != nullptr ? expected : "none"));
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        OpenLogReplicator::testDays();
+        OpenLogReplicator::testIso8601();
+        OpenLogReplicator::testTimeZones();
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return OpenLogReplicator::testResult("TestTimestamp");
+}
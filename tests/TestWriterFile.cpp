@@ -0,0 +1,269 @@
+/* Test of the file writer batching
+   Copyright (C) 2018-2022 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <random>
+#include <unistd.h>
+
+#include "RuntimeException.h"
+#include "Test.h"
+#include "TestOutputBuffer.h"
+#include "WriterFile.h"
+
+#define TEST_WRITER_FILE_QUEUE_SIZE         4096
+#define TEST_WRITER_FILE_MESSAGES           3000
+#define TEST_WRITER_FILE_LENGTH_MAX         300
+#define TEST_WRITER_FILE_WAIT_US            1000000000
+
+TEST_GLOBALS
+
+namespace OpenLogReplicator {
+    //writer to stdout with writev replaced by a script of results
+    class TestWriterFile : public WriterFile {
+    protected:
+        virtual int64_t writeBuffers(const struct iovec* iov, uint64_t count) {
+            ++calls;
+            if (count > maxCount)
+                maxCount = count;
+            //confirmed in order, the first message would be confirmed first
+            if ((batch.front()->flags & OUTPUT_BUFFER_CONFIRMED) != 0)
+                confirmedEarly = true;
+
+            //unlimited when the script is empty, repeated when it ends
+            int64_t result = INT64_MAX;
+            if (script.size() > 0)
+                result = script[(calls - 1) % script.size()];
+            if (result < 0) {
+                errno = -result;
+                return -1;
+            }
+
+            int64_t bytesWritten = 0;
+            for (uint64_t i = 0; i < count && bytesWritten < result; ++i) {
+                uint64_t length = iov[i].iov_len;
+                if ((int64_t)length > result - bytesWritten)
+                    length = result - bytesWritten;
+                written.append((const char*)iov[i].iov_base, length);
+                bytesWritten += length;
+            }
+            return bytesWritten;
+        }
+
+    public:
+        //bytes to write by each call, -errno to fail with
+        std::vector<int64_t> script;
+        std::string written;
+        uint64_t calls;
+        uint64_t maxCount;
+        bool confirmedEarly;
+
+        TestWriterFile(OracleAnalyzer* oracleAnalyzer, uint64_t newLine, uint64_t batchMessages, uint64_t batchBytes, uint64_t batchUs) :
+            WriterFile("test", oracleAnalyzer, 1000, 10, TEST_WRITER_FILE_QUEUE_SIZE, ZERO_SCN, ZERO_SEQ, "", 0, "", "", 0, newLine, 1,
+                    batchMessages, batchBytes, batchUs),
+            calls(0),
+            maxCount(0),
+            confirmedEarly(false) {
+        }
+
+        virtual ~TestWriterFile() {
+            //stdout is not closed
+            outputDes = -1;
+        }
+
+        using WriterFile::pollQueue;
+        using WriterFile::flush;
+
+        //queued like by Writer::run
+        void send(OutputBufferMsg* msg) {
+            createMessage(msg);
+            sendMessage(msg);
+        }
+
+        typeSCN confirmed(void) const {
+            return confirmedScn;
+        }
+
+        uint64_t queued(void) const {
+            return tmpQueueSize;
+        }
+
+        uint64_t size(void) const {
+            return outputSize;
+        }
+    };
+
+    //messages kept in the first output buffer chunk, confirmed in id order
+    struct TestMessages {
+        std::vector<std::string> data;
+        std::vector<OutputBufferMsg> msgs;
+
+        TestMessages(uint64_t count, uint64_t lengthMax, std::mt19937_64& random) :
+            data(count),
+            msgs(count) {
+            for (uint64_t i = 0; i < count; ++i) {
+                uint64_t length = (lengthMax > 0) ? random() % (lengthMax + 1) : 0;
+                for (uint64_t j = 0; j < length; ++j)
+                    data[i] += (char)('a' + (random() % 26));
+
+                OutputBufferMsg& msg = msgs[i];
+                memset(&msg, 0, sizeof(msg));
+                msg.id = i;
+                msg.queueId = 0;
+                msg.length = length;
+                msg.scn = i + 1;
+                msg.sequence = 1;
+                msg.data = (uint8_t*)&data[i][0];
+            }
+        }
+
+        std::string expected(uint64_t begin, uint64_t end, uint64_t newLine) const {
+            std::string str;
+            for (uint64_t i = begin; i < end; ++i) {
+                str += data[i];
+                if (newLine == 1)
+                    str += "\n";
+                else if (newLine == 2)
+                    str += "\r\n";
+            }
+            return str;
+        }
+    };
+
+    //one batch of many buffers written by calls which stop anywhere, also inside a buffer
+    static void testPartialWrites(void) {
+        std::vector<std::vector<int64_t>> scripts = {{}, {1}, {7}, {1000}, {3, -EINTR, 100000, 1}};
+        std::mt19937_64 random(1);
+        std::vector<int64_t> randomScript;
+        for (uint64_t i = 0; i < 1000; ++i)
+            randomScript.push_back((random() % 16 == 0) ? -EINTR : 1 + random() % 5000);
+        scripts.push_back(randomScript);
+
+        for (uint64_t newLine = 0; newLine <= 2; ++newLine) {
+            for (const std::vector<int64_t>& script : scripts) {
+                TestOutput output(NUMBER_FORMAT_TEXT);
+                TestMessages messages(TEST_WRITER_FILE_MESSAGES, TEST_WRITER_FILE_LENGTH_MAX, random);
+                TestWriterFile writer(output.analyzer, newLine, TEST_WRITER_FILE_MESSAGES, UINT64_MAX, TEST_WRITER_FILE_WAIT_US);
+                writer.initialize();
+                writer.script = script;
+
+                for (uint64_t i = 0; i < TEST_WRITER_FILE_MESSAGES - 1; ++i)
+                    writer.send(&messages.msgs[i]);
+                CHECK(writer.calls == 0, "written before the batch is full, new line: " << std::dec << newLine);
+                CHECK(writer.queued() == TEST_WRITER_FILE_MESSAGES - 1, "confirmed before written: " << std::dec << writer.queued());
+
+                writer.send(&messages.msgs[TEST_WRITER_FILE_MESSAGES - 1]);
+                std::string expected = messages.expected(0, TEST_WRITER_FILE_MESSAGES, newLine);
+                CHECK(writer.written == expected, "content differs, new line: " << std::dec << newLine << ", script size: " << script.size() <<
+                        ", written: " << writer.written.length() << " of " << expected.length() << " bytes");
+                CHECK(writer.size() == expected.length(), "output size: " << std::dec << writer.size() << ", expected: " << expected.length());
+                CHECK(writer.maxCount <= WRITERFILE_IOV_MAX, "buffers in one call: " << std::dec << writer.maxCount);
+                CHECK(!writer.confirmedEarly, "confirmed while the batch is written, new line: " << std::dec << newLine);
+                CHECK(writer.queued() == 0, "left unconfirmed: " << std::dec << writer.queued());
+                CHECK(writer.confirmed() == TEST_WRITER_FILE_MESSAGES, "confirmed scn: " << std::dec << writer.confirmed());
+            }
+        }
+
+        //empty messages without new lines need no write at all
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        TestMessages messages(10, 0, random);
+        TestWriterFile writer(output.analyzer, 0, 10, UINT64_MAX, TEST_WRITER_FILE_WAIT_US);
+        writer.initialize();
+        writer.script = {0};
+        for (uint64_t i = 0; i < 10; ++i)
+            writer.send(&messages.msgs[i]);
+        CHECK(writer.calls == 0, "empty buffers written: " << std::dec << writer.calls << " calls");
+        CHECK(writer.queued() == 0, "empty messages left unconfirmed: " << std::dec << writer.queued());
+    }
+
+    //a batch is confirmed as a whole once written: by message count, size, stop and time
+    static void testConfirmation(void) {
+        std::mt19937_64 random(2);
+        TestOutput output(NUMBER_FORMAT_TEXT);
+        TestMessages messages(16, 0, random);
+        for (uint64_t i = 0; i < 16; ++i) {
+            messages.data[i] = std::string(30, 'a' + i);
+            messages.msgs[i].data = (uint8_t*)&messages.data[i][0];
+            messages.msgs[i].length = 30;
+        }
+
+        //4 messages or 100 bytes of 31 byte lines
+        TestWriterFile writer(output.analyzer, 1, 4, 100, TEST_WRITER_FILE_WAIT_US);
+        writer.initialize();
+        for (uint64_t i = 0; i < 3; ++i) {
+            writer.send(&messages.msgs[i]);
+            CHECK(writer.confirmed() == ZERO_SCN, "message #" << std::dec << i << " confirmed before the batch is full");
+            CHECK(writer.written.length() == 0, "message #" << std::dec << i << " written before the batch is full");
+        }
+        writer.send(&messages.msgs[3]);
+        CHECK(writer.calls == 1, "batch of 4 messages written by " << std::dec << writer.calls << " calls");
+        CHECK(writer.confirmed() == 4, "confirmed scn after the size limit: " << std::dec << writer.confirmed());
+        CHECK(writer.queued() == 0, "left unconfirmed: " << std::dec << writer.queued());
+
+        //polling before the time limit keeps the batch open, stopping writes it
+        writer.send(&messages.msgs[4]);
+        writer.send(&messages.msgs[5]);
+        writer.pollQueue();
+        CHECK(writer.confirmed() == 4, "confirmed scn before the time limit: " << std::dec << writer.confirmed());
+        writer.stop = true;
+        writer.pollQueue();
+        CHECK(writer.confirmed() == 6, "confirmed scn after stop: " << std::dec << writer.confirmed());
+        writer.stop = false;
+        CHECK(writer.written == messages.expected(0, 6, 1), "content differs after stop");
+
+        //a failed write confirms nothing, the batch is kept
+        uint64_t traceOld = trace;
+        trace = TRACE_SILENT;
+        std::vector<std::vector<int64_t>> scripts = {{0}, {-EIO}, {10, 0}, {-EINTR, 10, -ENOSPC}};
+        for (const std::vector<int64_t>& script : scripts) {
+            TestWriterFile failing(output.analyzer, 1, 4, UINT64_MAX, TEST_WRITER_FILE_WAIT_US);
+            failing.initialize();
+            failing.script = script;
+            bool failed = false;
+            try {
+                for (uint64_t i = 0; i < 4; ++i)
+                    failing.send(&messages.msgs[6 + i]);
+            } catch (RuntimeException& ex) {
+                failed = true;
+            }
+            CHECK(failed, "no error for script of " << std::dec << script.size() << " results");
+            CHECK(failing.calls == script.size(), "calls: " << std::dec << failing.calls << ", expected: " << script.size());
+            CHECK(failing.confirmed() == ZERO_SCN, "confirmed scn after a failed write: " << std::dec << failing.confirmed());
+            CHECK(failing.queued() == 4, "queued after a failed write: " << std::dec << failing.queued());
+        }
+        trace = traceOld;
+
+        //time limit
+        TestWriterFile timed(output.analyzer, 0, 4, UINT64_MAX, 1000);
+        timed.initialize();
+        timed.send(&messages.msgs[10]);
+        usleep(2000);
+        timed.pollQueue();
+        CHECK(timed.confirmed() == 11, "confirmed scn after the time limit: " << std::dec << timed.confirmed());
+        CHECK(timed.written == messages.data[10], "content differs after the time limit");
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        OpenLogReplicator::testPartialWrites();
+        OpenLogReplicator::testConfirmation();
+    } catch (OpenLogReplicator::RuntimeException& ex) {
+        return TEST_FAIL;
+    }
+    return OpenLogReplicator::testResult("TestWriterFile");
+}